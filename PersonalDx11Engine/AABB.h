@@ -1,5 +1,6 @@
 #pragma once
 #include "Math.h"
+#include <cfloat>
 //연산을 위해 사용하는 구조체, 내부멤버는 XMVECOTR 16바이트 정렬
 struct alignas(16) FAABB
 {
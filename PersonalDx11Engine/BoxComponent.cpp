@@ -1,5 +1,7 @@
 #include "BoxComponent.h"
+#ifndef PHYSICS_HEADLESS
 #include "DebugDrawerManager.h"
+#endif
 #include "Debug.h"
 #include "PhysicsDefine.h"
 
@@ -7,7 +9,7 @@ Vector3 UBoxComponent::GetWorldSupportPoint(const Vector3& WorldDirection) const
 {
     // 입력 방향 확인 및 정규화
     XMVECTOR Dir = XMLoadFloat3(&WorldDirection);
-    if (XMVector3LengthSq(Dir).m128_f32[0] < KINDA_SMALL)
+    if (XMVectorGetX(XMVector3LengthSq(Dir)) < KINDA_SMALL)
     {
         Dir = XMVectorSet(0.0f, 1.0f, 0.0f, 0.0f);
     }
@@ -117,6 +119,7 @@ void UBoxComponent::RequestDebugRender(const float DeltaTime)
     //    LOG("BOX WolrdTransform ==========\n %s \n===============",Debug::ToString(WolrdTransform));
     //    LOG("BOX LocalTransform ==========\n %s \n===============",Debug::ToString(LocalTransform));
     //}
+#ifndef PHYSICS_HEADLESS
     UDebugDrawManager::Get()->DrawBox(
         GetWorldPosition(),
         GetWorldScale(),
@@ -124,4 +127,5 @@ void UBoxComponent::RequestDebugRender(const float DeltaTime)
         Vector4(1, 1, 0, 1),
         DeltaTime
     );
+#endif
 }
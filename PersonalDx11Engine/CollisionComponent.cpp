@@ -7,6 +7,16 @@
 #include "TypeCast.h"
 #include "PhysicsStateInternalInterface.h"
 
+namespace
+{
+	bool IsSameTransform(const FTransform& InA, const FTransform& InB)
+	{
+		return InA.Position == InB.Position && InA.Scale == InB.Scale &&
+			InA.Rotation.x == InB.Rotation.x && InA.Rotation.y == InB.Rotation.y &&
+			InA.Rotation.z == InB.Rotation.z && InA.Rotation.w == InB.Rotation.w;
+	}
+}
+
 
 
 UCollisionComponentBase::UCollisionComponentBase() 
@@ -30,7 +40,9 @@ Vector3 UCollisionComponentBase::GetScaledHalfExtent() const
 
 bool UCollisionComponentBase::IsStatic() const
 {
-	return RigidBody.lock()->IsStatic();
+	// 강체가 없으면 움직일 수 있는 것으로 보고 동적 계층에 둠
+	auto Rigid = RigidBody.lock();
+	return Rigid && Rigid->IsStatic();
 }
 
 void UCollisionComponentBase::BindRigidBody(const std::shared_ptr<URigidBodyComponent>& InRigidBody)
@@ -73,6 +85,8 @@ void UCollisionComponentBase::DeActivate()
 
 void UCollisionComponentBase::ActivateColiision()
 {
+	// 비동기 Tick 진행 중이면 충돌 트리를 바꾸기 전에 서브스텝 완료를 기다림
+	UPhysicsSystem::Get()->WaitAsyncWork();
 	auto shared = Engine::Cast<UCollisionComponentBase>(shared_from_this());
 	if (shared)
 	{
@@ -82,6 +96,7 @@ void UCollisionComponentBase::ActivateColiision()
 
 void UCollisionComponentBase::DeActivateCollision()
 {
+	UPhysicsSystem::Get()->WaitAsyncWork();
 	auto shared = Engine::Cast<UCollisionComponentBase>(shared_from_this());
 	if (shared) 
 	{
@@ -89,6 +104,32 @@ void UCollisionComponentBase::DeActivateCollision()
 	}
 }
 
+bool UCollisionComponentBase::IsCollisionActive() const
+{
+	if (!IsActive())
+		return false;
+	auto RigidPtr = RigidBody.lock();
+	return !RigidPtr || RigidPtr->IsActive();
+}
+
+void UCollisionComponentBase::SetCollisionLayer(const uint32_t InLayer)
+{
+	if (CollisionLayer == InLayer)
+		return;
+	UPhysicsSystem::Get()->WaitAsyncWork();
+	CollisionLayer = InLayer;
+	UPhysicsSystem::GetCollisionSubsystem()->RefreshCollisionFilter(*this);
+}
+
+void UCollisionComponentBase::SetCollisionMask(const uint32_t InMask)
+{
+	if (CollisionMask == InMask)
+		return;
+	UPhysicsSystem::Get()->WaitAsyncWork();
+	CollisionMask = InMask;
+	UPhysicsSystem::GetCollisionSubsystem()->RefreshCollisionFilter(*this);
+}
+
 const FTransform& UCollisionComponentBase::GetWorldTransform() const
 {
 	return USceneComponent::GetWorldTransform();
@@ -129,8 +170,15 @@ void UCollisionComponentBase::Tick(const float DeltaTime)
 	if (!IsActive())
 		return;
 
+	// 정적 리프는 물리 스텝에서 바운드를 검사하지 않으므로 옮겨졌을 때만 갱신 요청
+	const FTransform& CurrentWorldTransform = GetWorldTransform();
+	if (IsStatic() && !IsSameTransform(PrevWorldTransform, CurrentWorldTransform))
+	{
+		UPhysicsSystem::GetCollisionSubsystem()->RefreshStaticBounds(*this);
+	}
+
 	//이전 트랜스폼 저장
-	PrevWorldTransform = GetWorldTransform();
+	PrevWorldTransform = CurrentWorldTransform;
 
 	if (bIsDebugVisualize)
 	{
@@ -35,6 +35,18 @@ public:
 	virtual ECollisionShapeType GetType() const override { return ECollisionShapeType::None; }
 
 	void SetDebugVisualize(const bool InBool) { bIsDebugVisualize = InBool; }
+
+	// 충돌 층/마스크 - 서로의 마스크에 상대 층 비트가 있어야 넓은 단계에서 충돌쌍을 만듦
+	void SetCollisionLayer(const uint32_t InLayer);
+	void SetCollisionMask(const uint32_t InMask);
+	uint32_t GetCollisionLayer() const { return CollisionLayer; }
+	uint32_t GetCollisionMask() const { return CollisionMask; }
+	bool CanCollideWith(const UCollisionComponentBase& Other) const
+	{
+		return (CollisionLayer & Other.CollisionMask) != 0 && (Other.CollisionLayer & CollisionMask) != 0;
+	}
+	// 충돌쌍 생성 대상 여부 - 연결된 강체가 꺼져 있으면 충돌체가 켜져 있어도 제외
+	bool IsCollisionActive() const;
 	
 protected:  
 	virtual void PostInitialized() override;
@@ -86,4 +98,7 @@ private:
 	FTransform PrevWorldTransform = FTransform();
 
 	bool bIsDebugVisualize = false;
+
+	uint32_t CollisionLayer = 1u;		// 속한 층 비트
+	uint32_t CollisionMask = ~0u;		// 충돌할 층 비트
 };
\ No newline at end of file
@@ -2,8 +2,53 @@
 #pragma once
 #include "Math.h"
 #include <memory>
+#include <cstdint>
+#include <cmath>
 #include "Transform.h"
 
+// 접촉점 - 특징 번호로 프레임 간 같은 접촉을 식별
+struct FContactPoint
+{
+	Vector3 Position;        // 접촉점 위치
+	float Penetration = 0.0f;      // 침투 깊이
+	uint32_t FeatureId = 0;        // 접촉을 만든 면/모서리/꼭짓점 조합
+	float AccumulatedNormalImpulse = 0.0f;   // 누적된 수직 충격량 - 다음 단계 웜 스타트
+	float AccumulatedTangentImpulse = 0.0f;  // 누적된 접선 충격량 (GetTangentBasis 첫째 축) - 다음 단계 웜 스타트
+	float AccumulatedBitangentImpulse = 0.0f; // 누적된 접선 충격량 (둘째 축)
+};
+
+// 접촉 다양체 - 쌍 하나의 접촉점 최대 4개 (법선은 쌍 공통)
+struct FContactManifold
+{
+	static constexpr uint32_t MAX_POINTS = 4;
+
+	FContactPoint Points[MAX_POINTS];
+	uint32_t PointCount = 0;
+
+	void AddPoint(const Vector3& InPosition, float InPenetration, uint32_t InFeatureId)
+	{
+		if (PointCount >= MAX_POINTS)
+			return;
+		FContactPoint& Point = Points[PointCount++];
+		Point = FContactPoint();
+		Point.Position = InPosition;
+		Point.Penetration = InPenetration;
+		Point.FeatureId = InFeatureId;
+	}
+
+	// 법선에 수직인 마찰 축 두 개 - 법선만으로 정해지므로 다음 단계에도 같은 축으로 누적 충격량을 이어받음
+	static void GetTangentBasis(const Vector3& InNormal, Vector3& OutTangent, Vector3& OutBitangent)
+	{
+		// 법선과 가장 덜 평행한 좌표축을 기준으로 사용
+		if (std::fabs(InNormal.x) >= 0.57735f)
+			OutTangent = Vector3(InNormal.y, -InNormal.x, 0.0f);
+		else
+			OutTangent = Vector3(0.0f, InNormal.z, -InNormal.y);
+		OutTangent.Normalize();
+		OutBitangent = Vector3::Cross(InNormal, OutTangent);
+	}
+};
+
 // 충돌 감지 결과
 struct FCollisionDetectionResult
 {
@@ -12,6 +57,7 @@ struct FCollisionDetectionResult
 	Vector3 Point = Vector3::Zero();       // 충돌 지점
 	float PenetrationDepth = 0.0f;       // 침투 깊이
 	float TimeOfImpact = 0.0f;           // 정규화된 충돌 시점 [0,1] == [이전프레임,현재프레임]
+	FContactManifold Manifold;           // 접촉점 - 충돌 시 최소 1개
 };
 
 
@@ -64,4 +110,15 @@ enum class ECollisionState
 	Enter,
 	Stay,
 	Exit,
+};
+
+// 프레임 단위 접촉 보고 - 서브스텝마다 기록하고 프레임 끝에 한 번에 전달
+// 같은 쌍의 연속된 Stay는 하나로 합쳐 마지막 서브스텝 결과만 남김
+struct FCollisionContactReport
+{
+	std::weak_ptr<class UCollisionComponentBase> ComponentA;
+	std::weak_ptr<class UCollisionComponentBase> ComponentB;
+	FCollisionDetectionResult DetectResult;
+	ECollisionState State = ECollisionState::None;
+	uint32_t SubstepCount = 1;     // 합쳐진 서브스텝 수
 };
\ No newline at end of file
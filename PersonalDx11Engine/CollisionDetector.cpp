@@ -1,9 +1,12 @@
 #include "CollisionDetector.h"
 #include <algorithm>
 #include "ConfigReadManager.h"
+#ifndef PHYSICS_HEADLESS
 #include "DebugDrawerManager.h"
+#endif
 #include <unordered_set>
 #include "AABB.h"
+#include <cfloat>
 
 FCollisionDetector::FCollisionDetector()
 {
@@ -34,6 +37,7 @@ FCollisionDetectionResult FCollisionDetector::DetectCollisionDiscrete(const ICol
 	if (Result.bCollided)
 	{
 		Result.TimeOfImpact = 1.0f; //Collide current Frame.
+		EnsureContactPoint(Result);
 
 		//auto sNormal = Debug::ToString(Result.Normal, "");
 		//LOG("[PDepth] : %.3f \n[ToImpact] : %.3f", Result.PenetrationDepth, Result.TimeOfImpact);
@@ -55,7 +59,7 @@ FCollisionDetectionResult FCollisionDetector::DetectCollisionCCD(
 	// Perform broad phase collision on swept volumes
 	// If SweptAABB_A and SweptAABB_B do not overlap, return no collision
 	FAABB SweptA = CalculateSweptAABB(ShapeA, PrevWorldTransformA, CurrentWorldTransformA);
-	FAABB SweptB = CalculateSweptAABB(ShapeA, PrevWorldTransformB, CurrentWorldTransformB);
+	FAABB SweptB = CalculateSweptAABB(ShapeB, PrevWorldTransformB, CurrentWorldTransformB);
 
 	if (!SweptA.IsOverlapping(SweptB))
 	{
@@ -94,43 +98,80 @@ FCollisionDetectionResult FCollisionDetector::DetectCollisionCCD(
 
 	// After iterations, endTime will be a close approximation of ImpactTime
 	Result.TimeOfImpact = endTime;
+	if (Result.bCollided)
+	{
+		EnsureContactPoint(Result);
+	}
 
 	return Result;
 }
 
+#pragma region Shape-Pair Dispatch
+// 지원하는 형상 쌍 - 검사 표를 채우기 전에 특수화해야 함
+template<>
+FCollisionDetectionResult FCollisionDetector::DetectShapePair<ECollisionShapeType::Sphere, ECollisionShapeType::Sphere>(
+	FCollisionDetector& Detector,
+	const ICollisionShape& ShapeA, const FTransform& WorldTransformA,
+	const ICollisionShape& ShapeB, const FTransform& WorldTransformB)
+{
+	return Detector.SphereSphere(
+		ShapeA.GetScaledHalfExtent().x, WorldTransformA,
+		ShapeB.GetScaledHalfExtent().x, WorldTransformB);
+}
+
+template<>
+FCollisionDetectionResult FCollisionDetector::DetectShapePair<ECollisionShapeType::Box, ECollisionShapeType::Box>(
+	FCollisionDetector& Detector,
+	const ICollisionShape& ShapeA, const FTransform& WorldTransformA,
+	const ICollisionShape& ShapeB, const FTransform& WorldTransformB)
+{
+	return Detector.BoxBoxSAT(
+		ShapeA.GetScaledHalfExtent(), WorldTransformA,
+		ShapeB.GetScaledHalfExtent(), WorldTransformB);
+}
+
+template<>
+FCollisionDetectionResult FCollisionDetector::DetectShapePair<ECollisionShapeType::Box, ECollisionShapeType::Sphere>(
+	FCollisionDetector& Detector,
+	const ICollisionShape& ShapeA, const FTransform& WorldTransformA,
+	const ICollisionShape& ShapeB, const FTransform& WorldTransformB)
+{
+	return Detector.BoxSphereSimple(
+		ShapeA.GetScaledHalfExtent(), WorldTransformA,
+		ShapeB.GetScaledHalfExtent().x, WorldTransformB);
+}
+
+template<>
+FCollisionDetectionResult FCollisionDetector::DetectShapePair<ECollisionShapeType::Sphere, ECollisionShapeType::Box>(
+	FCollisionDetector& Detector,
+	const ICollisionShape& ShapeA, const FTransform& WorldTransformA,
+	const ICollisionShape& ShapeB, const FTransform& WorldTransformB)
+{
+	auto Result = Detector.BoxSphereSimple(
+		ShapeB.GetScaledHalfExtent(), WorldTransformB,
+		ShapeA.GetScaledHalfExtent().x, WorldTransformA);
+	// 노멀 방향 반전
+	Result.Normal = -Result.Normal;
+	return Result;
+}
+
+const std::array<FCollisionDetector::FShapePairKernel, FCollisionDetector::SHAPE_TYPE_COUNT * FCollisionDetector::SHAPE_TYPE_COUNT>
+FCollisionDetector::ShapePairKernels = FCollisionDetector::MakeShapePairKernels(
+	std::make_index_sequence<FCollisionDetector::SHAPE_TYPE_COUNT * FCollisionDetector::SHAPE_TYPE_COUNT>());
+
 FCollisionDetectionResult FCollisionDetector::DetectCollisionShapeBasedDiscrete(const ICollisionShape& ShapeA, const FTransform& WorldTransformA, 
 																				const ICollisionShape& ShapeB, const FTransform& WorldTransformB)
 {
-	// 형상 타입에 따른 적절한 충돌 검사 함수 호출
-	if (ShapeA.GetType() == ECollisionShapeType::Sphere && ShapeB.GetType() == ECollisionShapeType::Sphere)
-	{
-		return SphereSphere(
-			ShapeA.GetScaledHalfExtent().x, WorldTransformA,
-			ShapeB.GetScaledHalfExtent().x, WorldTransformB);
-	}
-	else if (ShapeA.GetType() == ECollisionShapeType::Box && ShapeB.GetType() == ECollisionShapeType::Box)
-	{
-		return BoxBoxSAT(
-			ShapeA.GetScaledHalfExtent(), WorldTransformA,
-			ShapeB.GetScaledHalfExtent(), WorldTransformB);
-	}
-	else if (ShapeA.GetType() == ECollisionShapeType::Box && ShapeB.GetType() == ECollisionShapeType::Sphere)
-	{
-		return BoxSphereSimple(
-			ShapeA.GetScaledHalfExtent(), WorldTransformA,
-			ShapeB.GetScaledHalfExtent().x, WorldTransformB);
-	}
-	else if (ShapeA.GetType() == ECollisionShapeType::Sphere && ShapeB.GetType() == ECollisionShapeType::Box)
+	// 형상 타입 조합으로 검사 함수 선택 - 표에 없는 타입은 충돌 없음
+	const size_t TypeA = static_cast<size_t>(ShapeA.GetType());
+	const size_t TypeB = static_cast<size_t>(ShapeB.GetType());
+	if (TypeA >= SHAPE_TYPE_COUNT || TypeB >= SHAPE_TYPE_COUNT)
 	{
-		auto Result = BoxSphereSimple(
-			ShapeB.GetScaledHalfExtent(), WorldTransformB,
-			ShapeA.GetScaledHalfExtent().x, WorldTransformA);
-		// 노멀 방향 반전
-		Result.Normal = -Result.Normal;
-		return Result;
+		return FCollisionDetectionResult();
 	}
-	return FCollisionDetectionResult();
+	return ShapePairKernels[TypeA * SHAPE_TYPE_COUNT + TypeB](*this, ShapeA, WorldTransformA, ShapeB, WorldTransformB);
 }
+#pragma endregion
 
 #pragma region Shape-Based
 FCollisionDetectionResult FCollisionDetector::SphereSphere(
@@ -284,8 +325,13 @@ FCollisionDetectionResult FCollisionDetector::BoxBoxSAT(
 		}
 	}
 
-	float minPenetration = FLT_MAX;
-	XMVECTOR vCollisionNormal = XMVectorZero();
+	// 면 축과 모서리 축을 나눠 최소 침투 추적 - 접촉점 생성 방식이 다름
+	float minFacePenetration = FLT_MAX;
+	float minEdgePenetration = FLT_MAX;
+	int faceAxis = -1;
+	int edgeAxis = -1;
+	XMVECTOR vFaceNormal = XMVectorZero();
+	XMVECTOR vEdgeNormal = XMVectorZero();
 
 	// 각 축에 대해 투영 검사
 	for (int i = 0; i < 15; i++)
@@ -313,23 +359,63 @@ FCollisionDetectionResult FCollisionDetector::BoxBoxSAT(
 		if (penetration <= 0)
 			return Result;  // 분리축 발견
 
-		if (penetration < minPenetration)
+		float direction = XMVectorGetX(XMVector3Dot(vDelta, vAxis));
+		if (i < 6 && penetration < minFacePenetration)
 		{
-			minPenetration = penetration;
-			float direction = XMVectorGetX(XMVector3Dot(vDelta, vAxis));
-			vCollisionNormal = direction >= 0 ? vAxis : XMVectorNegate(vAxis);
+			minFacePenetration = penetration;
+			faceAxis = i;
+			vFaceNormal = direction >= 0 ? vAxis : XMVectorNegate(vAxis);
+		}
+		else if (i >= 6 && penetration < minEdgePenetration)
+		{
+			minEdgePenetration = penetration;
+			edgeAxis = i;
+			vEdgeNormal = direction >= 0 ? vAxis : XMVectorNegate(vAxis);
 		}
 	}
 
+	// 모서리 축은 충분히 얕을 때만 선택 - 비슷하면 면 축을 써서 쌓인 박스의 법선이 프레임마다 바뀌지 않도록
+	constexpr float EdgeAxisRelativeTolerance = 0.95f;
+	const bool bUseEdgeAxis = edgeAxis >= 0 &&
+		(faceAxis < 0 || minEdgePenetration < minFacePenetration * EdgeAxisRelativeTolerance);
+	const int collisionAxis = bUseEdgeAxis ? edgeAxis : faceAxis;
+	const float minPenetration = bUseEdgeAxis ? minEdgePenetration : minFacePenetration;
+	const XMVECTOR vCollisionNormal = bUseEdgeAxis ? vEdgeNormal : vFaceNormal;
+
 	// 충돌 발생
 	Result.bCollided = true;
 	XMStoreFloat3(&Result.Normal, vCollisionNormal);
 	Result.PenetrationDepth = minPenetration;
 
-	// 충돌 지점 계산
-	XMVECTOR vCollisionPoint = XMVectorAdd(vPosA,
-										   XMVectorMultiply(vCollisionNormal, XMVectorReplicate(minPenetration * 0.5f)));
-	XMStoreFloat3(&Result.Point, vCollisionPoint);
+	// 접촉 다양체 - 면 축이면 기준 면으로 대상 면을 잘라 최대 4점, 모서리 축이면 두 모서리의 최근접점
+	const float ExtentsA[3] = { HalfExtentA.x, HalfExtentA.y, HalfExtentA.z };
+	const float ExtentsB[3] = { HalfExtentB.x, HalfExtentB.y, HalfExtentB.z };
+	if (bUseEdgeAxis)
+	{
+		BuildBoxEdgeContact(collisionAxis, vCollisionNormal, vPosA, vAxesA, ExtentsA, vPosB, vAxesB, ExtentsB, Result);
+	}
+	else
+	{
+		BuildBoxFaceManifold(collisionAxis, vCollisionNormal, vPosA, vAxesA, ExtentsA, vPosB, vAxesB, ExtentsB, Result);
+	}
+
+	// 충돌 지점 계산 - 접촉점의 중심, 접촉점을 못 만들었으면 기존 근사
+	if (Result.Manifold.PointCount > 0)
+	{
+		XMVECTOR vCenter = XMVectorZero();
+		for (uint32_t i = 0; i < Result.Manifold.PointCount; ++i)
+		{
+			vCenter = XMVectorAdd(vCenter, XMLoadFloat3(&Result.Manifold.Points[i].Position));
+		}
+		vCenter = XMVectorScale(vCenter, 1.0f / static_cast<float>(Result.Manifold.PointCount));
+		XMStoreFloat3(&Result.Point, vCenter);
+	}
+	else
+	{
+		XMVECTOR vCollisionPoint = XMVectorAdd(vPosA,
+											   XMVectorMultiply(vCollisionNormal, XMVectorReplicate(minPenetration * 0.5f)));
+		XMStoreFloat3(&Result.Point, vCollisionPoint);
+	}
 
 	// --- 충돌 지점 계산 (Deepest Penetrating Vertex 근사) ---
 	// 충돌 법선 (Result.Normal) 방향으로 박스 B가 박스 A에 가장 깊이 파고든 정점으로 근사
@@ -349,6 +435,240 @@ FCollisionDetectionResult FCollisionDetector::BoxBoxSAT(
 	return Result;
 }
 
+namespace
+{
+	// 접촉점 절단용 꼭짓점 - 특징 번호를 함께 전달
+	struct FClipVertex
+	{
+		XMVECTOR Position;
+		uint32_t FeatureId;
+	};
+
+	constexpr int MAX_CLIP_VERTICES = 8;    // 사각형을 네 평면으로 자르면 최대 8개
+
+	// Sutherland-Hodgman - Dot(PlaneNormal, P) <= PlaneOffset 쪽만 남김
+	int ClipPolygon(const FClipVertex* InVertices, int InCount, const XMVECTOR& vPlaneNormal, float PlaneOffset,
+					uint32_t PlaneId, FClipVertex* OutVertices)
+	{
+		int OutCount = 0;
+		for (int i = 0; i < InCount && OutCount < MAX_CLIP_VERTICES; ++i)
+		{
+			const FClipVertex& A = InVertices[i];
+			const FClipVertex& B = InVertices[(i + 1) % InCount];
+			const float DistA = XMVectorGetX(XMVector3Dot(vPlaneNormal, A.Position)) - PlaneOffset;
+			const float DistB = XMVectorGetX(XMVector3Dot(vPlaneNormal, B.Position)) - PlaneOffset;
+
+			if (DistA <= 0.0f)
+			{
+				OutVertices[OutCount++] = A;
+			}
+			if ((DistA <= 0.0f) != (DistB <= 0.0f) && OutCount < MAX_CLIP_VERTICES)
+			{
+				// 잘린 점은 모서리 양 끝과 절단 평면으로 식별
+				FClipVertex& Clipped = OutVertices[OutCount++];
+				Clipped.Position = XMVectorLerp(A.Position, B.Position, DistA / (DistA - DistB));
+				Clipped.FeatureId = ((A.FeatureId * 0x9E3779B1u) ^ (B.FeatureId + (PlaneId + 1) * 0x85EBCA6Bu)) | 0x100u;
+			}
+		}
+		return OutCount;
+	}
+}
+
+void FCollisionDetector::BuildBoxFaceManifold(int Axis, const XMVECTOR& vNormal,
+											  const XMVECTOR& vPosA, const XMVECTOR* vAxesA, const float* ExtentsA,
+											  const XMVECTOR& vPosB, const XMVECTOR* vAxesB, const float* ExtentsB,
+											  FCollisionDetectionResult& OutResult)
+{
+	// 기준 면 - 분리축을 가진 박스의 면, 법선은 상대 박스 쪽
+	const bool bReferenceA = Axis < 3;
+	const int RefAxis = Axis % 3;
+	const XMVECTOR& vRefPos = bReferenceA ? vPosA : vPosB;
+	const XMVECTOR* vRefAxes = bReferenceA ? vAxesA : vAxesB;
+	const float* RefExtents = bReferenceA ? ExtentsA : ExtentsB;
+	const XMVECTOR& vIncPos = bReferenceA ? vPosB : vPosA;
+	const XMVECTOR* vIncAxes = bReferenceA ? vAxesB : vAxesA;
+	const float* IncExtents = bReferenceA ? ExtentsB : ExtentsA;
+
+	const XMVECTOR vRefNormal = bReferenceA ? vNormal : XMVectorNegate(vNormal);
+	const bool bRefPositive = XMVectorGetX(XMVector3Dot(vRefNormal, vRefAxes[RefAxis])) >= 0.0f;
+	const uint32_t RefFaceId = (bReferenceA ? 0u : 6u) + RefAxis * 2u + (bRefPositive ? 0u : 1u);
+	const float RefFaceOffset = XMVectorGetX(XMVector3Dot(vRefNormal, vRefPos)) + RefExtents[RefAxis];
+
+	// 대상 면 - 기준 법선과 가장 반대 방향인 상대 박스의 면
+	int IncAxis = 0;
+	float MaxAlignment = -1.0f;
+	for (int k = 0; k < 3; ++k)
+	{
+		const float Alignment = std::fabs(XMVectorGetX(XMVector3Dot(vIncAxes[k], vRefNormal)));
+		if (Alignment > MaxAlignment)
+		{
+			MaxAlignment = Alignment;
+			IncAxis = k;
+		}
+	}
+	const bool bIncPositive = XMVectorGetX(XMVector3Dot(vIncAxes[IncAxis], vRefNormal)) < 0.0f;
+	const XMVECTOR vIncNormal = bIncPositive ? vIncAxes[IncAxis] : XMVectorNegate(vIncAxes[IncAxis]);
+	const uint32_t IncFaceId = IncAxis * 2u + (bIncPositive ? 0u : 1u);
+
+	const XMVECTOR vIncCenter = XMVectorAdd(vIncPos, XMVectorScale(vIncNormal, IncExtents[IncAxis]));
+	const XMVECTOR vU = XMVectorScale(vIncAxes[(IncAxis + 1) % 3], IncExtents[(IncAxis + 1) % 3]);
+	const XMVECTOR vV = XMVectorScale(vIncAxes[(IncAxis + 2) % 3], IncExtents[(IncAxis + 2) % 3]);
+
+	FClipVertex Polygon[MAX_CLIP_VERTICES];
+	FClipVertex Clipped[MAX_CLIP_VERTICES];
+	Polygon[0] = { XMVectorAdd(vIncCenter, XMVectorAdd(vU, vV)), IncFaceId * 4u + 0u };
+	Polygon[1] = { XMVectorAdd(vIncCenter, XMVectorSubtract(vV, vU)), IncFaceId * 4u + 1u };
+	Polygon[2] = { XMVectorSubtract(vIncCenter, XMVectorAdd(vU, vV)), IncFaceId * 4u + 2u };
+	Polygon[3] = { XMVectorAdd(vIncCenter, XMVectorSubtract(vU, vV)), IncFaceId * 4u + 3u };
+	int Count = 4;
+
+	// 기준 면의 네 옆면으로 절단
+	for (int Side = 0; Side < 2 && Count > 0; ++Side)
+	{
+		const int SideAxis = (RefAxis + 1 + Side) % 3;
+		const XMVECTOR& vSideNormal = vRefAxes[SideAxis];
+		const float Center = XMVectorGetX(XMVector3Dot(vSideNormal, vRefPos));
+
+		Count = ClipPolygon(Polygon, Count, vSideNormal, Center + RefExtents[SideAxis], Side * 2u, Clipped);
+		Count = ClipPolygon(Clipped, Count, XMVectorNegate(vSideNormal), -Center + RefExtents[SideAxis], Side * 2u + 1u, Polygon);
+	}
+
+	// 기준 면 아래에 있는 점만 접촉점 - 두 표면의 중간 위치
+	Vector3 Positions[MAX_CLIP_VERTICES];
+	float Depths[MAX_CLIP_VERTICES];
+	uint32_t FeatureIds[MAX_CLIP_VERTICES];
+	int ContactCount = 0;
+	for (int i = 0; i < Count; ++i)
+	{
+		const float Depth = RefFaceOffset - XMVectorGetX(XMVector3Dot(vRefNormal, Polygon[i].Position));
+		if (Depth < 0.0f)
+			continue;
+
+		XMStoreFloat3(&Positions[ContactCount], XMVectorAdd(Polygon[i].Position, XMVectorScale(vRefNormal, Depth * 0.5f)));
+		Depths[ContactCount] = Depth;
+		FeatureIds[ContactCount] = (RefFaceId << 24) | (Polygon[i].FeatureId & 0x00FFFFFFu);
+		++ContactCount;
+	}
+
+	if (ContactCount <= static_cast<int>(FContactManifold::MAX_POINTS))
+	{
+		for (int i = 0; i < ContactCount; ++i)
+		{
+			OutResult.Manifold.AddPoint(Positions[i], Depths[i], FeatureIds[i]);
+		}
+		return;
+	}
+
+	// 4개로 축소 - 가장 깊은 점, 그로부터 가장 먼 점, 그 선분 양쪽으로 면적이 가장 큰 점
+	int Selected[4] = { 0, -1, -1, -1 };
+	for (int i = 1; i < ContactCount; ++i)
+	{
+		if (Depths[i] > Depths[Selected[0]])
+			Selected[0] = i;
+	}
+	const XMVECTOR vFirst = XMLoadFloat3(&Positions[Selected[0]]);
+	float MaxDistSq = -1.0f;
+	for (int i = 0; i < ContactCount; ++i)
+	{
+		const float DistSq = XMVectorGetX(XMVector3LengthSq(XMVectorSubtract(XMLoadFloat3(&Positions[i]), vFirst)));
+		if (i != Selected[0] && DistSq > MaxDistSq)
+		{
+			MaxDistSq = DistSq;
+			Selected[1] = i;
+		}
+	}
+	const XMVECTOR vLine = XMVectorSubtract(XMLoadFloat3(&Positions[Selected[1]]), vFirst);
+	float MaxArea = 0.0f;
+	float MinArea = 0.0f;
+	for (int i = 0; i < ContactCount; ++i)
+	{
+		if (i == Selected[0] || i == Selected[1])
+			continue;
+
+		const XMVECTOR vToPoint = XMVectorSubtract(XMLoadFloat3(&Positions[i]), vFirst);
+		const float Area = XMVectorGetX(XMVector3Dot(XMVector3Cross(vLine, vToPoint), vRefNormal));
+		if (Area > MaxArea)
+		{
+			MaxArea = Area;
+			Selected[2] = i;
+		}
+		if (Area < MinArea)
+		{
+			MinArea = Area;
+			Selected[3] = i;
+		}
+	}
+
+	for (int Index : Selected)
+	{
+		if (Index >= 0)
+		{
+			OutResult.Manifold.AddPoint(Positions[Index], Depths[Index], FeatureIds[Index]);
+		}
+	}
+}
+
+void FCollisionDetector::BuildBoxEdgeContact(int Axis, const XMVECTOR& vNormal,
+											 const XMVECTOR& vPosA, const XMVECTOR* vAxesA, const float* ExtentsA,
+											 const XMVECTOR& vPosB, const XMVECTOR* vAxesB, const float* ExtentsB,
+											 FCollisionDetectionResult& OutResult)
+{
+	// 모서리 축 = AxesA[EdgeA] x AxesB[EdgeB]
+	const int EdgeA = (Axis - 6) / 3;
+	const int EdgeB = (Axis - 6) % 3;
+
+	// 각 박스에서 상대 쪽으로 가장 튀어나온 평행 모서리 - 모서리 중점과 부호로 식별
+	uint32_t SignBits = 0;
+	XMVECTOR vCenterA = vPosA;
+	XMVECTOR vCenterB = vPosB;
+	for (int k = 0; k < 3; ++k)
+	{
+		if (k != EdgeA)
+		{
+			const bool bPositive = XMVectorGetX(XMVector3Dot(vNormal, vAxesA[k])) >= 0.0f;
+			vCenterA = XMVectorAdd(vCenterA, XMVectorScale(vAxesA[k], bPositive ? ExtentsA[k] : -ExtentsA[k]));
+			SignBits |= (bPositive ? 1u : 0u) << k;
+		}
+		if (k != EdgeB)
+		{
+			const bool bPositive = XMVectorGetX(XMVector3Dot(vNormal, vAxesB[k])) < 0.0f;
+			vCenterB = XMVectorAdd(vCenterB, XMVectorScale(vAxesB[k], bPositive ? ExtentsB[k] : -ExtentsB[k]));
+			SignBits |= (bPositive ? 1u : 0u) << (k + 3);
+		}
+	}
+
+	// 두 선분의 최근접점 (방향은 단위 벡터)
+	const XMVECTOR& vDirA = vAxesA[EdgeA];
+	const XMVECTOR& vDirB = vAxesB[EdgeB];
+	const XMVECTOR vOffset = XMVectorSubtract(vCenterA, vCenterB);
+	const float DirDot = XMVectorGetX(XMVector3Dot(vDirA, vDirB));
+	const float OffsetA = XMVectorGetX(XMVector3Dot(vDirA, vOffset));
+	const float OffsetB = XMVectorGetX(XMVector3Dot(vDirB, vOffset));
+	const float Denominator = 1.0f - DirDot * DirDot;
+
+	float ParamA = Denominator > KINDA_SMALL ? (DirDot * OffsetB - OffsetA) / Denominator : 0.0f;
+	ParamA = Math::Clamp(ParamA, -ExtentsA[EdgeA], ExtentsA[EdgeA]);
+	float ParamB = Math::Clamp(DirDot * ParamA + OffsetB, -ExtentsB[EdgeB], ExtentsB[EdgeB]);
+	ParamA = Math::Clamp(DirDot * ParamB - OffsetA, -ExtentsA[EdgeA], ExtentsA[EdgeA]);
+
+	const XMVECTOR vPointA = XMVectorAdd(vCenterA, XMVectorScale(vDirA, ParamA));
+	const XMVECTOR vPointB = XMVectorAdd(vCenterB, XMVectorScale(vDirB, ParamB));
+
+	Vector3 Position;
+	XMStoreFloat3(&Position, XMVectorScale(XMVectorAdd(vPointA, vPointB), 0.5f));
+	const uint32_t FeatureId = 0x80000000u | (static_cast<uint32_t>(Axis) << 8) | SignBits;
+	OutResult.Manifold.AddPoint(Position, OutResult.PenetrationDepth, FeatureId);
+}
+
+void FCollisionDetector::EnsureContactPoint(FCollisionDetectionResult& InOutResult)
+{
+	// 단일 점 검사(구, GJK/EPA 등) - 충돌 지점 하나를 접촉점으로 사용
+	if (InOutResult.Manifold.PointCount == 0)
+	{
+		InOutResult.Manifold.AddPoint(InOutResult.Point, InOutResult.PenetrationDepth, 0);
+	}
+}
+
 FCollisionDetectionResult FCollisionDetector::BoxSphereSimple(
 	const Vector3& BoxExtent, const FTransform& WorldBoxTransform,
 	float SphereRadius, const FTransform& WorldSphereTransform)
@@ -522,6 +842,9 @@ FAABB FCollisionDetector::CalculateWorldAABB(const ICollisionShape& InShape, con
 			}
 		}
 		break; 
+		case ECollisionShapeType::Count:
+		default:
+			break;
 	}
 
 	return worldAABB;
@@ -571,7 +894,7 @@ bool FCollisionDetector::GJKCollision(
 	XMVECTOR Direction = XMVectorSubtract(
 		XMLoadFloat3(&TransformB.Position),
 		XMLoadFloat3(&TransformA.Position));
-	if (XMVector3LengthSq(Direction).m128_f32[0] < KINDA_SMALL)
+	if (XMVectorGetX(XMVector3LengthSq(Direction)) < KINDA_SMALL)
 	{
 		Direction = XMVectorSet(0.0f, 1.0f, 0.0f, 0.0f); // 기본 방향
 	}
@@ -600,7 +923,7 @@ bool FCollisionDetector::GJKCollision(
 			ShapeA, TransformA, ShapeB, TransformB, Direction, SupportA, SupportB);
 
 		// 원점을 지나지 못하면 충돌 없음
-		if (XMVector3Dot(Point, Direction).m128_f32[0] < 0)
+		if (XMVectorGetX(XMVector3Dot(Point, Direction)) < 0)
 		{
 			return false;
 		}
@@ -634,8 +957,8 @@ XMVECTOR FCollisionDetector::ComputeMinkowskiSupport(
 	// ShapeA의 지원점 계산 (반대 방향)
 	XMVECTOR NegDirection = XMVectorNegate(Direction);
 
-	Vector3 NegDir = Vector3(NegDirection.m128_f32[0], NegDirection.m128_f32[1], NegDirection.m128_f32[2]);
-	Vector3 Dir = Vector3(Direction.m128_f32[0], Direction.m128_f32[1], Direction.m128_f32[2]);
+	Vector3 NegDir = Vector3(XMVectorGetX(NegDirection), XMVectorGetY(NegDirection), XMVectorGetZ(NegDirection));
+	Vector3 Dir = Vector3(XMVectorGetX(Direction), XMVectorGetY(Direction), XMVectorGetZ(Direction));
 	
 	//ShapeA의 지원점 게산
 	Vector3 SupportA = ShapeA.GetWorldSupportPoint(NegDir);
@@ -664,8 +987,8 @@ bool FCollisionDetector::UpdateSimplex(FSimplex& Simplex, XMVECTOR& Direction)
 			XMVECTOR AO = XMVectorNegate(A);
 
 			// 원점이 선분에 가장 가까운지 확인
-			float DotAB_AO = XMVector3Dot(AB, AO).m128_f32[0];
-			float DotAB_AB = XMVector3Dot(AB, AB).m128_f32[0];
+			float DotAB_AO = XMVectorGetX(XMVector3Dot(AB, AO));
+			float DotAB_AB = XMVectorGetX(XMVector3Dot(AB, AB));
 
 			if (DotAB_AO <= 0.0f)
 			{
@@ -689,7 +1012,7 @@ bool FCollisionDetector::UpdateSimplex(FSimplex& Simplex, XMVECTOR& Direction)
 			{
 				// 선분에 수직인 방향
 				Direction = XMVector3Cross(XMVector3Cross(AB, AO), AB);
-				if (XMVector3LengthSq(Direction).m128_f32[0] < KINDA_SMALL)
+				if (XMVectorGetX(XMVector3LengthSq(Direction)) < KINDA_SMALL)
 				{
 					Direction = XMVectorSet(0.0f, 1.0f, 0.0f, 0.0f);
 				}
@@ -710,7 +1033,7 @@ bool FCollisionDetector::UpdateSimplex(FSimplex& Simplex, XMVECTOR& Direction)
 			XMVECTOR ABC = XMVector3Cross(AB, AC);
 
 			// 법선 방향 확인
-			if (XMVector3Dot(XMVector3Cross(ABC, AC), AO).m128_f32[0] > 0.0f)
+			if (XMVectorGetX(XMVector3Dot(XMVector3Cross(ABC, AC), AO)) > 0.0f)
 			{
 				// AC 방향
 				Simplex.Points[0] = A;
@@ -721,14 +1044,14 @@ bool FCollisionDetector::UpdateSimplex(FSimplex& Simplex, XMVECTOR& Direction)
 				Simplex.SupportPointsB[1] = Simplex.SupportPointsB[2];
 				Simplex.Size = 2;
 				Direction = XMVector3Cross(XMVector3Cross(AC, AO), AC);
-				if (XMVector3LengthSq(Direction).m128_f32[0] < KINDA_SMALL)
+				if (XMVectorGetX(XMVector3LengthSq(Direction)) < KINDA_SMALL)
 				{
 					Direction = XMVectorSet(0.0f, 1.0f, 0.0f, 0.0f);
 				}
 				return false;
 			}
 
-			if (XMVector3Dot(XMVector3Cross(AB, ABC), AO).m128_f32[0] > 0.0f)
+			if (XMVectorGetX(XMVector3Dot(XMVector3Cross(AB, ABC), AO)) > 0.0f)
 			{
 				// AB 방향
 				Simplex.Points[0] = A;
@@ -739,7 +1062,7 @@ bool FCollisionDetector::UpdateSimplex(FSimplex& Simplex, XMVECTOR& Direction)
 				Simplex.SupportPointsB[1] = Simplex.SupportPointsB[1];
 				Simplex.Size = 2;
 				Direction = XMVector3Cross(XMVector3Cross(AB, AO), AB);
-				if (XMVector3LengthSq(Direction).m128_f32[0] < KINDA_SMALL)
+				if (XMVectorGetX(XMVector3LengthSq(Direction)) < KINDA_SMALL)
 				{
 					Direction = XMVectorSet(0.0f, 1.0f, 0.0f, 0.0f);
 				}
@@ -747,7 +1070,7 @@ bool FCollisionDetector::UpdateSimplex(FSimplex& Simplex, XMVECTOR& Direction)
 			}
 
 			// 삼각형 내부 또는 법선 방향
-			if (XMVector3Dot(ABC, AO).m128_f32[0] > 0.0f)
+			if (XMVectorGetX(XMVector3Dot(ABC, AO)) > 0.0f)
 			{
 				Direction = ABC;
 			}
@@ -783,14 +1106,14 @@ XMVECTOR FCollisionDetector::ClosestPointOnSegmentToOrigin(FXMVECTOR P1, FXMVECT
 	const XMVECTOR P1O = XMVectorSubtract(O, P1); // O - P1 = -P1
 
 	// Handle case where P1 == P2 (degenerate segment)
-	float lenSq = XMVector3LengthSq(P1P2).m128_f32[0];
+	float lenSq = XMVectorGetX(XMVector3LengthSq(P1P2));
 	if (lenSq < KINDA_SMALL)
 	{
 		return P1; // Return P1 if segment is a point
 	}
 
 	// Project P1O onto P1P2
-	float t = XMVector3Dot(P1O, P1P2).m128_f32[0] / lenSq;
+	float t = XMVectorGetX(XMVector3Dot(P1O, P1P2)) / lenSq;
 
 	// Clamp t to the range [0, 1] to find closest point on the segment
 	t = std::clamp(t, 0.0f, 1.0f);
@@ -817,9 +1140,9 @@ bool FCollisionDetector::GJKHandleTetrahedron(FSimplex& Simplex,XMVECTOR& Direct
 	XMVECTOR ACD = XMVector3Cross(AD, AC);
 
 	// 원점이 각 면의 외부인지 확인
-	bool OutsideABC = XMVector3Dot(ABC, AO).m128_f32[0] > 0.0f;
-	bool OutsideABD = XMVector3Dot(ABD, AO).m128_f32[0] > 0.0f;
-	bool OutsideACD = XMVector3Dot(ACD, AO).m128_f32[0] > 0.0f;
+	bool OutsideABC = XMVectorGetX(XMVector3Dot(ABC, AO)) > 0.0f;
+	bool OutsideABD = XMVectorGetX(XMVector3Dot(ABD, AO)) > 0.0f;
+	bool OutsideACD = XMVectorGetX(XMVector3Dot(ACD, AO)) > 0.0f;
 
 	if (OutsideABC)
 	{
@@ -1360,6 +1683,10 @@ void FCollisionDetector::DrawPolytope(const FCollisionDetector::PolytopeSOA& Pol
 {
 	using PolytopeSOA = FCollisionDetector::PolytopeSOA;
 
+#ifdef PHYSICS_HEADLESS
+	// 렌더러 없이 빌드된 경우 그리지 않음
+	return;
+#else
 	if (Polytope.Indices.empty() || Polytope.Vertices.empty())
 		return;
 
@@ -1440,5 +1767,6 @@ void FCollisionDetector::DrawPolytope(const FCollisionDetector::PolytopeSOA& Pol
 			DebugDrawer->DrawLine(Start, End, NormalColor, 0.001f, LifeTime);
 		}
 	}
+#endif
 }
 #pragma endregion
\ No newline at end of file
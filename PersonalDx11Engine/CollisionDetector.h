@@ -3,6 +3,8 @@
 #include "Transform.h"
 #include "CollisionDefines.h"
 #include "CollisionShapeInterface.h"
+#include <array>
+#include <utility>
 
 using namespace DirectX;
 
@@ -68,7 +70,7 @@ public:
         const float DeltaTime);
 
 public:
-    // 형상 기반 이산 충돌 검사 (기존 유지)
+    // 형상 기반 이산 충돌 검사 - (A, B) 형상 타입으로 검사 표에서 바로 선택
     FCollisionDetectionResult DetectCollisionShapeBasedDiscrete(
         const ICollisionShape& ShapeA,
         const FTransform& WorldTransformA,
@@ -159,11 +161,51 @@ private:
         float RadiusA, const FTransform& WorldTransformA,
         float RadiusB, const FTransform& WorldTransformB);
 
+    // Box-Box 접촉 다양체 - 면 축이면 기준 면으로 대상 면을 잘라 최대 4점 (특징 번호 포함)
+    void BuildBoxFaceManifold(int Axis, const XMVECTOR& vNormal,
+                              const XMVECTOR& vPosA, const XMVECTOR* vAxesA, const float* ExtentsA,
+                              const XMVECTOR& vPosB, const XMVECTOR* vAxesB, const float* ExtentsB,
+                              FCollisionDetectionResult& OutResult);
+    // Box-Box 모서리 축 - 두 모서리의 최근접점 하나
+    void BuildBoxEdgeContact(int Axis, const XMVECTOR& vNormal,
+                             const XMVECTOR& vPosA, const XMVECTOR* vAxesA, const float* ExtentsA,
+                             const XMVECTOR& vPosB, const XMVECTOR* vAxesB, const float* ExtentsB,
+                             FCollisionDetectionResult& OutResult);
+    // 접촉점이 없는 충돌 결과에 충돌 지점을 접촉점으로 추가
+    static void EnsureContactPoint(FCollisionDetectionResult& InOutResult);
+
     // Box-Sphere 충돌 검사
     FCollisionDetectionResult BoxSphereSimple(
         const Vector3& BoxExtent, const FTransform& WorldTransformA,
         float SphereRadius, const FTransform& SphereTransform);
 #pragma endregion
+#pragma region Shape-Pair Dispatch
+private:
+    using FShapePairKernel = FCollisionDetectionResult(*)(FCollisionDetector& Detector,
+                                                          const ICollisionShape& ShapeA, const FTransform& WorldTransformA,
+                                                          const ICollisionShape& ShapeB, const FTransform& WorldTransformB);
+
+    static constexpr size_t SHAPE_TYPE_COUNT = static_cast<size_t>(ECollisionShapeType::Count);
+
+    // 형상 쌍 검사 - 기본은 충돌 없음, 지원하는 조합만 특수화 (CollisionDetector.cpp)
+    template<ECollisionShapeType TypeA, ECollisionShapeType TypeB>
+    static FCollisionDetectionResult DetectShapePair(FCollisionDetector&,
+                                                     const ICollisionShape&, const FTransform&,
+                                                     const ICollisionShape&, const FTransform&)
+    {
+        return FCollisionDetectionResult();
+    }
+
+    // 검사 표 - [A 타입 * SHAPE_TYPE_COUNT + B 타입], 컴파일 시간에 모든 조합으로 채움
+    template<size_t... PairIndex>
+    static constexpr std::array<FShapePairKernel, sizeof...(PairIndex)> MakeShapePairKernels(std::index_sequence<PairIndex...>)
+    {
+        return { { &DetectShapePair<static_cast<ECollisionShapeType>(PairIndex / SHAPE_TYPE_COUNT),
+                                    static_cast<ECollisionShapeType>(PairIndex % SHAPE_TYPE_COUNT)>... } };
+    }
+
+    static const std::array<FShapePairKernel, SHAPE_TYPE_COUNT * SHAPE_TYPE_COUNT> ShapePairKernels;
+#pragma endregion
 #pragma region Shape_Based SweptVolume
 private:
     FAABB CalculateSweptAABB(const ICollisionShape& InShape, const FTransform& PrevTransform, 
@@ -1,5 +1,6 @@
 #include "CollisionEventDispatcher.h"
 #include "CollisionComponent.h"
+#include "CollisionPairCache.h"
 
 void FCollisionEventDispatcher::DispatchCollisionEvents(const std::shared_ptr<UCollisionComponentBase>& InComponent, const FCollisionEventData& EventData, const ECollisionState& CollisionState)
 {
@@ -37,3 +38,63 @@ void FCollisionEventDispatcher::DispatchCollisionEvents(const UCollisionComponen
             break;
     }
 }
+
+void FCollisionEventDispatcher::RecordContact(const FCollisionPair& InPair, const std::shared_ptr<UCollisionComponentBase>& InCompA, const std::shared_ptr<UCollisionComponentBase>& InCompB, const FCollisionDetectionResult& DetectResult, const ECollisionState CollisionState)
+{
+    if (CollisionState == ECollisionState::None)
+    {
+        return;
+    }
+
+    // 서브스텝마다 반복되는 Stay는 직전 Enter/Stay 보고에 합쳐 마지막 결과만 유지
+    if (CollisionState == ECollisionState::Stay && InPair.ReportFrame == ReportFrame)
+    {
+        FCollisionContactReport& LastReport = ContactReports[InPair.ReportIndex];
+        if (LastReport.State == ECollisionState::Enter || LastReport.State == ECollisionState::Stay)
+        {
+            LastReport.DetectResult = DetectResult;
+            ++LastReport.SubstepCount;
+            return;
+        }
+    }
+
+    InPair.ReportIndex = static_cast<uint32_t>(ContactReports.size());
+    InPair.ReportFrame = ReportFrame;
+
+    FCollisionContactReport& Report = ContactReports.emplace_back();
+    Report.ComponentA = InCompA;
+    Report.ComponentB = InCompB;
+    Report.DetectResult = DetectResult;
+    Report.State = CollisionState;
+}
+
+void FCollisionEventDispatcher::ClearContactReports()
+{
+    ContactReports.clear();
+    // 0은 보고가 없는 쌍의 기본값이므로 건너뜀
+    if (++ReportFrame == 0)
+    {
+        ReportFrame = 1;
+    }
+}
+
+void FCollisionEventDispatcher::DispatchContactReports()
+{
+    FCollisionEventData EventData;
+    for (size_t i = 0; i < ContactReports.size(); ++i)
+    {
+        const FCollisionContactReport& Report = ContactReports[i];
+        auto CompA = Report.ComponentA.lock();
+        auto CompB = Report.ComponentB.lock();
+        if (!CompA || !CompB)
+        {
+            continue;
+        }
+
+        EventData.CollisionDetectResult = Report.DetectResult;
+        EventData.OtherComponent = CompB;
+        DispatchCollisionEvents(CompA, EventData, Report.State);
+        EventData.OtherComponent = CompA;
+        DispatchCollisionEvents(CompB, EventData, Report.State);
+    }
+}
@@ -4,7 +4,13 @@
 #include "CollisionDefines.h"
 
 class UCollisionComponentBase;
+struct FCollisionPair;
 
+/// <summary>
+/// 충돌 이벤트 전달 - 서브스텝에서는 접촉 보고 버퍼에 기록만 하고
+/// 프레임 끝 DispatchContactReports에서 델리게이트를 한 번에 전달
+/// 버퍼는 프레임마다 비우지만 용량은 유지하므로 한 번 커진 뒤에는 할당하지 않음
+/// </summary>
 class FCollisionEventDispatcher
 {
     friend class FCollisionProcessor;
@@ -18,10 +24,28 @@ public:
         const std::shared_ptr<UCollisionComponentBase>& InComponent,
         const FCollisionEventData& EventData,
         const ECollisionState& CollisionState);
+
+    // 접촉 보고 기록 - 이번 프레임 같은 쌍의 마지막 보고가 Enter/Stay면 Stay는 그 보고에 합침
+    void RecordContact(
+        const FCollisionPair& InPair,
+        const std::shared_ptr<UCollisionComponentBase>& InCompA,
+        const std::shared_ptr<UCollisionComponentBase>& InCompB,
+        const FCollisionDetectionResult& DetectResult,
+        const ECollisionState CollisionState);
+
+    // 이번 프레임 접촉 보고 - 기록 순서 유지, 다음 ClearContactReports까지 유효
+    const std::vector<FCollisionContactReport>& GetContactReports() const { return ContactReports; }
+    // 새 프레임 시작 - 보고를 비우고 쌍에 남은 보고 위치를 무효화
+    void ClearContactReports();
+    // 보고 순서대로 양쪽 컴포넌트에 델리게이트 전달
+    void DispatchContactReports();
+
 private:
     void DispatchCollisionEvents(
         const UCollisionComponentBase* InComponent,
         const FCollisionEventData& EventData,
         const ECollisionState& CollisionState);
 
-};
\ No newline at end of file
+    std::vector<FCollisionContactReport> ContactReports;
+    uint32_t ReportFrame = 1;       // 쌍의 ReportFrame 기본값(0)과 겹치지 않도록 1부터 시작
+};
@@ -0,0 +1,242 @@
+#include "CollisionPairCache.h"
+#include <algorithm>
+#include <functional>
+
+namespace
+{
+    constexpr size_t MIN_SLOT_COUNT = 16;
+
+    size_t RoundUpSlotCount(size_t InPairCapacity)
+    {
+        size_t SlotCount = MIN_SLOT_COUNT;
+        while (SlotCount < InPairCapacity * 2)
+        {
+            SlotCount <<= 1;
+        }
+        return SlotCount;
+    }
+}
+
+void FCollisionPairCache::Reserve(size_t InCapacity)
+{
+    Pairs.reserve(InCapacity);
+    const size_t SlotCount = RoundUpSlotCount(InCapacity);
+    if (SlotCount > Slots.size())
+    {
+        Rehash(SlotCount);
+    }
+}
+
+void FCollisionPairCache::Clear()
+{
+    std::fill(Slots.begin(), Slots.end(), FSlot());
+    Pairs.clear();
+    for (std::vector<size_t>& Partners : Adjacency)
+    {
+        Partners.clear();
+    }
+    PendingIndices.clear();
+}
+
+std::pair<FCollisionPair*, bool> FCollisionPairCache::FindOrAdd(size_t InIdA, size_t InIdB)
+{
+    const uint64_t Key = MakeKey(InIdA, InIdB);
+    if (!Slots.empty())
+    {
+        const size_t Slot = FindSlot(Key);
+        if (Slots[Slot].DenseIndex != EMPTY_SLOT)
+        {
+            return { &Pairs[Slots[Slot].DenseIndex], false };
+        }
+    }
+
+    // 제거 표시된 쌍도 밀집 배열을 차지하므로 포함해서 부하율 판정
+    if ((Pairs.size() + 1) * 2 > Slots.size())
+    {
+        Rehash(RoundUpSlotCount(Pairs.size() + 1));
+    }
+
+    const size_t Slot = FindSlot(Key);
+    Slots[Slot].Key = Key;
+    Slots[Slot].DenseIndex = static_cast<uint32_t>(Pairs.size());
+    Pairs.emplace_back(InIdA, InIdB);
+    LinkPair(InIdA, InIdB);
+    return { &Pairs.back(), true };
+}
+
+FCollisionPair* FCollisionPairCache::Find(size_t InIdA, size_t InIdB)
+{
+    if (Slots.empty())
+        return nullptr;
+
+    const size_t Slot = FindSlot(MakeKey(InIdA, InIdB));
+    return Slots[Slot].DenseIndex != EMPTY_SLOT ? &Pairs[Slots[Slot].DenseIndex] : nullptr;
+}
+
+bool FCollisionPairCache::Remove(size_t InIdA, size_t InIdB)
+{
+    if (Slots.empty())
+        return false;
+
+    const size_t Slot = FindSlot(MakeKey(InIdA, InIdB));
+    if (Slots[Slot].DenseIndex == EMPTY_SLOT)
+        return false;
+
+    const size_t DenseIndex = Slots[Slot].DenseIndex;
+    RemoveAt(DenseIndex);
+    if (!bLocked)
+    {
+        Compact();
+    }
+    return true;
+}
+
+void FCollisionPairCache::Unlock()
+{
+    bLocked = false;
+    Compact();
+}
+
+size_t FCollisionPairCache::FindSlot(uint64_t InKey) const
+{
+    // 선형 탐사 - 같은 키 또는 빈 칸에서 멈춤 (부하율 1/2 이하이므로 빈 칸이 항상 존재)
+    size_t Slot = static_cast<size_t>(MixKey(InKey)) & SlotMask;
+    while (Slots[Slot].DenseIndex != EMPTY_SLOT && Slots[Slot].Key != InKey)
+    {
+        Slot = (Slot + 1) & SlotMask;
+    }
+    return Slot;
+}
+
+void FCollisionPairCache::EraseSlot(size_t InSlot)
+{
+    // 뒤쪽 이동 삭제 - 묘비 없이 탐사 사슬 유지
+    size_t Hole = InSlot;
+    size_t Next = (Hole + 1) & SlotMask;
+    while (Slots[Next].DenseIndex != EMPTY_SLOT)
+    {
+        const size_t Home = static_cast<size_t>(MixKey(Slots[Next].Key)) & SlotMask;
+        // Home이 (Hole, Next] 구간 밖이면 Hole로 당겨도 탐사 가능
+        const bool bInRange = Hole <= Next ? (Hole < Home && Home <= Next) : (Hole < Home || Home <= Next);
+        if (!bInRange)
+        {
+            Slots[Hole] = Slots[Next];
+            Hole = Next;
+        }
+        Next = (Next + 1) & SlotMask;
+    }
+    Slots[Hole] = FSlot();
+}
+
+void FCollisionPairCache::Rehash(size_t InSlotCount)
+{
+    Slots.assign(InSlotCount, FSlot());
+    SlotMask = InSlotCount - 1;
+
+    for (size_t i = 0; i < Pairs.size(); ++i)
+    {
+        if (Pairs[i].bRemoved)
+            continue;
+
+        const uint64_t Key = MakeKey(Pairs[i].TreeIdA, Pairs[i].TreeIdB);
+        const size_t Slot = FindSlot(Key);
+        Slots[Slot].Key = Key;
+        Slots[Slot].DenseIndex = static_cast<uint32_t>(i);
+    }
+}
+
+void FCollisionPairCache::RemoveAt(size_t InDenseIndex)
+{
+    FCollisionPair& Pair = Pairs[InDenseIndex];
+    if (Pair.bRemoved)
+        return;
+
+    // 키는 바로 제거 - 같은 쌍을 다시 추가하면 새 항목이 됨
+    EraseSlot(FindSlot(MakeKey(Pair.TreeIdA, Pair.TreeIdB)));
+    UnlinkPair(Pair.TreeIdA, Pair.TreeIdB);
+    Pair.bRemoved = true;
+    PendingIndices.push_back(static_cast<uint32_t>(InDenseIndex));
+}
+
+void FCollisionPairCache::SwapRemoveAt(size_t InDenseIndex)
+{
+    const FCollisionPair& Pair = Pairs[InDenseIndex];
+    EraseSlot(FindSlot(MakeKey(Pair.TreeIdA, Pair.TreeIdB)));
+    UnlinkPair(Pair.TreeIdA, Pair.TreeIdB);
+
+    const size_t LastIndex = Pairs.size() - 1;
+    if (InDenseIndex != LastIndex)
+    {
+        Pairs[InDenseIndex] = Pairs[LastIndex];
+        Slots[FindSlot(MakeKey(Pairs[InDenseIndex].TreeIdA, Pairs[InDenseIndex].TreeIdB))].DenseIndex = static_cast<uint32_t>(InDenseIndex);
+    }
+    Pairs.pop_back();
+}
+
+void FCollisionPairCache::Compact()
+{
+    if (PendingIndices.empty())
+        return;
+
+    // 순서를 유지하며 표시된 쌍 제거 후 옮겨진 쌍의 위치 갱신
+    size_t Write = 0;
+    for (size_t Read = 0; Read < Pairs.size(); ++Read)
+    {
+        if (Pairs[Read].bRemoved)
+            continue;
+
+        if (Write != Read)
+        {
+            Pairs[Write] = Pairs[Read];
+            Slots[FindSlot(MakeKey(Pairs[Write].TreeIdA, Pairs[Write].TreeIdB))].DenseIndex = static_cast<uint32_t>(Write);
+        }
+        ++Write;
+    }
+    Pairs.erase(Pairs.begin() + Write, Pairs.end());
+    PendingIndices.clear();
+}
+
+void FCollisionPairCache::SwapCompact()
+{
+    // 큰 위치부터 정리 - 그보다 뒤의 표시된 쌍은 이미 빠졌으므로 마지막 쌍은 자기 자신이거나 유효한 쌍
+    std::sort(PendingIndices.begin(), PendingIndices.end(), std::greater<uint32_t>());
+    for (uint32_t DenseIndex : PendingIndices)
+    {
+        const size_t LastIndex = Pairs.size() - 1;
+        if (DenseIndex != LastIndex)
+        {
+            Pairs[DenseIndex] = Pairs[LastIndex];
+            Slots[FindSlot(MakeKey(Pairs[DenseIndex].TreeIdA, Pairs[DenseIndex].TreeIdB))].DenseIndex = DenseIndex;
+        }
+        Pairs.pop_back();
+    }
+    PendingIndices.clear();
+}
+
+void FCollisionPairCache::LinkPair(size_t InIdA, size_t InIdB)
+{
+    const size_t MaxId = InIdA < InIdB ? InIdB : InIdA;
+    if (MaxId >= Adjacency.size())
+    {
+        Adjacency.resize(MaxId + 1);
+    }
+    Adjacency[InIdA].push_back(InIdB);
+    Adjacency[InIdB].push_back(InIdA);
+}
+
+void FCollisionPairCache::UnlinkPair(size_t InIdA, size_t InIdB)
+{
+    RemovePartner(Adjacency[InIdA], InIdB);
+    RemovePartner(Adjacency[InIdB], InIdA);
+}
+
+void FCollisionPairCache::RemovePartner(std::vector<size_t>& InPartners, size_t InPartner)
+{
+    // 상대 순서는 의미 없으므로 마지막 원소로 덮어씀
+    auto It = std::find(InPartners.begin(), InPartners.end(), InPartner);
+    if (It != InPartners.end())
+    {
+        *It = InPartners.back();
+        InPartners.pop_back();
+    }
+}
@@ -0,0 +1,224 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include "CollisionDefines.h"
+
+#pragma region CollisionPair
+struct FCollisionPair
+{
+    FCollisionPair(size_t InIdA, size_t InIdB)
+        : TreeIdA(InIdA < InIdB ? InIdA : InIdB)
+        , TreeIdB(InIdA < InIdB ? InIdB : InIdA)
+        , bPrevCollided(false)
+        , bConverged(false)
+        , bRemoved(false)
+    {
+    }
+    FCollisionPair& operator=(const FCollisionPair& Other) = default;
+
+    size_t TreeIdA;
+    size_t TreeIdB;
+
+    mutable FContactManifold Manifold;      // 지난 검사의 접촉점과 누적 충격량 - 특징 번호로 이어받음
+    mutable bool bPrevCollided : 1;
+    mutable bool bConverged : 1;
+    //mutable bool bStepSimulateFinished : 1;
+    bool bRemoved : 1;      // 잠금 중 제거됨 - 잠금 해제 시 정리
+
+    // 이번 프레임 마지막 접촉 보고 위치 - ReportFrame이 현재 프레임일 때만 유효
+    mutable uint32_t ReportIndex = UINT32_MAX;
+    mutable uint32_t ReportFrame = 0;
+
+    bool operator==(const FCollisionPair& Other) const
+    {
+        return TreeIdA == Other.TreeIdA && TreeIdB == Other.TreeIdB;
+    }
+};
+#pragma endregion
+
+/// <summary>
+/// 충돌쌍 캐시 (open addressing)
+/// 두 트리 노드 번호를 64비트 키로 묶어 선형 탐사 해시에 밀집 배열 위치를 보관
+/// 충돌쌍은 밀집 배열에 연속으로 저장되어 좁은 단계/해결 단계에서 그대로 순회함
+/// 저장 공간은 비워도 유지 - 프레임마다 할당하지 않음
+/// 잠금 중 제거된 쌍은 bRemoved로 표시만 하고 잠금 해제 시 정리 (순회 중인 포인터 유지)
+/// 노드마다 상대 노드 목록(인접 목록)을 유지해 한 노드의 쌍을 전체 순회 없이 제거
+/// </summary>
+class FCollisionPairCache
+{
+public:
+    // 노드 순서와 무관한 쌍 키
+    static uint64_t MakeKey(size_t InIdA, size_t InIdB)
+    {
+        const uint64_t Low = static_cast<uint64_t>(InIdA < InIdB ? InIdA : InIdB);
+        const uint64_t High = static_cast<uint64_t>(InIdA < InIdB ? InIdB : InIdA);
+        return (Low << 32) | (High & 0xFFFFFFFFull);
+    }
+
+    void Reserve(size_t InCapacity);
+    // 쌍만 비우고 저장 공간은 유지
+    void Clear();
+
+    // 없으면 추가 - (쌍, 새로 추가됐는지) 반환, 기존 쌍의 누적 상태는 유지
+    // 추가 시 밀집 배열이 재할당될 수 있으므로 이전에 얻은 포인터는 무효
+    std::pair<FCollisionPair*, bool> FindOrAdd(size_t InIdA, size_t InIdB);
+    FCollisionPair* Find(size_t InIdA, size_t InIdB);
+    bool Remove(size_t InIdA, size_t InIdB);
+
+    // 조건을 만족하는 쌍 제거 - 조건 함수 안에서의 제거(이벤트 등)도 안전
+    template<typename Pred>
+    size_t RemoveIf(Pred&& InPred)
+    {
+        const bool bWasLocked = bLocked;
+        bLocked = true;
+        size_t Removed = 0;
+        for (size_t i = 0; i < Pairs.size(); ++i)
+        {
+            if (!Pairs[i].bRemoved && InPred(static_cast<const FCollisionPair&>(Pairs[i])))
+            {
+                RemoveAt(i);
+                ++Removed;
+            }
+        }
+        bLocked = bWasLocked;
+        if (!bLocked)
+        {
+            Compact();
+        }
+        return Removed;
+    }
+
+    /// <summary>
+    /// 한 노드가 포함된 쌍 중 조건을 만족하는 쌍 제거 - 비용은 그 노드의 쌍 수에 비례
+    /// 조건 함수 안에서의 제거(이벤트 등)도 안전
+    /// 잠금 중이 아니면 빈 자리를 마지막 쌍으로 채워 정리하므로 밀집 배열 순서가 바뀜
+    /// </summary>
+    template<typename Pred>
+    size_t RemoveIfOf(size_t InId, Pred&& InPred)
+    {
+        if (InId >= Adjacency.size())
+            return 0;
+
+        const bool bWasLocked = bLocked;
+        bLocked = true;
+        size_t Removed = 0;
+        // 뒤에서부터 순회 - 제거된 상대 자리는 이미 본 마지막 상대로 채워짐
+        // 조건 함수 안에서 추가/제거되면 목록이 바뀌므로 매번 다시 참조
+        for (size_t k = Adjacency[InId].size(); k-- > 0;)
+        {
+            if (k >= Adjacency[InId].size())
+                continue;
+
+            const size_t Slot = FindSlot(MakeKey(InId, Adjacency[InId][k]));
+            const size_t DenseIndex = Slots[Slot].DenseIndex;
+            if (InPred(static_cast<const FCollisionPair&>(Pairs[DenseIndex])))
+            {
+                RemoveAt(DenseIndex);
+                ++Removed;
+            }
+        }
+        bLocked = bWasLocked;
+        if (!bLocked)
+        {
+            SwapCompact();
+        }
+        return Removed;
+    }
+
+    /// <summary>
+    /// 한 노드가 포함된 쌍 모두 제거 - 제거 직전 쌍마다 InOnRemove 호출, 비용은 그 노드의 쌍 수에 비례
+    /// 잠금 중이 아니면 마지막 쌍을 빈 자리로 옮겨 정리하므로 밀집 배열 순서가 바뀜
+    /// InOnRemove 안에서는 캐시를 변경하지 않아야 함
+    /// </summary>
+    template<typename Func>
+    size_t RemoveAllOf(size_t InId, Func&& InOnRemove)
+    {
+        if (InId >= Adjacency.size())
+            return 0;
+
+        size_t Removed = 0;
+        std::vector<size_t>& Partners = Adjacency[InId];
+        // 제거할 때마다 인접 목록에서 빠지므로 빌 때까지 반복
+        while (!Partners.empty())
+        {
+            const size_t Slot = FindSlot(MakeKey(InId, Partners.back()));
+            const size_t DenseIndex = Slots[Slot].DenseIndex;
+            InOnRemove(static_cast<const FCollisionPair&>(Pairs[DenseIndex]));
+            if (bLocked)
+            {
+                RemoveAt(DenseIndex);
+            }
+            else
+            {
+                SwapRemoveAt(DenseIndex);
+            }
+            ++Removed;
+        }
+        return Removed;
+    }
+
+    // 노드가 포함된 쌍 수
+    size_t GetPairCountOf(size_t InId) const { return InId < Adjacency.size() ? Adjacency[InId].size() : 0; }
+
+    // 시뮬레이션 동안 밀집 배열 위치 고정 - 제거는 표시로 대체
+    void Lock() { bLocked = true; }
+    // 잠금 중 제거된 쌍 정리 - 남은 쌍의 순서는 유지
+    void Unlock();
+    bool IsLocked() const { return bLocked; }
+
+    // 실제 쌍 수
+    size_t GetCount() const { return Pairs.size() - PendingIndices.size(); }
+    // 밀집 배열 크기 - 잠금 중에는 제거 표시된 쌍이 포함될 수 있음
+    size_t GetDenseCount() const { return Pairs.size(); }
+    bool IsEmpty() const { return GetCount() == 0; }
+
+    // 밀집 배열 순회 - 잠금 중이면 bRemoved 확인 필요
+    FCollisionPair* begin() { return Pairs.data(); }
+    FCollisionPair* end() { return Pairs.data() + Pairs.size(); }
+    const FCollisionPair* begin() const { return Pairs.data(); }
+    const FCollisionPair* end() const { return Pairs.data() + Pairs.size(); }
+
+private:
+    static constexpr uint32_t EMPTY_SLOT = static_cast<uint32_t>(-1);
+
+    struct FSlot
+    {
+        uint64_t Key = 0;
+        uint32_t DenseIndex = EMPTY_SLOT;
+    };
+
+    // splitmix64 최종 혼합 - 연속된 노드 번호도 고르게 분산
+    static uint64_t MixKey(uint64_t InKey)
+    {
+        InKey ^= InKey >> 30;
+        InKey *= 0xBF58476D1CE4E5B9ull;
+        InKey ^= InKey >> 27;
+        InKey *= 0x94D049BB133111EBull;
+        InKey ^= InKey >> 31;
+        return InKey;
+    }
+
+    size_t FindSlot(uint64_t InKey) const;
+    void EraseSlot(size_t InSlot);
+    void Rehash(size_t InSlotCount);
+    void RemoveAt(size_t InDenseIndex);
+    // 잠금 중이 아닐 때 즉시 제거 - 마지막 쌍을 빈 자리로 옮김
+    void SwapRemoveAt(size_t InDenseIndex);
+    void Compact();
+    // 표시된 쌍만 마지막 쌍으로 채워 정리 - 비용은 제거된 쌍 수에 비례
+    void SwapCompact();
+
+    void LinkPair(size_t InIdA, size_t InIdB);
+    void UnlinkPair(size_t InIdA, size_t InIdB);
+    static void RemovePartner(std::vector<size_t>& InPartners, size_t InPartner);
+
+private:
+    std::vector<FSlot> Slots;               // 크기는 2의 거듭제곱, 부하율 1/2 이하
+    std::vector<FCollisionPair> Pairs;      // 밀집 배열
+    std::vector<std::vector<size_t>> Adjacency;     // 노드 -> 쌍을 이룬 상대 노드 (제거 표시된 쌍 제외)
+    size_t SlotMask = 0;
+    std::vector<uint32_t> PendingIndices;   // 제거 표시된 쌍의 밀집 배열 위치
+    bool bLocked = false;
+};
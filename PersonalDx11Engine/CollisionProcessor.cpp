@@ -11,13 +11,37 @@
 #include "ConfigReadManager.h"
 #include "PhysicsStateInternalInterface.h"
 #include "PhysicsDefine.h"
+#include "RigidBodyComponent.h"
+#include "PhysicsSnapshot.h"
+#include "PhysicsWorkerPool.h"
+#include <numeric>
+#include <cfloat>
+
+namespace
+{
+	// 접촉 위치 보정 속도 편향 - 보정 비율과 허용 침투 (미터 단위)
+	constexpr float ContactBiasFactor = 0.2f;
+	constexpr float ContactSlop = 0.01f;
+}
 
 void FCollisionProcessor::LoadConfigFromIni()
 {
 	UConfigReadManager::Get()->GetValue("CCDVelocityThreshold", CCDVelocityThreshold);
 	UConfigReadManager::Get()->GetValue("InitialCollisionCapacity", InitialCollisonCapacity);
 	UConfigReadManager::Get()->GetValue("MaxConstraintIterations", MaxConstraintIterations);
+	UConfigReadManager::Get()->GetValue("WarmStartFactor", WarmStartFactor);
+	UConfigReadManager::Get()->GetValue("MinSubStepTickTime", MinSolveTime);
 	UConfigReadManager::Get()->GetValue("FatBoundsExtentRatio", FatBoundsExtentRatio);
+	UConfigReadManager::Get()->GetValue("bEnableSleeping", bEnableSleeping);
+	UConfigReadManager::Get()->GetValue("SleepLinearVelocityThreshold", SleepLinearVelocityThreshold);
+	UConfigReadManager::Get()->GetValue("SleepAngularVelocityThreshold", SleepAngularVelocityThreshold);
+	UConfigReadManager::Get()->GetValue("TimeToSleep", TimeToSleep);
+	UConfigReadManager::Get()->GetValue("NarrowphaseChunkSize", NarrowphaseChunkSize);
+	UConfigReadManager::Get()->GetValue("NarrowphaseMinPairs", NarrowphaseMinPairs);
+	UConfigReadManager::Get()->GetValue("SolverChunkSize", SolverChunkSize);
+	UConfigReadManager::Get()->GetValue("SolverMinBatchPairs", SolverMinBatchPairs);
+	UConfigReadManager::Get()->GetValue("bUseContactBatchSolver", bUseContactBatchSolver);
+	UConfigReadManager::Get()->GetValue("bUseContactManifold", bUseContactManifold);
 }
 
 FCollisionProcessor::~FCollisionProcessor()
@@ -37,6 +61,14 @@ void FCollisionProcessor::RegisterCollision(std::shared_ptr<UCollisionComponentB
 
 	// 맵에 추가
 	RegisteredComponents[TreeNodeId] = NewComponent; 
+	// 소멸 후 정리되지 않은 컴포넌트와 주소가 같으면 새 노드로 덮어씀
+	ComponentTreeIds[NewComponent.get()] = TreeNodeId;
+	if (TreeNodeId >= TreeComponents.size())
+	{
+		TreeComponents.resize(TreeNodeId + 1, nullptr);
+	}
+	TreeComponents[TreeNodeId] = NewComponent.get();
+	++LayoutVersion;
 }
 
 void FCollisionProcessor::UnRegisterCollision(std::shared_ptr<UCollisionComponentBase>& InComponent)
@@ -44,55 +76,105 @@ void FCollisionProcessor::UnRegisterCollision(std::shared_ptr<UCollisionComponen
 	if (!InComponent || !CollisionTree)
 		return;
 
-	UCollisionComponentBase* targetPtr = InComponent.get();
-
 	// 관리 중인 컴포넌트인지 확인
-	auto targetIt = std::find_if(RegisteredComponents.begin(), RegisteredComponents.end(),
-								 [targetPtr](const auto& RegisteredPair) {
-									 return targetPtr == RegisteredPair.second.lock().get();
-								 });
-
-	if (targetIt == RegisteredComponents.end())
+	const size_t unregisteredId = FindTreeId(InComponent.get());
+	if (unregisteredId == FDynamicAABBTree::NULL_NODE)
 	{
 		LOG("[WARNING] Attempt to unregister collision component that is not registered");
 		return;
 	}
 
-	// 트리 노드 ID 저장
-	size_t unregisteredId = targetIt->first;
-
 	try {
-		// 충돌 쌍에서 해당 컴포넌트 관련 항목 제거
-		auto it = ActiveCollisionPairs.begin();
-		while (it != ActiveCollisionPairs.end())
-		{
-			const FCollisionPair& Pair = *it;
-			if (Pair.TreeIdA == unregisteredId || Pair.TreeIdB == unregisteredId)
-				it = ActiveCollisionPairs.erase(it);
-			else
-				++it;
-		}
+		// 지역 서브스텝 쌍은 밀집 배열 원소를 가리키므로 먼저 비움 - 남은 지역 서브스텝은 충돌 검사 없이 진행
+		LocalSubstepPairs.clear();
 
-		// AABB 트리에서 제거
-		CollisionTree->Remove(unregisteredId);
-
-		// RegisteredComponents에서 제거
-		RegisteredComponents.erase(targetIt);
+		// 충돌 쌍, AABB 트리, 등록 목록에서 제거 - 시뮬레이션 중(이벤트 콜백)이면 쌍은 표시만 하고 잠금 해제 시 정리
+		RemoveCollisionNode(unregisteredId);
 	}
 	catch (const std::exception& e) {
 		LOG("[ERROR] Exception during collision unregistration: %s", e.what());
 	}
 }
 
-float FCollisionProcessor::SimulateCollision(const float DeltaTime)
+size_t FCollisionProcessor::FindTreeId(const UCollisionComponentBase* InComponent) const
 {
+	auto It = ComponentTreeIds.find(InComponent);
+	return It != ComponentTreeIds.end() ? It->second : FDynamicAABBTree::NULL_NODE;
+}
+
+void FCollisionProcessor::RemoveCollisionNode(size_t TreeId)
+{
+	// 노드의 쌍만 제거 - 접촉 상대가 사라지므로 수면 중인 상대를 깨움
+	ActiveCollisionPairs.RemoveAllOf(TreeId, [this, TreeId](const FCollisionPair& Pair) {
+		WakeCollisionNode(Pair.TreeIdA == TreeId ? Pair.TreeIdB : Pair.TreeIdA);
+									 });
+
+	// AABB 트리에서 제거
+	if (CollisionTree->IsValidId(TreeId))
+		CollisionTree->Remove(TreeId);
+
+	// 역맵은 같은 주소에 새 컴포넌트가 등록되지 않았을 때만 제거
+	auto ReverseIt = ComponentTreeIds.find(TreeComponents[TreeId]);
+	if (ReverseIt != ComponentTreeIds.end() && ReverseIt->second == TreeId)
+	{
+		ComponentTreeIds.erase(ReverseIt);
+	}
+	TreeComponents[TreeId] = nullptr;
+	if (TreeId < TreeBodyIds.size())
+	{
+		TreeBodyIds[TreeId] = FPhysicsBodyStore::INVALID_BODY;
+	}
+
+	// RegisteredComponents에서 제거
+	RegisteredComponents.erase(TreeId);
+	++LayoutVersion;
+}
+
+float FCollisionProcessor::SimulateCollision(const float DeltaTime, FPhysicsTickStats* OutStats)
+{
+	TickStats = OutStats;
+
 	CleanupDestroyedComponents();
-	UpdateCollisionTransform();
-	UpdateCollisionPairs();
+	{
+		FPhysicsPhaseTimer Timer(TickStats, EPhysicsPhase::CollisionTransform);
+		UpdateCollisionTransform();
+	}
+	{
+		FPhysicsPhaseTimer Timer(TickStats, EPhysicsPhase::CollisionPairs);
+		UpdateCollisionPairs();
+	}
+	{
+		FPhysicsPhaseTimer Timer(TickStats, EPhysicsPhase::Islands);
+		UpdateSimulationIslands(DeltaTime);
+	}
 	float minSimulTime = ProcessCollisions(DeltaTime);
+
+	TickStats = nullptr;
 	return minSimulTime;
 }
 
+void FCollisionProcessor::ClearContactReports()
+{
+	if (EventDispatcher)
+	{
+		EventDispatcher->ClearContactReports();
+	}
+}
+
+void FCollisionProcessor::DispatchContactReports()
+{
+	if (EventDispatcher)
+	{
+		EventDispatcher->DispatchContactReports();
+	}
+}
+
+const std::vector<FCollisionContactReport>& FCollisionProcessor::GetContactReports() const
+{
+	static const std::vector<FCollisionContactReport> EmptyReports;
+	return EventDispatcher ? EventDispatcher->GetContactReports() : EmptyReports;
+}
+
 void FCollisionProcessor::UnRegisterAll()
 {
 	if (!CollisionTree)
@@ -102,8 +184,35 @@ void FCollisionProcessor::UnRegisterAll()
 	{
 		CollisionTree->Remove(Registered.first);
 	}
-	ActiveCollisionPairs.clear();
+	ActiveCollisionPairs.Clear();
+	LocalSubstepPairs.clear();
 	RegisteredComponents.clear();
+	ComponentTreeIds.clear();
+	TreeComponents.clear();
+	// 노드 번호는 재사용되므로 이전 매핑과 등록 구성에 의존한 상태 무효화
+	TreeBodyIds.clear();
+	++LayoutVersion;
+}
+
+bool FCollisionProcessor::ResetState()
+{
+	if (!CollisionTree || !RegisteredComponents.empty())
+		return false;
+
+	// 트리 노드 번호 재사용 순서까지 초기화되도록 트리를 다시 생성
+	delete CollisionTree;
+	CollisionTree = new FDynamicAABBTree(InitialCollisonCapacity);
+	CollisionTree->AABB_Extension = std::max(0.1f, FatBoundsExtentRatio);
+
+	ActiveCollisionPairs.Clear();
+	LocalSubstepPairs.clear();
+	ComponentTreeIds.clear();
+	TreeComponents.clear();
+	TreeBodyIds.clear();
+	MovedNodeMask.clear();
+	ClearContactReports();
+	++LayoutVersion;
+	return true;
 }
 
 void FCollisionProcessor::Initialize()
@@ -126,7 +235,7 @@ void FCollisionProcessor::Initialize()
 		CollisionTree->AABB_Extension = std::max(0.1f,FatBoundsExtentRatio); //기본은 0.1f
 
 		RegisteredComponents.reserve(InitialCollisonCapacity);
-		ActiveCollisionPairs.reserve(InitialCollisonCapacity);
+		ActiveCollisionPairs.Reserve(InitialCollisonCapacity);
 	}
 	catch (...)
 	{
@@ -163,8 +272,11 @@ void FCollisionProcessor::Release()
 		delete Detector;
 		Detector = nullptr;
 	}
-	ActiveCollisionPairs.clear();
+	ActiveCollisionPairs.Clear();
+	LocalSubstepPairs.clear();
 	RegisteredComponents.clear();
+	ComponentTreeIds.clear();
+	TreeComponents.clear();
 }
 
 void FCollisionProcessor::CleanupDestroyedComponents()
@@ -192,23 +304,7 @@ void FCollisionProcessor::CleanupDestroyedComponents()
 	// 제거 작업 수행
 	for (size_t nodeId : componentsToRemove)
 	{
-		// AABB 트리에서 제거
-		if (CollisionTree->IsValidId(nodeId))
-			CollisionTree->Remove(nodeId);
-
-		// 활성 충돌 쌍에서 관련 항목 제거
-		auto pairIt = ActiveCollisionPairs.begin();
-		while (pairIt != ActiveCollisionPairs.end())
-		{
-			const FCollisionPair& Pair = *pairIt;
-			if (Pair.TreeIdA == nodeId || Pair.TreeIdB == nodeId)
-				pairIt = ActiveCollisionPairs.erase(pairIt);
-			else
-				++pairIt;
-		}
-
-		// RegisteredComponents에서 제거
-		RegisteredComponents.erase(nodeId);
+		RemoveCollisionNode(nodeId);
 	}
 }
 
@@ -216,71 +312,295 @@ void FCollisionProcessor::UpdateCollisionPairs()
 {
 	if (!CollisionTree || RegisteredComponents.empty())
 	{
-		ActiveCollisionPairs.clear();
+		ActiveCollisionPairs.Clear();
+		if (CollisionTree)
+		{
+			CollisionTree->ClearMoveBuffer();
+		}
 		return;
 	}
 
-	std::unordered_set<FCollisionPair> NewCollisionPairs;
+	// 삽입/재삽입된 리프만 다시 질의 - 움직이지 않은 리프끼리의 쌍은 뚱뚱한 바운드가 그대로이므로 유지
+	const std::vector<size_t>& MovedNodes = CollisionTree->GetMoveBuffer();
+	if (MovedNodes.empty())
+		return;
 
-	// AABBTree 기반 broad-phase 충돌 검사
-	for (const auto& compData : RegisteredComponents)
+	// 표시 배열은 사용 후 움직인 노드만 되돌려 놓음 - 전체 초기화 없이 재사용
+	for (size_t NodeId : MovedNodes)
 	{
-		auto component = compData.second.lock();
-		size_t treeNodeId = compData.first;
+		if (NodeId >= MovedNodeMask.size())
+		{
+			MovedNodeMask.resize(NodeId + 1, 0);
+		}
+		MovedNodeMask[NodeId] = 1;
+	}
+	auto IsMoved = [this](size_t NodeId) {
+		return NodeId < MovedNodeMask.size() && MovedNodeMask[NodeId] != 0;
+		};
 
-		if (!component || !component->IsActive())
+	// 움직인 리프가 포함된 기존 쌍 중 뚱뚱한 바운드가 더 이상 겹치지 않거나 필터에 걸리는 쌍 제거
+	auto ShouldRemovePair = [&](const FCollisionPair& ExistingPair) {
+		// 컴포넌트가 여전히 유효한지 확인
+		auto CompA = LockComponent(ExistingPair.TreeIdA);
+		auto CompB = LockComponent(ExistingPair.TreeIdB);
+		// 꺼진 충돌체/강체의 쌍과 정적 계층으로 옮겨진 리프끼리의 쌍도 제거
+		const bool bFiltered = (CompA && CompB &&
+			(!CompA->IsCollisionActive() || !CompB->IsCollisionActive() || !ShouldCreatePair(*CompA, *CompB))) ||
+			(CollisionTree->IsStaticLeaf(ExistingPair.TreeIdA) && CollisionTree->IsStaticLeaf(ExistingPair.TreeIdB));
+		if (!bFiltered &&
+			CollisionTree->GetFatBounds(ExistingPair.TreeIdA).Overlaps(CollisionTree->GetFatBounds(ExistingPair.TreeIdB)))
+			return false;
+
+		// 접촉이 사라지면 수면 중인 쪽을 깨움 - 지지하던 상대가 떠난 경우
+		WakeCollisionNode(ExistingPair.TreeIdA);
+		WakeCollisionNode(ExistingPair.TreeIdB);
+
+		// 기존의 쌍에 존재 + 이전프레임 충돌 + 새로운 쌍에 없음
+		if (CompA && CompB && CompA->IsActive() && CompB->IsActive() && ExistingPair.bPrevCollided)
+		{
+			FCollisionDetectionResult ExitResult;
+			ExitResult.bCollided = false;
+			BroadcastCollisionEvents(ExistingPair, ExitResult);
+		}
+		return true;
+		};
+	// 움직인 리프의 인접 목록만 순회 - 전체 쌍 순회 없이 비용은 움직인 리프의 쌍 수에 비례
+	for (size_t NodeId : MovedNodes)
+	{
+		ActiveCollisionPairs.RemoveIfOf(NodeId, [&](const FCollisionPair& ExistingPair) {
+			// 둘다 움직였으면 번호가 작은 쪽에서 이미 검사
+			const size_t OtherId = ExistingPair.TreeIdA == NodeId ? ExistingPair.TreeIdB : ExistingPair.TreeIdA;
+			if (OtherId < NodeId && IsMoved(OtherId))
+				return false;
+			return ShouldRemovePair(ExistingPair);
+										});
+	}
+
+	// AABBTree 기반 broad-phase 충돌 검사 - 움직인 리프의 새 쌍 추가, 기존 쌍은 누적 상태 유지
+	for (size_t treeNodeId : MovedNodes)
+	{
+		auto RegisteredIt = RegisteredComponents.find(treeNodeId);
+		// 버퍼에는 이후 제거되거나 내부 노드로 재사용된 번호가 남아 있을 수 있음
+		if (RegisteredIt == RegisteredComponents.end() ||
+			!CollisionTree->IsValidId(treeNodeId) || !CollisionTree->IsLeafNode(treeNodeId))
+			continue;
+
+		auto component = RegisteredIt->second.lock();
+		if (!component || !component->IsCollisionActive())
 			continue;
 
 		FDynamicAABBTree::AABB bounds = CollisionTree->GetFatBounds(treeNodeId);
 
-		// 특정 AABB와 겹치는 모든 노드 찾기
-		CollisionTree->QueryOverlap(bounds, [&](size_t otherNodeId) {
-			// 자기 자신과의 충돌 무시 및 중복 충돌 쌍 방지
-			if (treeNodeId >= otherNodeId ||
-				!RegisteredComponents.count(otherNodeId) ||
-				!RegisteredComponents[otherNodeId].lock() ||
-				!RegisteredComponents[otherNodeId].lock()->IsActive())
+		// 특정 AABB와 겹치는 모든 노드 찾기 - 동적 리프는 두 계층, 정적 리프는 동적 계층만 질의 (정적-정적 쌍은 만들지 않음)
+		auto AddOverlapPair = [&](size_t otherNodeId) {
+			// 자기 자신과의 충돌 무시 및 중복 질의 방지 (둘다 움직였으면 번호가 큰 쪽에서 생성)
+			if (treeNodeId == otherNodeId ||
+				(otherNodeId < treeNodeId && IsMoved(otherNodeId)))
 				return;
 
-			// 새 충돌 쌍 생성
-			FCollisionPair NewPair(treeNodeId, otherNodeId);
+			auto OtherIt = RegisteredComponents.find(otherNodeId);
+			if (OtherIt == RegisteredComponents.end())
+				return;
+			auto OtherComponent = OtherIt->second.lock();
+			if (!OtherComponent || !OtherComponent->IsCollisionActive())
+				return;
 
-			// 새 쌍 상태 
-			auto ExistingPair = ActiveCollisionPairs.find(NewPair);
-			if (ExistingPair != ActiveCollisionPairs.end()) {
-				NewPair = *ExistingPair;
-			}
+			// 층/마스크와 사용자 필터 - 쌍을 만들기 전에 걸러 좁은 단계 검사 자체를 생략
+			if (!ShouldCreatePair(*component, *OtherComponent))
+				return;
 
-			NewCollisionPairs.insert(std::move(NewPair));
-									});
+			ActiveCollisionPairs.FindOrAdd(treeNodeId, otherNodeId);
+			};
+		CollisionTree->QueryOverlap(FDynamicAABBTree::ETreeType::Dynamic, bounds, AddOverlapPair);
+		if (!CollisionTree->IsStaticLeaf(treeNodeId))
+		{
+			CollisionTree->QueryOverlap(FDynamicAABBTree::ETreeType::Static, bounds, AddOverlapPair);
+		}
 	}
 
-	// Exit 상황이 확실한 쌍을 찾음
-	for (const auto& ExistingPair : ActiveCollisionPairs)
+	for (size_t NodeId : MovedNodes)
 	{
-		// 컴포넌트가 여전히 유효한지 확인
-		auto CompA = RegisteredComponents[ExistingPair.TreeIdA].lock();
-		auto CompB = RegisteredComponents[ExistingPair.TreeIdB].lock();
+		if (NodeId < MovedNodeMask.size())
+		{
+			MovedNodeMask[NodeId] = 0;
+		}
+	}
+	CollisionTree->ClearMoveBuffer();
+}
+
+bool FCollisionProcessor::ShouldCreatePair(const UCollisionComponentBase& InComponentA, const UCollisionComponentBase& InComponentB) const
+{
+	if (!InComponentA.CanCollideWith(InComponentB))
+		return false;
+	return !PairFilter || PairFilter(InComponentA, InComponentB);
+}
+
+void FCollisionProcessor::SetPairFilter(FCollisionPairFilter InPairFilter)
+{
+	PairFilter = std::move(InPairFilter);
+	if (!CollisionTree)
+		return;
+
+	// 모든 리프를 다시 질의해 기존 쌍에도 새 필터 적용
+	for (const auto& RegisteredPair : RegisteredComponents)
+	{
+		CollisionTree->MarkMoved(RegisteredPair.first);
+	}
+}
+
+void FCollisionProcessor::RefreshCollisionFilter(const UCollisionComponentBase& InComponent)
+{
+	if (!CollisionTree)
+		return;
+
+	const size_t TreeId = FindTreeId(&InComponent);
+	// 등록 전이면 등록할 때 새 층/마스크로 질의함
+	if (TreeId == FDynamicAABBTree::NULL_NODE)
+		return;
+
+	CollisionTree->MarkMoved(TreeId);
+}
+
+void FCollisionProcessor::RefreshStaticBounds(const UCollisionComponentBase& InComponent)
+{
+	if (!CollisionTree)
+		return;
 
-		if (CompA && CompB && CompA->IsActive() && CompB->IsActive())
+	const size_t TreeId = FindTreeId(&InComponent);
+	if (TreeId == FDynamicAABBTree::NULL_NODE || !CollisionTree->IsStaticLeaf(TreeId))
+		return;
+
+	CollisionTree->RefitLeaf(TreeId);
+}
+
+void FCollisionProcessor::UpdateCollisionTransform()
+{
+	const size_t Reinserted = CollisionTree->UpdateTree();
+	if (TickStats)
+	{
+		TickStats->TreeReinserts += static_cast<uint32_t>(Reinserted);
+	}
+}
+
+void FCollisionProcessor::UpdateSimulationIslands(const float DeltaTime)
+{
+	IslandCount = 0;
+	SleepingIslandCount = 0;
+	if (!BodyStore || !CollisionTree)
+		return;
+
+	IslandGraph.Reset(BodyStore->GetCapacity());
+	std::fill(TreeBodyIds.begin(), TreeBodyIds.end(), FPhysicsBodyStore::INVALID_BODY);
+
+	// 트리 노드 -> 강체 슬롯 매핑 및 동적 강체 등록
+	for (const auto& Registered : RegisteredComponents)
+	{
+		auto Component = Registered.second.lock();
+		URigidBodyComponent* RigidBody = Component ? Component->GetRigidBody() : nullptr;
+		if (!RigidBody || !Component->IsActive())
+			continue;
+
+		const size_t TreeId = Registered.first;
+		if (TreeId >= TreeBodyIds.size())
+		{
+			TreeBodyIds.resize(TreeId + 1, FPhysicsBodyStore::INVALID_BODY);
+		}
+
+		const FPhysicsBodyId BodyId = RigidBody->GetPhysicsBodyId();
+		TreeBodyIds[TreeId] = BodyId;
+		// 강체 종류가 바뀌었으면 리프 계층 이동 - 다음 넓은 단계에서 다시 질의
+		CollisionTree->SetLeafStatic(TreeId, BodyStore->IsStatic(BodyId));
+		if (!BodyStore->IsStatic(BodyId))
+		{
+			IslandGraph.AddBody(BodyId);
+		}
+	}
+
+	// 활성 충돌쌍을 간선으로 연결 - 정적 강체는 등록되지 않았으므로 섬을 잇지 않음
+	for (const auto& Pair : ActiveCollisionPairs)
+	{
+		IslandGraph.Connect(GetTreeBodyId(Pair.TreeIdA), GetTreeBodyId(Pair.TreeIdB));
+	}
+	IslandGraph.Build();
+	IslandCount = IslandGraph.GetIslandCount();
+
+	if (!bEnableSleeping)
+		return;
+
+	// 섬 단위 수면 판정 - 모든 강체가 임계값 아래에 충분히 머문 섬만 수면
+	const float LinearThresholdSq = SleepLinearVelocityThreshold * SleepLinearVelocityThreshold;
+	const float AngularThresholdSq = SleepAngularVelocityThreshold * SleepAngularVelocityThreshold;
+	for (size_t Island = 0; Island < IslandCount; ++Island)
+	{
+		const FPhysicsBodyId* Begin = IslandGraph.GetIslandBodiesBegin(Island);
+		const FPhysicsBodyId* End = IslandGraph.GetIslandBodiesEnd(Island);
+
+		float MinSleepTime = FLT_MAX;
+		for (const FPhysicsBodyId* It = Begin; It != End; ++It)
+		{
+			const FPhysicsBodyId Id = *It;
+			if (!BodyStore->IsSleeping(Id))
+			{
+				const bool bResting = BodyStore->Velocities[Id].LengthSquared() <= LinearThresholdSq &&
+					BodyStore->AngularVelocities[Id].LengthSquared() <= AngularThresholdSq;
+				BodyStore->SleepTimers[Id] = bResting ? BodyStore->SleepTimers[Id] + DeltaTime : 0.0f;
+			}
+			MinSleepTime = std::min(MinSleepTime, BodyStore->SleepTimers[Id]);
+		}
+
+		// 섬 전체를 함께 재우거나 깨움 - 깨울 때 수면 판정 시간은 유지
+		const bool bSleepIsland = MinSleepTime >= TimeToSleep;
+		for (const FPhysicsBodyId* It = Begin; It != End; ++It)
 		{
-			// 기존의 쌍에 존재 + 이전프레임 충돌 + 새로운 쌍에 없음
-			if (ExistingPair.bPrevCollided && 
-				NewCollisionPairs.find(ExistingPair) == NewCollisionPairs.end())
+			if (BodyStore->IsSleeping(*It) != bSleepIsland)
 			{
-				FCollisionDetectionResult ExitResult;
-				ExitResult.bCollided = false;
-				BroadcastCollisionEvents(ExistingPair, ExitResult);
+				BodyStore->SetSleeping(*It, bSleepIsland);
 			}
 		}
+		if (bSleepIsland)
+		{
+			++SleepingIslandCount;
+		}
 	}
 
-	ActiveCollisionPairs = std::move(NewCollisionPairs);
+	// 트리 리프 수면 상태 동기화
+	for (size_t TreeId = 0; TreeId < TreeBodyIds.size(); ++TreeId)
+	{
+		const FPhysicsBodyId BodyId = TreeBodyIds[TreeId];
+		if (BodyId != FPhysicsBodyStore::INVALID_BODY)
+		{
+			CollisionTree->SetSleeping(TreeId, BodyStore->IsSleeping(BodyId));
+		}
+	}
 }
 
-void FCollisionProcessor::UpdateCollisionTransform()
+void FCollisionProcessor::WakeCollisionNode(size_t TreeId)
+{
+	if (!CollisionTree || !CollisionTree->IsValidId(TreeId) || !CollisionTree->IsSleeping(TreeId))
+		return;
+
+	CollisionTree->SetSleeping(TreeId, false);
+
+	auto It = RegisteredComponents.find(TreeId);
+	if (It == RegisteredComponents.end())
+		return;
+
+	auto Component = It->second.lock();
+	URigidBodyComponent* RigidBody = Component ? Component->GetRigidBody() : nullptr;
+	if (RigidBody)
+	{
+		RigidBody->SetSleep(false);
+	}
+}
+
+uint32_t FCollisionProcessor::GetPairIslandIndex(const FCollisionPair& Pair) const
 {
-	CollisionTree->UpdateTree();
+	uint32_t Island = IslandGraph.GetIslandIndex(GetTreeBodyId(Pair.TreeIdA));
+	if (Island == FSimulationIslandGraph::NO_ISLAND)
+	{
+		Island = IslandGraph.GetIslandIndex(GetTreeBodyId(Pair.TreeIdB));
+	}
+	return Island;
 }
 
 bool FCollisionProcessor::ShouldUseCCD(const IPhysicsStateInternal* PhysicsState) const
@@ -290,100 +610,614 @@ bool FCollisionProcessor::ShouldUseCCD(const IPhysicsStateInternal* PhysicsState
 	return PhysicsState->P_GetVelocity().Length() > CCDVelocityThreshold;
 }
 
+bool FCollisionProcessor::DetectPair(UCollisionComponentBase& CompA, UCollisionComponentBase& CompB, const float DeltaTime,
+									 FCollisionDetectionResult& OutResult) const
+{
+	if (ShouldUseCCD(CompA.GetPhysicsStateInternal()) || ShouldUseCCD(CompB.GetPhysicsStateInternal()))
+	{
+		//ccd
+		OutResult = Detector->DetectCollisionCCD(CompA, CompA.GetPreviousWorldTransform(), CompA.GetWorldTransform(),
+												 CompB, CompB.GetPreviousWorldTransform(), CompB.GetWorldTransform(), DeltaTime);
+	}
+	else
+	{
+		//dcd
+		OutResult = Detector->DetectCollisionDiscrete(CompA, CompA.GetWorldTransform(),
+													  CompB, CompB.GetWorldTransform());
+	}
+	return OutResult.bCollided;
+}
+
+bool FCollisionProcessor::DetectPairFromBodyStore(const FCollisionPair& InPair, UCollisionComponentBase& CompA,
+												  UCollisionComponentBase& CompB, const float DeltaTime,
+												  FCollisionDetectionResult& OutResult) const
+{
+	FTransform PrevA, CurrentA, PrevB, CurrentB;
+	GetBodyStoreTransforms(CompA, GetTreeBodyId(InPair.TreeIdA), PrevA, CurrentA);
+	GetBodyStoreTransforms(CompB, GetTreeBodyId(InPair.TreeIdB), PrevB, CurrentB);
+
+	if (ShouldUseCCD(CompA.GetPhysicsStateInternal()) || ShouldUseCCD(CompB.GetPhysicsStateInternal()))
+	{
+		OutResult = Detector->DetectCollisionCCD(CompA, PrevA, CurrentA, CompB, PrevB, CurrentB, DeltaTime);
+	}
+	else
+	{
+		OutResult = Detector->DetectCollisionDiscrete(CompA, CurrentA, CompB, CurrentB);
+	}
+	return OutResult.bCollided;
+}
+
+void FCollisionProcessor::GetBodyStoreTransforms(const UCollisionComponentBase& InComponent, FPhysicsBodyId InBodyId,
+												 FTransform& OutPrevTransform, FTransform& OutTransform) const
+{
+	// 강체가 없거나 정적이면 컴포넌트 트랜스폼이 그대로 유효
+	if (!BodyStore || InBodyId == FPhysicsBodyStore::INVALID_BODY || BodyStore->IsStatic(InBodyId))
+	{
+		OutTransform = InComponent.GetWorldTransform();
+		OutPrevTransform = OutTransform;
+		return;
+	}
+
+	FTransform BodyTransform = BodyStore->GetWorldTransform(InBodyId);
+	OutTransform = InComponent.LocalToWorld(BodyTransform);
+	BodyTransform.Position = BodyStore->PrevPositions[InBodyId];
+	BodyTransform.Rotation = BodyStore->PrevRotations[InBodyId];
+	OutPrevTransform = InComponent.LocalToWorld(BodyTransform);
+}
+
+float FCollisionProcessor::DetectPairs(const std::vector<const FCollisionPair*>& InCandidates, const float DeltaTime,
+									   std::vector<const FCollisionPair*>& OutPairs,
+									   std::vector<FCollisionDetectionResult>& OutResults,
+									   const bool bFromBodyStore)
+{
+	OutPairs.clear();
+	OutResults.clear();
+	const size_t Count = InCandidates.size();
+	if (Count == 0)
+		return 1.0f;
+
+	// 쌍마다 weak_ptr를 잠그지 않도록 노드별로 한 번만 확인 - 작업자는 공유 컨테이너를 건드리지 않음
+	if (++NarrowphaseStamp == 0)
+	{
+		std::fill(NarrowphaseStamps.begin(), NarrowphaseStamps.end(), 0);
+		NarrowphaseStamp = 1;
+	}
+	auto ResolveComponent = [this](size_t TreeId) {
+		if (TreeId >= NarrowphaseStamps.size())
+		{
+			NarrowphaseStamps.resize(TreeId + 1, 0);
+			NarrowphaseComponents.resize(TreeId + 1, nullptr);
+		}
+		if (NarrowphaseStamps[TreeId] == NarrowphaseStamp)
+			return;
+
+		auto It = RegisteredComponents.find(TreeId);
+		NarrowphaseComponents[TreeId] = It != RegisteredComponents.end() ? It->second.lock().get() : nullptr;
+		NarrowphaseStamps[TreeId] = NarrowphaseStamp;
+		};
+	for (const FCollisionPair* Pair : InCandidates)
+	{
+		ResolveComponent(Pair->TreeIdA);
+		ResolveComponent(Pair->TreeIdB);
+	}
+
+	NarrowphaseResults.resize(Count);
+	NarrowphaseHits.assign(Count, 0);
+	auto DetectRange = [this, &InCandidates, DeltaTime, bFromBodyStore](size_t Begin, size_t End, size_t) {
+		for (size_t i = Begin; i < End; ++i)
+		{
+			const FCollisionPair& Pair = *InCandidates[i];
+			UCollisionComponentBase* CompA = NarrowphaseComponents[Pair.TreeIdA];
+			UCollisionComponentBase* CompB = NarrowphaseComponents[Pair.TreeIdB];
+			if (!CompA || !CompB)
+				continue;
+
+			const bool bHit = bFromBodyStore ?
+				DetectPairFromBodyStore(Pair, *CompA, *CompB, DeltaTime, NarrowphaseResults[i]) :
+				DetectPair(*CompA, *CompB, DeltaTime, NarrowphaseResults[i]);
+			if (bHit)
+			{
+				NarrowphaseHits[i] = 1;
+			}
+		}
+		};
+
+	if (WorkerPool && WorkerPool->ShouldRunParallel(Count, static_cast<size_t>(std::max(NarrowphaseMinPairs, 1))))
+	{
+		WorkerPool->ParallelFor(Count, static_cast<size_t>(std::max(NarrowphaseChunkSize, 1)), DetectRange);
+	}
+	else
+	{
+		DetectRange(0, Count, 0);
+	}
+
+	// 후보 순서대로 병합하며 최저 충돌 시간 축약
+	float MinCollideTime = 1.0f;
+	for (size_t i = 0; i < Count; ++i)
+	{
+		if (!NarrowphaseHits[i])
+		{
+			// 떨어진 쌍은 접촉점을 버림 - 다시 닿으면 새 접촉으로 시작
+			InCandidates[i]->Manifold.PointCount = 0;
+			continue;
+		}
+
+		MinCollideTime = std::min(MinCollideTime, NarrowphaseResults[i].TimeOfImpact);
+		OutPairs.push_back(InCandidates[i]);
+		OutResults.push_back(NarrowphaseResults[i]);
+	}
+	return MinCollideTime;
+}
+
 float FCollisionProcessor::ProcessCollisions(const float DeltaTime)
 {
-	const float TotalDeltaTime = DeltaTime;
 	float minCollideTime = 1.0f;
 	
 	std::vector<const FCollisionPair*> CollisionPairs;
 	std::vector<FCollisionDetectionResult> DetectionResults;
+	std::vector<uint32_t> PairIslands;
 
-	CollisionPairs.reserve(ActiveCollisionPairs.size());
-	DetectionResults.reserve(ActiveCollisionPairs.size());
+	CollisionPairs.reserve(ActiveCollisionPairs.GetCount());
+	DetectionResults.reserve(ActiveCollisionPairs.GetCount());
+	PairIslands.reserve(ActiveCollisionPairs.GetCount());
 
-	//충돌 감지 및 정보 수집
-	for (auto it = ActiveCollisionPairs.begin(); it != ActiveCollisionPairs.end() ; ++it)
 	{
+		FPhysicsPhaseTimer Timer(TickStats, EPhysicsPhase::Narrowphase);
+		// 수면 중인 섬의 쌍은 좁은 단계 생략
+		NarrowphaseCandidates.clear();
+		for (const FCollisionPair& ActivePair : ActiveCollisionPairs)
+		{
+			if (CollisionTree->IsSleeping(ActivePair.TreeIdA) || CollisionTree->IsSleeping(ActivePair.TreeIdB))
+				continue;
+			NarrowphaseCandidates.push_back(&ActivePair);
+		}
 
-		auto& ActivePair = *it;
+		//충돌 감지 및 정보 수집
+		minCollideTime = DetectPairs(NarrowphaseCandidates, DeltaTime, CollisionPairs, DetectionResults);
+		for (const FCollisionPair* CollidedPair : CollisionPairs)
+		{
+			PairIslands.push_back(GetPairIslandIndex(*CollidedPair));
+		}
 
-		auto CompA = RegisteredComponents[ActivePair.TreeIdA].lock();
-		auto CompB = RegisteredComponents[ActivePair.TreeIdB].lock();
+		if (TickStats)
+		{
+			TickStats->BroadphasePairs += static_cast<uint32_t>(ActiveCollisionPairs.GetCount());
+			TickStats->NarrowphaseHits += static_cast<uint32_t>(CollisionPairs.size());
+		}
 
-		//Collision detection
-		FCollisionDetectionResult DetectResult;
-		if (CompA && CompB)
+		// 밀집 배열 순서는 삽입/제거 이력에 따라 달라지므로 노드 번호 순으로 재배치
+		if (bCanonicalPairOrder && CollisionPairs.size() > 1)
 		{
-			if (ShouldUseCCD(CompA->GetPhysicsStateInternal()) || ShouldUseCCD(CompB->GetPhysicsStateInternal()))
-			{
-				//ccd
-				DetectResult = Detector->DetectCollisionCCD(*CompA.get(), CompA->GetPreviousWorldTransform(), CompA->GetWorldTransform(),
-															*CompB.get(), CompB->GetPreviousWorldTransform(), CompB->GetWorldTransform(), DeltaTime);
-			}
-			else
+			std::vector<uint32_t> Order(CollisionPairs.size());
+			std::iota(Order.begin(), Order.end(), 0);
+			std::sort(Order.begin(), Order.end(), [&CollisionPairs](uint32_t Lhs, uint32_t Rhs) {
+				const FCollisionPair& A = *CollisionPairs[Lhs];
+				const FCollisionPair& B = *CollisionPairs[Rhs];
+				return A.TreeIdA != B.TreeIdA ? A.TreeIdA < B.TreeIdA : A.TreeIdB < B.TreeIdB;
+					  });
+
+			std::vector<const FCollisionPair*> SortedPairs(CollisionPairs.size());
+			std::vector<FCollisionDetectionResult> SortedResults(DetectionResults.size());
+			std::vector<uint32_t> SortedIslands(PairIslands.size());
+			for (size_t k = 0; k < Order.size(); ++k)
 			{
-				//dcd
-				DetectResult = Detector->DetectCollisionDiscrete(*CompA.get(), CompA->GetWorldTransform(),
-																 *CompB.get(), CompB->GetWorldTransform());
+				SortedPairs[k] = CollisionPairs[Order[k]];
+				SortedResults[k] = DetectionResults[Order[k]];
+				SortedIslands[k] = PairIslands[Order[k]];
 			}
+			CollisionPairs.swap(SortedPairs);
+			DetectionResults.swap(SortedResults);
+			PairIslands.swap(SortedIslands);
+		}
+
+		// 섬별 최저 ToI - 지역 서브스텝 대상 섬과 그 섬의 충돌쌍 수집
+		IslandTimeOfImpacts.assign(IslandCount, 1.0f);
+		UpdateIslandTimeOfImpacts(DetectionResults, PairIslands);
+		CollectLocalSubstepPairs();
+	}
+
+	ResolveCollisions(CollisionPairs, DetectionResults, PairIslands, minCollideTime, DeltaTime);
+	return minCollideTime;
+}
+
+float FCollisionProcessor::SimulateLocalCollision(const std::vector<FPhysicsBodyId>& InBodies, const float DeltaTime,
+												   FPhysicsTickStats* OutStats)
+{
+	TickStats = OutStats;
+	float minCollideTime = 1.0f;
+
+	// 진행을 마친 섬은 대상에서 제외 - 이미 단계 끝 시점에 있는 강체에 충격량을 다시 주지 않도록
+	std::vector<uint8_t> IslandMask(IslandTimeOfImpacts.size(), 0);
+	for (FPhysicsBodyId BodyId : InBodies)
+	{
+		const uint32_t Island = IslandGraph.GetIslandIndex(BodyId);
+		if (Island < IslandMask.size())
+		{
+			IslandMask[Island] = 1;
+		}
+	}
+	LocalSubstepIslands.erase(std::remove_if(LocalSubstepIslands.begin(), LocalSubstepIslands.end(),
+											 [&IslandMask](uint32_t Island) { return !IslandMask[Island]; }),
+							  LocalSubstepIslands.end());
+	LocalSubstepPairs.erase(std::remove_if(LocalSubstepPairs.begin(), LocalSubstepPairs.end(),
+										   [this, &IslandMask](const FCollisionPair* Pair) {
+											   const uint32_t Island = GetPairIslandIndex(*Pair);
+											   return Island >= IslandMask.size() || !IslandMask[Island];
+										   }),
+							LocalSubstepPairs.end());
+
+	std::vector<const FCollisionPair*> CollisionPairs;
+	std::vector<FCollisionDetectionResult> DetectionResults;
+	std::vector<uint32_t> PairIslands;
+
+	{
+		FPhysicsPhaseTimer Timer(TickStats, EPhysicsPhase::Narrowphase);
+		// 넓은 단계와 섬 구성은 서브스텝 시작 시점 결과를 그대로 사용 - 대상 섬의 쌍만 다시 검사
+		// 컴포넌트 트랜스폼은 Finalize 전까지 갱신되지 않으므로 지역 진행이 반영된 저장소 트랜스폼으로 검사
+		minCollideTime = DetectPairs(LocalSubstepPairs, DeltaTime, CollisionPairs, DetectionResults, true);
+		for (const FCollisionPair* CollidedPair : CollisionPairs)
+		{
+			PairIslands.push_back(GetPairIslandIndex(*CollidedPair));
 		}
-		//충돌 시 최저 ToI 갱신 및 충돌 정보 수집
-		if (DetectResult.bCollided)
+
+		if (TickStats)
 		{
-			minCollideTime = std::min(minCollideTime, DetectResult.TimeOfImpact);
+			TickStats->NarrowphaseHits += static_cast<uint32_t>(CollisionPairs.size());
+		}
 
-			CollisionPairs.push_back(&(*it));
-			DetectionResults.push_back(DetectResult);
+		// 다시 충돌하지 않은 섬은 남은 시간 전부 진행
+		for (uint32_t Island : LocalSubstepIslands)
+		{
+			IslandTimeOfImpacts[Island] = 1.0f;
 		}
+		UpdateIslandTimeOfImpacts(DetectionResults, PairIslands);
 	}
 
-	// 겹침 비율에 따른 좌표 기반 위치 보정
-	for (int j = 0; j < CollisionPairs.size(); ++j)
+	ResolveCollisions(CollisionPairs, DetectionResults, PairIslands, minCollideTime, DeltaTime);
+
+	TickStats = nullptr;
+	return minCollideTime;
+}
+
+void FCollisionProcessor::GetLocalSubstepBodies(std::vector<FPhysicsBodyId>& OutBodies) const
+{
+	OutBodies.clear();
+	for (uint32_t Island : LocalSubstepIslands)
 	{
-		auto& CurrentPair = *CollisionPairs[j];
-		auto& CurrentResult = DetectionResults[j];
+		OutBodies.insert(OutBodies.end(), IslandGraph.GetIslandBodiesBegin(Island), IslandGraph.GetIslandBodiesEnd(Island));
+	}
+}
+
+float FCollisionProcessor::GetBodyTimeOfImpact(FPhysicsBodyId BodyId) const
+{
+	const uint32_t Island = IslandGraph.GetIslandIndex(BodyId);
+	return Island < IslandTimeOfImpacts.size() ? IslandTimeOfImpacts[Island] : 1.0f;
+}
+
+float FCollisionProcessor::GetIslandTimeOfImpact(uint32_t Island) const
+{
+	return Island < IslandTimeOfImpacts.size() ? IslandTimeOfImpacts[Island] : 1.0f;
+}
+
+void FCollisionProcessor::UpdateIslandTimeOfImpacts(const std::vector<FCollisionDetectionResult>& DetectionResults,
+													const std::vector<uint32_t>& PairIslands)
+{
+	for (size_t j = 0; j < DetectionResults.size(); ++j)
+	{
+		const uint32_t Island = PairIslands[j];
+		if (Island < IslandTimeOfImpacts.size())
+		{
+			IslandTimeOfImpacts[Island] = std::min(IslandTimeOfImpacts[Island], DetectionResults[j].TimeOfImpact);
+		}
+	}
+}
 
-		float overlapRatio = CalculateAABBOverlapRatio(CurrentPair);
-		if (overlapRatio > 0.7f)
+void FCollisionProcessor::CollectLocalSubstepPairs()
+{
+	LocalSubstepIslands.clear();
+	LocalSubstepPairs.clear();
+	if (!bLocalSubstepping)
+		return;
+
+	for (uint32_t Island = 0; Island < IslandTimeOfImpacts.size(); ++Island)
+	{
+		if (IslandTimeOfImpacts[Island] < 1.0f - KINDA_SMALL)
 		{
-			ApplyDirectPositionCorrection(CurrentPair, CurrentResult, 0.45f);
+			LocalSubstepIslands.push_back(Island);
 		}
-		else if (overlapRatio > 0.4f)
+	}
+	if (LocalSubstepIslands.empty())
+		return;
+
+	// 대상 섬에 속한 모든 활성 쌍 - 충돌하지 않은 쌍도 지역 서브스텝 도중 충돌할 수 있음
+	for (const auto& Pair : ActiveCollisionPairs)
+	{
+		if (CollisionTree->IsSleeping(Pair.TreeIdA) || CollisionTree->IsSleeping(Pair.TreeIdB))
+			continue;
+
+		const uint32_t Island = GetPairIslandIndex(Pair);
+		if (Island < IslandTimeOfImpacts.size() && IslandTimeOfImpacts[Island] < 1.0f - KINDA_SMALL)
 		{
-			ApplyDirectPositionCorrection(CurrentPair, CurrentResult, 0.2f);
+			LocalSubstepPairs.push_back(&Pair);
 		}
 	}
+}
 
-	//수집 된 정보를 반복적 해결법 적용
-	for (int i = 0; i < MaxConstraintIterations; ++i)
+void FCollisionProcessor::ResolveCollisions(const std::vector<const FCollisionPair*>& CollisionPairs,
+											const std::vector<FCollisionDetectionResult>& DetectionResults,
+											const std::vector<uint32_t>& PairIslands,
+											const float MinCollideTime, const float DeltaTime)
+{
+	// 쌍 포인터를 들고 있는 동안 밀집 배열 위치 고정 - 이벤트 콜백에서 해제되면 표시만
+	ActiveCollisionPairs.Lock();
 	{
-		for (int j = 0; j < CollisionPairs.size(); ++j)
+		FPhysicsPhaseTimer Timer(TickStats, EPhysicsPhase::Solver);
+		// 겹침 비율에 따른 좌표 기반 위치 보정
+		for (size_t j = 0; j < CollisionPairs.size(); ++j)
 		{
 			auto& CurrentPair = *CollisionPairs[j];
 			auto& CurrentResult = DetectionResults[j];
 
-			if (CurrentPair.bConverged)
+			// 새 접촉점에 지난 스텝의 누적 충격량 이어받기
+			UpdateContactManifold(CurrentPair, CurrentResult);
+
+			float overlapRatio = CalculateAABBOverlapRatio(CurrentPair);
+			if (overlapRatio > 0.7f)
+			{
+				ApplyDirectPositionCorrection(CurrentPair, CurrentResult, 0.45f);
+			}
+			else if (overlapRatio > 0.4f)
+			{
+				ApplyDirectPositionCorrection(CurrentPair, CurrentResult, 0.2f);
+			}
+		}
+
+		// 동적 강체를 공유하지 않는 쌍끼리 묶어 묶음 단위로 병렬 해결
+		BuildSolverBatches(CollisionPairs);
+
+		// 섬 단위 수렴 기록 - 둘다 정적인 쌍은 마지막 칸에 모음
+		const size_t PairCount = CollisionPairs.size();
+		auto GetIslandSlot = [this, &PairIslands](size_t j) {
+			return std::min(static_cast<size_t>(PairIslands[j]), IslandCount);
+			};
+		SolverPairTimes.resize(PairCount);
+		SolverIslandConverged.assign(IslandCount + 1, 1);
+		SolverIslandIterations.assign(IslandCount + 1, 0);
+		for (size_t j = 0; j < PairCount; ++j)
+		{
+			// 지역 서브스텝이면 섬이 실제로 진행할 시간으로 해결 - 적분처럼 최소 틱 시간으로 클램핑
+			// 충돌 시간이 0에 가까우면 위치 보정 속도가 침투 깊이 / 해결 시간으로 발산함
+			const float TimeRatio = bLocalSubstepping ? GetIslandTimeOfImpact(PairIslands[j]) : MinCollideTime;
+			SolverPairTimes[j] = std::min(DeltaTime, std::max(MinSolveTime, TimeRatio * DeltaTime));
+			SolverIslandConverged[GetIslandSlot(j)] = 0;
+		}
+
+		// 일괄 해결기는 강체 속도를 한 번 모아 행 단위로 해결하고 마지막에 되돌려 씀
+		const bool bBatchSolver = bUseContactBatchSolver && BodyStore;
+		if (bBatchSolver)
+		{
+			SolverPairBodies.resize(PairCount * 2);
+			for (size_t j = 0; j < PairCount; ++j)
+			{
+				SolverPairBodies[j * 2] = GetTreeBodyId(CollisionPairs[j]->TreeIdA);
+				SolverPairBodies[j * 2 + 1] = GetTreeBodyId(CollisionPairs[j]->TreeIdB);
+			}
+			SolverPairActivity.resize(PairCount);
+			// 행 구성 중 이어받은 충격량 적용
+			ContactSolver.Build(*BodyStore, CollisionPairs, DetectionResults, SolverPairBodies, SolverPairTimes,
+								SolverBatchPairs, SolverBatchOffsets, MAX_SOLVER_COLORS, ContactBiasFactor, ContactSlop);
+		}
+		else
+		{
+			// 이어받은 충격량을 먼저 적용하고 반복은 남은 차이만 해결
+			ForEachSolverBatch([this, &CollisionPairs, &DetectionResults](uint32_t j) {
+				WarmStartContacts(*CollisionPairs[j], DetectionResults[j]);
+				});
+		}
+
+		//수집 된 정보를 반복적 해결법 적용 - 수렴한 섬은 남은 반복 생략
+		for (int Iteration = 0; Iteration < MaxConstraintIterations; ++Iteration)
+		{
+			bool bAnyUnconverged = false;
+			for (size_t Slot = 0; Slot < SolverIslandConverged.size(); ++Slot)
+			{
+				if (!SolverIslandConverged[Slot])
+				{
+					++SolverIslandIterations[Slot];
+					bAnyUnconverged = true;
+				}
+			}
+			if (!bAnyUnconverged)
+				break;
+
+			if (bBatchSolver)
+			{
+				// 수렴한 섬과 수렴한 쌍의 행은 값을 바꾸지 않음
+				for (size_t j = 0; j < PairCount; ++j)
+				{
+					SolverPairActivity[j] = !SolverIslandConverged[GetIslandSlot(j)] && !CollisionPairs[j]->bConverged;
+				}
+				ContactSolver.SetPairActivity(SolverPairActivity);
+				SolveContactRows();
+				ContactSolver.UpdatePairConvergence(CollisionPairs);
+			}
+			else
+			{
+				// 묶음 실행 중에는 섬 수렴 기록을 읽기만 함
+				ForEachSolverBatch([this, &CollisionPairs, &DetectionResults, &GetIslandSlot](uint32_t j) {
+					if (SolverIslandConverged[GetIslandSlot(j)])
+						return;
+					ApplyCollisionResponseByContraints(*CollisionPairs[j], DetectionResults[j], SolverPairTimes[j]);
+					});
+			}
+
+			// 수렴한 섬의 쌍은 모두 수렴 상태이므로 수렴하지 않은 쌍만 섬에 표시
+			std::fill(SolverIslandConverged.begin(), SolverIslandConverged.end(), 1);
+			for (size_t j = 0; j < PairCount; ++j)
+			{
+				if (!CollisionPairs[j]->bConverged)
+				{
+					SolverIslandConverged[GetIslandSlot(j)] = 0;
+				}
+			}
+		}
+
+		if (bBatchSolver)
+		{
+			// 속도와 누적 충격량 되돌려 쓰기
+			ContactSolver.Finish(*BodyStore, CollisionPairs);
+		}
+
+		if (TickStats)
+		{
+			for (size_t Slot = 0; Slot < SolverIslandIterations.size(); ++Slot)
+			{
+				if (SolverIslandIterations[Slot] == 0)
+					continue;
+				TickStats->SolverIterations += SolverIslandIterations[Slot];
+				TickStats->UnconvergedIslands += SolverIslandConverged[Slot] ? 0 : 1;
+			}
+		}
+	}
+
+	{
+		FPhysicsPhaseTimer Timer(TickStats, EPhysicsPhase::Events);
+		for (size_t j = 0; j < CollisionPairs.size(); ++j)
+		{
+			auto& CurrentPair = *CollisionPairs[j];
+			auto& CurrentResult = DetectionResults[j];
+			// 이번 단계 중 해제된 충돌체의 쌍
+			if (CurrentPair.bRemoved)
 				continue;
 
-			auto CompA = RegisteredComponents[CurrentPair.TreeIdA].lock();
-			auto CompB = RegisteredComponents[CurrentPair.TreeIdB].lock();
+			BroadcastCollisionEvents(CurrentPair, CurrentResult);
+			//충돌 정보 저장
+			CurrentPair.bPrevCollided = CurrentResult.bCollided;
+			//수렴 정보 리셋
+			CurrentPair.bConverged = false;
+		}
+	}
+	ActiveCollisionPairs.Unlock();
+}
+
+void FCollisionProcessor::BuildSolverBatches(const std::vector<const FCollisionPair*>& CollisionPairs)
+{
+	const size_t PairCount = CollisionPairs.size();
+	SolverPairColors.resize(PairCount);
+	SolverBatchPairs.resize(PairCount);
+	SolverBatchOffsets.assign(MAX_SOLVER_COLORS + 2, 0);
+	SolverBodyColors.assign(BodyStore ? BodyStore->GetCapacity() : 0, 0);
+
+	// 쌍 순서대로 양쪽 동적 강체가 쓰지 않은 가장 작은 색 선택
+	for (size_t j = 0; j < PairCount; ++j)
+	{
+		const FPhysicsBodyId BodyA = GetTreeBodyId(CollisionPairs[j]->TreeIdA);
+		const FPhysicsBodyId BodyB = GetTreeBodyId(CollisionPairs[j]->TreeIdB);
+
+		uint32_t Color = MAX_SOLVER_COLORS;
+		if (BodyA < SolverBodyColors.size() && BodyB < SolverBodyColors.size())
+		{
+			const bool bDynamicA = !BodyStore->IsStatic(BodyA);
+			const bool bDynamicB = !BodyStore->IsStatic(BodyB);
+			const uint64_t UsedColors = (bDynamicA ? SolverBodyColors[BodyA] : 0) | (bDynamicB ? SolverBodyColors[BodyB] : 0);
 
-			ApplyCollisionResponseByContraints(CurrentPair, CurrentResult, minCollideTime * DeltaTime);
+			Color = 0;
+			while (Color < MAX_SOLVER_COLORS && ((UsedColors >> Color) & 1ull))
+			{
+				++Color;
+			}
+			if (Color < MAX_SOLVER_COLORS)
+			{
+				const uint64_t ColorBit = 1ull << Color;
+				if (bDynamicA)
+					SolverBodyColors[BodyA] |= ColorBit;
+				if (bDynamicB)
+					SolverBodyColors[BodyB] |= ColorBit;
+			}
 		}
+		SolverPairColors[j] = static_cast<uint8_t>(Color);
+		++SolverBatchOffsets[Color + 1];
 	}
 
-	for (int j = 0; j < CollisionPairs.size(); ++j)
+	// 색별 개수 -> 시작 위치, 같은 색 안에서는 쌍 순서 유지
+	for (size_t Color = 1; Color < SolverBatchOffsets.size(); ++Color)
 	{
-		auto& CurrentPair = *CollisionPairs[j];
-		auto& CurrentResult = DetectionResults[j];
-		BroadcastCollisionEvents(CurrentPair, CurrentResult);
-		//충돌 정보 저장
-		CurrentPair.bPrevCollided = CurrentResult.bCollided;
-		//수렴 정보 리셋
-		CurrentPair.bConverged = false;
+		SolverBatchOffsets[Color] += SolverBatchOffsets[Color - 1];
 	}
+	std::vector<uint32_t> Cursors(SolverBatchOffsets.begin(), SolverBatchOffsets.end() - 1);
+	for (size_t j = 0; j < PairCount; ++j)
+	{
+		SolverBatchPairs[Cursors[SolverPairColors[j]]++] = static_cast<uint32_t>(j);
+	}
+}
 
-	return minCollideTime;
+void FCollisionProcessor::ForEachSolverBatch(const std::function<void(uint32_t PairIndex)>& InTask)
+{
+	const size_t MinBatchPairs = static_cast<size_t>(std::max(SolverMinBatchPairs, 1));
+	const size_t ChunkSize = static_cast<size_t>(std::max(SolverChunkSize, 1));
+
+	for (size_t Batch = 0; Batch + 1 < SolverBatchOffsets.size(); ++Batch)
+	{
+		const uint32_t* BatchPairs = SolverBatchPairs.data() + SolverBatchOffsets[Batch];
+		const size_t Count = SolverBatchOffsets[Batch + 1] - SolverBatchOffsets[Batch];
+		if (Count == 0)
+			continue;
+
+		// 마지막 묶음은 강체를 공유할 수 있으므로 항상 순차 해결
+		if (Batch < MAX_SOLVER_COLORS && WorkerPool && WorkerPool->ShouldRunParallel(Count, MinBatchPairs))
+		{
+			WorkerPool->ParallelFor(Count, ChunkSize, [BatchPairs, &InTask](size_t Begin, size_t End, size_t) {
+				for (size_t i = Begin; i < End; ++i)
+				{
+					InTask(BatchPairs[i]);
+				}
+				});
+		}
+		else
+		{
+			for (size_t i = 0; i < Count; ++i)
+			{
+				InTask(BatchPairs[i]);
+			}
+		}
+	}
+}
+
+void FCollisionProcessor::SolveContactRows()
+{
+	const size_t MinBatchRows = static_cast<size_t>(std::max(SolverMinBatchPairs, 1));
+	// 덩어리 경계가 레인 경계와 맞아야 덩어리마다 넓은 레인으로 해결
+	const size_t Lane = FContactBatchSolver::LANE_ALIGNMENT;
+	const size_t ChunkSize = (static_cast<size_t>(std::max(SolverChunkSize, 1)) + Lane - 1) / Lane * Lane;
+
+	for (size_t GroupIndex = 0; GroupIndex < ContactSolver.GetGroupCount(); ++GroupIndex)
+	{
+		const FContactBatchSolver::FRowGroup& Group = ContactSolver.GetGroup(GroupIndex);
+		const size_t Count = Group.End - Group.Begin;
+
+		// 강체를 공유할 수 있는 그룹은 항상 스칼라로 순차 해결
+		if (!Group.bConflictFree)
+		{
+			ContactSolver.SolveRows(Group.Begin, Group.End, EPhysicsSimdLevel::Scalar);
+		}
+		else if (WorkerPool && WorkerPool->ShouldRunParallel(Count, MinBatchRows))
+		{
+			const size_t Begin = Group.Begin;
+			WorkerPool->ParallelFor(Count, ChunkSize, [this, Begin](size_t ChunkBegin, size_t ChunkEnd, size_t) {
+				ContactSolver.SolveRows(Begin + ChunkBegin, Begin + ChunkEnd, ContactSimdLevel);
+				});
+		}
+		else
+		{
+			ContactSolver.SolveRows(Group.Begin, Group.End, ContactSimdLevel);
+		}
+	}
+}
+
+std::shared_ptr<UCollisionComponentBase> FCollisionProcessor::LockComponent(size_t TreeId) const
+{
+	auto It = RegisteredComponents.find(TreeId);
+	return It != RegisteredComponents.end() ? It->second.lock() : nullptr;
 }
 
 void FCollisionProcessor::GetPhysicsParams(const std::shared_ptr<UCollisionComponentBase>& InComp, FPhysicsParameters& OutParams ) const
@@ -416,7 +1250,65 @@ void FCollisionProcessor::GetPhysicsParams(const std::shared_ptr<UCollisionCompo
 	return;
 }
 
-void FCollisionProcessor::ApplyCollisionResponseByContraints(const FCollisionPair& CollisionPair, const FCollisionDetectionResult& DetectResult, 
+void FCollisionProcessor::UpdateContactManifold(const FCollisionPair& CollisionPair, const FCollisionDetectionResult& DetectResult) const
+{
+	FContactManifold& Cached = CollisionPair.Manifold;
+	FContactManifold Updated = DetectResult.Manifold;
+	// 다중 접촉점은 쌓인 박스가 기울며 무너짐 - 기본은 충돌 지점 하나로 해결
+	if (!bUseContactManifold && Updated.PointCount > 1)
+	{
+		Updated.PointCount = 0;
+		Updated.AddPoint(DetectResult.Point, DetectResult.PenetrationDepth, 0);
+	}
+
+	// 같은 특징에서 나온 접촉점만 이어받음 - 마찰 축은 법선으로 정해지므로 접선 충격량도 같은 축으로 이어받음
+	for (uint32_t i = 0; i < Updated.PointCount; ++i)
+	{
+		FContactPoint& Point = Updated.Points[i];
+		for (uint32_t k = 0; k < Cached.PointCount; ++k)
+		{
+			if (Cached.Points[k].FeatureId == Point.FeatureId)
+			{
+				Point.AccumulatedNormalImpulse = Cached.Points[k].AccumulatedNormalImpulse * WarmStartFactor;
+				Point.AccumulatedTangentImpulse = Cached.Points[k].AccumulatedTangentImpulse * WarmStartFactor;
+				Point.AccumulatedBitangentImpulse = Cached.Points[k].AccumulatedBitangentImpulse * WarmStartFactor;
+				break;
+			}
+		}
+	}
+	Cached = Updated;
+}
+
+void FCollisionProcessor::WarmStartContacts(const FCollisionPair& CollisionPair, const FCollisionDetectionResult& DetectResult)
+{
+	const FContactManifold& Manifold = CollisionPair.Manifold;
+	if (!DetectResult.bCollided || Manifold.PointCount == 0)
+		return;
+
+	auto ComponentA = LockComponent(CollisionPair.TreeIdA);
+	auto ComponentB = LockComponent(CollisionPair.TreeIdB);
+	auto RigidPtrA = ComponentA ? ComponentA->GetPhysicsStateInternal() : nullptr;
+	auto RigidPtrB = ComponentB ? ComponentB->GetPhysicsStateInternal() : nullptr;
+	if (!RigidPtrA || !RigidPtrB)
+		return;
+
+	Vector3 Tangent, Bitangent;
+	FContactManifold::GetTangentBasis(DetectResult.Normal, Tangent, Bitangent);
+	for (uint32_t i = 0; i < Manifold.PointCount; ++i)
+	{
+		const FContactPoint& Point = Manifold.Points[i];
+		if (Point.AccumulatedNormalImpulse <= 0.0f)
+			continue;
+
+		//A->B 방향의 법선벡터이므로 반대로 적용
+		const Vector3 Impulse = DetectResult.Normal * Point.AccumulatedNormalImpulse +
+			Tangent * Point.AccumulatedTangentImpulse + Bitangent * Point.AccumulatedBitangentImpulse;
+		RigidPtrA->P_ApplyImpulse(-Impulse, Point.Position);
+		RigidPtrB->P_ApplyImpulse(Impulse, Point.Position);
+	}
+}
+
+void FCollisionProcessor::ApplyCollisionResponseByContraints(const FCollisionPair& CollisionPair, const FCollisionDetectionResult& DetectResult,
 															 const float DeltaTime)
 {
 	if (CollisionPair.bConverged)
@@ -424,57 +1316,70 @@ void FCollisionProcessor::ApplyCollisionResponseByContraints(const FCollisionPai
 		return;
 	}
 
-	auto ComponentA = RegisteredComponents[CollisionPair.TreeIdA].lock();
-	auto ComponentB = RegisteredComponents[CollisionPair.TreeIdB].lock();
+	auto ComponentA = LockComponent(CollisionPair.TreeIdA);
+	auto ComponentB = LockComponent(CollisionPair.TreeIdB);
 
 	if (!ComponentA || !ComponentA->GetPhysicsStateInternal() ||
 		!ComponentB || !ComponentB->GetPhysicsStateInternal() ||
 		!DetectResult.bCollided)
 		return;
 
+	auto RigidPtrA = ComponentA.get()->GetPhysicsStateInternal();
+	auto RigidPtrB = ComponentB.get()->GetPhysicsStateInternal();
+
 	FPhysicsParameters ParamsA, ParamsB;
 	GetPhysicsParams(ComponentA, ParamsA);
 	GetPhysicsParams(ComponentB, ParamsB);
 
-	// Warm Starting  람다 재사용
-	FAccumulatedConstraint Accumulation = CollisionPair.PrevConstraints;
-	
-	// 새로운 접촉이면 더 강한 감쇠 적용
-	float dampingFactor = CollisionPair.bPrevCollided ? 0.8f : 0.5f;
-	Accumulation.Scale(dampingFactor);
-
-	//충돌 반응 제약조건 계산
-	FCollisionResponseResult collisionResponse;
-	float BiasSpeed = CalculatePositionBiasVelocity(DetectResult.PenetrationDepth, 0.2f, DeltaTime, 0.01f);
-	Vector3 NormalImpulse = 
-		ResponseCalculator->CalculateNormalImpulse(DetectResult, ParamsA, ParamsB, Accumulation.normalLambda, BiasSpeed);
-	Vector3 FrictionImpulse = 
-		ResponseCalculator->CalculateFrictionImpulse(DetectResult, ParamsA, ParamsB, Accumulation.normalLambda, Accumulation.frictionLambda);
-
-	// 최종 순수 충격량 합산
 	// 마찰에 대한 접선 방향 충격량 약화 계수 (기존 상수 유지)
 	constexpr float TangentCoef = 1.0f;
-	collisionResponse.NetImpulse = (NormalImpulse + TangentCoef * FrictionImpulse);
-	// 충돌 지점 설정
-	collisionResponse.ApplicationPoint = DetectResult.Point;
-	//수렴 조건 확인
-	if (std::fabs(CollisionPair.PrevConstraints.normalLambda - Accumulation.normalLambda) < 1.0f
-		|| collisionResponse.NetImpulse.Length () < KINDA_SMALL)
-	{
-		CollisionPair.bConverged = true;
-		return;
-	}
 
-	auto RigidPtrA = ComponentA.get()->GetPhysicsStateInternal();
-	auto RigidPtrB = ComponentB.get()->GetPhysicsStateInternal();
-	//A->B 방향의 법선벡터이므로 반대로 적용
-	RigidPtrA->P_ApplyImpulse(-collisionResponse.NetImpulse, collisionResponse.ApplicationPoint);
-	RigidPtrB->P_ApplyImpulse(collisionResponse.NetImpulse, collisionResponse.ApplicationPoint);
+	// 접촉점별 결과 - 법선은 쌍 공통, 위치와 침투 깊이만 접촉점 값 사용
+	FCollisionDetectionResult PointResult = DetectResult;
+	bool bPairConverged = true;
+	FContactManifold& Manifold = CollisionPair.Manifold;
+	for (uint32_t i = 0; i < Manifold.PointCount; ++i)
+	{
+		FContactPoint& Contact = Manifold.Points[i];
+		PointResult.Point = Contact.Position;
+		PointResult.PenetrationDepth = Contact.Penetration;
+
+		//충돌 반응 제약조건 계산 - 누적 람다는 접촉점에 보관 (0 이상으로 제한)
+		const float PrevNormalLambda = Contact.AccumulatedNormalImpulse;
+		float BiasSpeed = CalculatePositionBiasVelocity(Contact.Penetration, ContactBiasFactor, DeltaTime, ContactSlop);
+		Vector3 NormalImpulse =
+			ResponseCalculator->CalculateNormalImpulse(PointResult, ParamsA, ParamsB, Contact.AccumulatedNormalImpulse, BiasSpeed);
+		Vector3 FrictionImpulse =
+			ResponseCalculator->CalculateFrictionImpulse(PointResult, ParamsA, ParamsB, Contact.AccumulatedNormalImpulse,
+														 Contact.AccumulatedTangentImpulse, Contact.AccumulatedBitangentImpulse);
+
+		// 최종 순수 충격량 합산
+		FCollisionResponseResult collisionResponse;
+		collisionResponse.NetImpulse = (NormalImpulse + TangentCoef * FrictionImpulse);
+		collisionResponse.ApplicationPoint = Contact.Position;
+
+		//수렴 조건 확인 - 모든 접촉점의 람다 변화가 작으면 쌍 수렴
+		const bool bNegligibleImpulse = collisionResponse.NetImpulse.Length() < KINDA_SMALL;
+		if (std::fabs(PrevNormalLambda - Contact.AccumulatedNormalImpulse) >= 1.0f && !bNegligibleImpulse)
+		{
+			bPairConverged = false;
+		}
+		if (bNegligibleImpulse)
+			continue;
 
-	//LOG("%s", Debug::ToString(collisionResponse.NetImpulse));
+		//A->B 방향의 법선벡터이므로 반대로 적용
+		RigidPtrA->P_ApplyImpulse(-collisionResponse.NetImpulse, collisionResponse.ApplicationPoint);
+		RigidPtrB->P_ApplyImpulse(collisionResponse.NetImpulse, collisionResponse.ApplicationPoint);
 
-	//반응 결과 저장
-	CollisionPair.PrevConstraints = Accumulation;
+		// 다음 접촉점은 갱신된 속도로 계산
+		if (i + 1 < Manifold.PointCount)
+		{
+			GetPhysicsParams(ComponentA, ParamsA);
+			GetPhysicsParams(ComponentB, ParamsB);
+		}
+	}
+
+	CollisionPair.bConverged = bPairConverged;
 }
 
 void FCollisionProcessor::ApplyDirectPositionCorrection(const FCollisionPair& CollisionPair, const FCollisionDetectionResult& DetectionResult, float CorrectionRatio)
@@ -602,9 +1507,6 @@ void FCollisionProcessor::BroadcastCollisionEvents(const FCollisionPair& InPair,
 	if (!CompA || !CompB)
 		return;
 
-	FCollisionEventData EventData;
-	EventData.CollisionDetectResult = DetectionResult;
-
 	ECollisionState NowState = ECollisionState::None;
 	if (InPair.bPrevCollided)
 	{
@@ -631,10 +1533,7 @@ void FCollisionProcessor::BroadcastCollisionEvents(const FCollisionPair& InPair,
 		return;
 	}
 
-	EventData.OtherComponent = CompB;
-	EventDispatcher->DispatchCollisionEvents(CompA, EventData, NowState);
-	EventData.OtherComponent = CompA;
-	EventDispatcher->DispatchCollisionEvents(CompB, EventData, NowState);
+	EventDispatcher->RecordContact(InPair, CompA, CompB, DetectionResult, NowState);
 }
 
 void FCollisionProcessor::PrintTreeStructure() const
@@ -647,3 +1546,45 @@ void FCollisionProcessor::PrintTreeStructure() const
 	LOG("-------------------------------------");
 #endif
 }
+
+void FCollisionProcessor::WriteSnapshot(FPhysicsSnapshotWriter& Writer) const
+{
+	CollisionTree->WriteSnapshot(Writer);
+
+	Writer.Write<uint64_t>(ActiveCollisionPairs.GetCount());
+	for (const FCollisionPair& Pair : ActiveCollisionPairs)
+	{
+		FCollisionPairRecord Record;
+		Record.TreeIdA = Pair.TreeIdA;
+		Record.TreeIdB = Pair.TreeIdB;
+		Record.Manifold = Pair.Manifold;
+		Record.bPrevCollided = Pair.bPrevCollided;
+		Record.bConverged = Pair.bConverged;
+		Writer.Write(Record);
+	}
+}
+
+bool FCollisionProcessor::ReadSnapshot(FPhysicsSnapshotReader& Reader)
+{
+	if (!CollisionTree->ReadSnapshot(Reader))
+		return false;
+
+	uint64_t PairCount = 0;
+	if (!Reader.Read(PairCount))
+		return false;
+
+	// 캡처 시점 순서대로 다시 삽입 - 밀집 배열 순서까지 복원됨
+	ActiveCollisionPairs.Clear();
+	for (uint64_t i = 0; i < PairCount; ++i)
+	{
+		FCollisionPairRecord Record;
+		if (!Reader.Read(Record))
+			return false;
+
+		FCollisionPair& Pair = *ActiveCollisionPairs.FindOrAdd(static_cast<size_t>(Record.TreeIdA), static_cast<size_t>(Record.TreeIdB)).first;
+		Pair.Manifold = Record.Manifold;
+		Pair.bPrevCollided = Record.bPrevCollided != 0;
+		Pair.bConverged = Record.bConverged != 0;
+	}
+	return true;
+}
@@ -2,62 +2,34 @@
 #include "Math.h"
 #include <memory>
 #include <vector>
-#include <unordered_set>
+#include <unordered_map>
+#include <functional>
 #include "CollisionComponent.h"
 #include "CollisionDefines.h"
 #include "DynamicAABBTree.h"
+#include "CollisionPairCache.h"
+#include "SimulationIsland.h"
+#include "PhysicsStats.h"
+#include "ContactBatchSolver.h"
 
 class FDynamicAABBTree;
 struct FTransform;
 class IPhysicsStateInternal;
+class FPhysicsSnapshotWriter;
+class FPhysicsSnapshotReader;
+class FPhysicsWorkerPool;
 
 #pragma region CollisionPair
-struct FCollisionPair
+// 스냅샷용 충돌쌍 기록 - 비트필드 없이 고정 크기로 평탄화
+struct FCollisionPairRecord
 {
-    FCollisionPair(size_t InIdA, size_t InIdB)
-        : TreeIdA(InIdA < InIdB ? InIdA : InIdB)
-        , TreeIdB(InIdA < InIdB ? InIdB : InIdA)
-        , bPrevCollided(false)
-        , bConverged(false)
-    {
-    }
-    FCollisionPair& operator=(const FCollisionPair& Other) = default;
-
-    size_t TreeIdA;
-    size_t TreeIdB;
-
-    mutable FAccumulatedConstraint PrevConstraints;
-    mutable bool bPrevCollided : 1;
-    mutable bool bConverged : 1;
-    //mutable bool bStepSimulateFinished : 1;
-      
-    bool operator==(const FCollisionPair& Other) const
-    {
-        return TreeIdA == Other.TreeIdA && TreeIdB == Other.TreeIdB;
-    }
+    uint64_t TreeIdA;
+    uint64_t TreeIdB;
+    FContactManifold Manifold;
+    uint8_t bPrevCollided;
+    uint8_t bConverged;
 };
-
-//Collisoin Pairs Hash
-namespace std
-{
-    template<>
-    struct hash<FCollisionPair>
-    {
-        size_t operator()(const FCollisionPair& Pair) const {
-            return std::hash<size_t>()(Pair.TreeIdA) ^
-                (std::hash<size_t>()(Pair.TreeIdB) << 1);
-        }
-    };
-}
 #pragma endregion
-struct FContactPoint
-{
-    Vector3 Position;        // 접촉점 위치
-    Vector3 Normal;         // 접촉면 노말
-    float Penetration;      // 침투 깊이
-    float AccumulatedNormalImpulse;   // 누적된 수직 충격량
-    float AccumulatedTangentImpulse;  // 누적된 접선 충격량
-};
 
 /// <summary>
 /// 등록된 컴포넌들의 충돌 현상을 관리
@@ -83,23 +55,159 @@ public:
     void RegisterCollision(std::shared_ptr<UCollisionComponentBase>& NewComponent);
     void UnRegisterCollision(std::shared_ptr<UCollisionComponentBase>& NewComponent);
 
-    // 정규화된 시뮬레이션 소모시간
-    float SimulateCollision(const float DeltaTime);
+    // 정규화된 시뮬레이션 소모시간 - OutStats가 있으면 구간별 시간과 처리량을 누적
+    float SimulateCollision(const float DeltaTime, FPhysicsTickStats* OutStats = nullptr);
     void UnRegisterAll();
+    // 등록된 충돌체가 없을 때 트리/충돌쌍/노드 매핑을 새로 만든 상태로 되돌림 - 설정값은 유지
+    bool ResetState();
 
     size_t GetRegisterComponentsCount() { return RegisteredComponents.size(); }
+    // 충돌체가 속한 지속 충돌쌍 수 - 등록되지 않았으면 0
+    size_t GetPairCountOf(const UCollisionComponentBase& InComponent) const
+    {
+        return ActiveCollisionPairs.GetPairCountOf(FindTreeId(&InComponent));
+    }
+
+    // 마지막 서브스텝의 섬 정보
+    size_t GetIslandCount() const { return IslandCount; }
+    size_t GetSleepingIslandCount() const { return SleepingIslandCount; }
+
+    /// <summary>
+    /// 사용자 충돌쌍 필터 - 층/마스크 검사를 통과한 두 충돌체에 대해 넓은 단계에서 호출, 거짓이면 쌍을 만들지 않음
+    /// 물리 스레드에서 호출되므로 충돌체 상태만 읽어야 함, 바꾸면 기존 쌍도 다음 넓은 단계에서 다시 거름
+    /// </summary>
+    using FCollisionPairFilter = std::function<bool(const UCollisionComponentBase&, const UCollisionComponentBase&)>;
+    void SetPairFilter(FCollisionPairFilter InPairFilter);
+    // 충돌체의 층/마스크 변경 반영 - 다음 넓은 단계에서 그 충돌체의 쌍을 다시 구성
+    void RefreshCollisionFilter(const UCollisionComponentBase& InComponent);
+
+    // 정적 충돌체를 옮긴 뒤 호출 - 정적 리프는 매 스텝 바운드를 검사하지 않음
+    void RefreshStaticBounds(const UCollisionComponentBase& InComponent);
+
+    // 접촉 제약을 SoA 행 일괄 해결기로 해결 - 끄면 쌍 단위 해결
+    void SetUseContactBatchSolver(const bool InBool) { bUseContactBatchSolver = InBool; }
+    bool IsUseContactBatchSolver() const { return bUseContactBatchSolver; }
+
+    // 박스 면 접촉을 최대 4점 다양체로 해결 - 끄면 충돌 지점 하나로 해결
+    void SetUseContactManifold(const bool InBool) { bUseContactManifold = InBool; }
+    bool IsUseContactManifold() const { return bUseContactManifold; }
+
+    // 제약 해결 최대 반복수 - 1 미만은 1로 보정
+    void SetMaxConstraintIterations(const uint16_t InIterations) { MaxConstraintIterations = InIterations > 0 ? InIterations : 1; }
+    uint16_t GetMaxConstraintIterations() const { return MaxConstraintIterations; }
+
+    // 이 속도를 넘는 강체가 포함된 쌍은 CCD로 검사
+    float GetCCDVelocityThreshold() const { return CCDVelocityThreshold; }
+
+    // 충돌체 등록/해제마다 증가 - 스냅샷 복원 가능 여부 판정용
+    uint64_t GetLayoutVersion() const { return LayoutVersion; }
 private:
     void Initialize();
     void Release();
     void CleanupDestroyedComponents();
 
+    // 강체 상태 저장소 연결 - 물리 시스템 초기화 시 호출
+    void BindBodyStore(FPhysicsBodyStore* InBodyStore) { BodyStore = InBodyStore; }
+    // 좁은 단계 병렬 실행용 작업자 풀 연결 - 없으면 단일 스레드로 검사
+    void BindWorkerPool(FPhysicsWorkerPool* InWorkerPool) { WorkerPool = InWorkerPool; }
+    // 접촉 일괄 해결기 SIMD 수준 - 물리 시스템 설정을 따름
+    void SetSimdLevel(const EPhysicsSimdLevel InLevel) { ContactSimdLevel = InLevel; }
+
+    // 충돌쌍을 밀집 배열 순서가 아닌 노드 번호 순으로 처리 - 고정 단계 모드에서 사용
+    void SetCanonicalPairOrder(const bool InBool) { bCanonicalPairOrder = InBool; }
+
+    // 프레임 접촉 보고 - 서브스텝에서는 기록만 하고 프레임 끝에 한 번 전달
+    // 보고는 다음 ClearContactReports까지 유효하므로 Tick 이후 시스템이 한 번에 읽을 수 있음
+    void ClearContactReports();
+    void DispatchContactReports();
+    const std::vector<FCollisionContactReport>& GetContactReports() const;
+
+    // 섬별 충돌 시간으로 해결하고 지역 서브스텝 대상 수집 - 끄면 전체 최저 충돌 시간으로 모든 섬을 해결
+    void SetLocalSubstepping(const bool InBool) { bLocalSubstepping = InBool; }
+
+    // 트리와 충돌쌍 캐시(누적 람다, 이전 충돌 여부) 기록/복원
+    void WriteSnapshot(FPhysicsSnapshotWriter& Writer) const;
+    bool ReadSnapshot(FPhysicsSnapshotReader& Reader);
+
+    // 활성 충돌쌍으로 섬 구성 후 섬 단위 수면 판정
+    void UpdateSimulationIslands(const float DeltaTime);
+
+    // 트리 노드가 수면 중이면 소속 강체를 깨움
+    void WakeCollisionNode(size_t TreeId);
+    // 컴포넌트의 트리 노드 - 등록되지 않았으면 NULL_NODE
+    size_t FindTreeId(const UCollisionComponentBase* InComponent) const;
+    // 노드와 그 노드의 충돌쌍 제거 - 비용은 노드의 쌍 수에 비례
+    void RemoveCollisionNode(size_t TreeId);
+
+    FPhysicsBodyId GetTreeBodyId(size_t TreeId) const
+    {
+        return TreeId < TreeBodyIds.size() ? TreeBodyIds[TreeId] : FPhysicsBodyStore::INVALID_BODY;
+    }
+    // 동적 강체쪽 섬 번호, 둘다 정적이면 NO_ISLAND
+    uint32_t GetPairIslandIndex(const FCollisionPair& Pair) const;
+
     float ProcessCollisions(const float DeltaTime);
 
+    /// <summary>
+    /// 지역 서브스텝 - 마지막 SimulateCollision에서 이른 충돌이 난 섬 중 InBodies가 속한 섬의 쌍만 다시 검사/해결
+    /// 넓은 단계와 섬 구성은 다시 하지 않으며, 대상 섬의 충돌 시간을 갱신함
+    /// </summary>
+    float SimulateLocalCollision(const std::vector<FPhysicsBodyId>& InBodies, const float DeltaTime,
+                                 FPhysicsTickStats* OutStats = nullptr);
+
+    // 이른 충돌(ToI < 1)로 지역 서브스텝이 필요한 섬의 동적 강체
+    void GetLocalSubstepBodies(std::vector<FPhysicsBodyId>& OutBodies) const;
+
+    // 강체가 속한 섬의 정규화된 충돌 시간 - 섬이 없거나 충돌이 없으면 1
+    float GetBodyTimeOfImpact(FPhysicsBodyId BodyId) const;
+    float GetIslandTimeOfImpact(uint32_t Island) const;
+
+    // 좁은 단계 - 후보 쌍을 작업자 풀로 나눠 검사하고 충돌한 쌍만 후보 순서대로 수집, 최저 충돌 시간 반환
+    // 결과는 후보 위치에 기록 후 순서대로 병합하므로 스레드 수와 무관하게 동일
+    // bFromBodyStore면 컴포넌트 대신 저장소의 강체 트랜스폼으로 검사 (지역 서브스텝 도중)
+    float DetectPairs(const std::vector<const FCollisionPair*>& InCandidates, const float DeltaTime,
+                      std::vector<const FCollisionPair*>& OutPairs,
+                      std::vector<FCollisionDetectionResult>& OutResults,
+                      const bool bFromBodyStore = false);
+    // 쌍 하나의 좁은 단계 검사 - 속도에 따라 CCD/DCD 선택, 작업자 스레드에서 호출됨
+    bool DetectPair(UCollisionComponentBase& CompA, UCollisionComponentBase& CompB, const float DeltaTime,
+                    FCollisionDetectionResult& OutResult) const;
+    // 저장소 트랜스폼으로 검사 - CCD는 단계 시작 자세에서 현재 자세까지 쓸어 검사
+    bool DetectPairFromBodyStore(const FCollisionPair& InPair, UCollisionComponentBase& CompA, UCollisionComponentBase& CompB,
+                                 const float DeltaTime, FCollisionDetectionResult& OutResult) const;
+    // 충돌체의 단계 시작/현재 월드 트랜스폼 - 연결된 강체의 저장소 상태에 충돌체 로컬 트랜스폼을 적용
+    void GetBodyStoreTransforms(const UCollisionComponentBase& InComponent, FPhysicsBodyId InBodyId,
+                                FTransform& OutPrevTransform, FTransform& OutTransform) const;
+
+    // 충돌 결과로 섬별 최저 충돌 시간 갱신
+    void UpdateIslandTimeOfImpacts(const std::vector<FCollisionDetectionResult>& DetectionResults,
+                                   const std::vector<uint32_t>& PairIslands);
+
+    // 이른 충돌 섬과 그 섬의 활성 쌍 수집
+    void CollectLocalSubstepPairs();
+
+    // 수집된 충돌 위치 보정, 섬 단위 제약 해결, 이벤트 전달
+    void ResolveCollisions(const std::vector<const FCollisionPair*>& CollisionPairs,
+                           const std::vector<FCollisionDetectionResult>& DetectionResults,
+                           const std::vector<uint32_t>& PairIslands,
+                           const float MinCollideTime, const float DeltaTime);
+
+    // 제약 해결 묶음 구성 - 탐욕적 그래프 색칠로 동적 강체를 공유하지 않는 쌍끼리 같은 묶음에 모음
+    // 정적 강체는 충격량을 받지 않으므로 충돌로 보지 않음, 색이 모자라거나 강체를 모르는 쌍은 마지막 묶음에서 순차 해결
+    void BuildSolverBatches(const std::vector<const FCollisionPair*>& CollisionPairs);
+    // 묶음 순서대로 쌍 번호마다 InTask 실행 - 묶음 안에서는 작업자 풀로 병렬 실행
+    // 묶음 안의 쌍은 강체를 공유하지 않으므로 결과는 스레드 수와 무관하게 동일
+    void ForEachSolverBatch(const std::function<void(uint32_t PairIndex)>& InTask);
+    // 접촉 행 그룹을 순서대로 한 번 해결 - 강체를 공유하지 않는 큰 그룹은 레인 경계로 나눠 병렬 실행
+    void SolveContactRows();
+
     //CCD 임계속도 비교
     bool ShouldUseCCD(const IPhysicsStateInternal * PhysicsStateInternal) const;
 
     //새로운 충돌쌍 업데이트
     void UpdateCollisionPairs();
+    // 층/마스크와 사용자 필터 검사
+    bool ShouldCreatePair(const UCollisionComponentBase& InComponentA, const UCollisionComponentBase& InComponentB) const;
 
     //컴포넌트 트랜스폼 업데이트
     void UpdateCollisionTransform();
@@ -107,7 +215,13 @@ private:
     //내부 연산을 위한 데이터 구조체 생성
     void GetPhysicsParams(const std::shared_ptr<UCollisionComponentBase>& InComp, FPhysicsParameters& Result) const;
 
-    //제약조건 기반 반복적 해결 - 충돌 반응
+    // 새 접촉점을 쌍의 다양체와 특징 번호로 맞춰 누적 수직/접선 충격량을 이어받음
+    void UpdateContactManifold(const FCollisionPair& CollisionPair, const FCollisionDetectionResult& DetectResult) const;
+    // 이어받은 수직/접선 충격량을 반복 전에 미리 적용 (웜 스타트)
+    void WarmStartContacts(const FCollisionPair& CollisionPair, const FCollisionDetectionResult& DetectResult);
+    // 작업자 스레드에서 호출될 수 있는 컴포넌트 조회 - 컨테이너를 수정하지 않음
+    std::shared_ptr<UCollisionComponentBase> LockComponent(size_t TreeId) const;
+    //제약조건 기반 반복적 해결 - 충돌 반응, 다양체의 접촉점마다 누적 충격량으로 해결
     void ApplyCollisionResponseByContraints(const FCollisionPair& CollisionPair,
                                             const FCollisionDetectionResult& DetectResult, const float DeltaTime);
     // 순수 좌표 기반 위치 보정 적용 
@@ -144,6 +258,7 @@ private:
     ) const;
 
 
+    // 충돌 상태 전이를 접촉 보고 버퍼에 기록 - 델리게이트는 DispatchContactReports에서 전달
     void BroadcastCollisionEvents(
         const FCollisionPair& InPair,
         const FCollisionDetectionResult& DetectResult);
@@ -163,12 +278,75 @@ private:
     // 컴포넌트 관리
     //std::vector<FComponentData> RegisteredComponents; 
     std::unordered_map<size_t, std::weak_ptr<UCollisionComponentBase>> RegisteredComponents;
+    // 컴포넌트 -> 트리 노드 역맵, 노드 -> 컴포넌트 주소 (소멸한 컴포넌트의 역맵 항목 정리용)
+    std::unordered_map<const UCollisionComponentBase*, size_t> ComponentTreeIds;
+    std::vector<const UCollisionComponentBase*> TreeComponents;
     FDynamicAABBTree* CollisionTree = nullptr;
-    std::unordered_set<FCollisionPair> ActiveCollisionPairs;
+    FCollisionPairCache ActiveCollisionPairs;                  // 움직인 리프만 갱신하는 지속 충돌쌍
+    std::vector<uint8_t> MovedNodeMask;                         // 트리 노드 -> 이번 갱신에서 움직였는지
+
+    // 시뮬레이션 섬
+    FPhysicsBodyStore* BodyStore = nullptr;
+    FSimulationIslandGraph IslandGraph;
+    std::vector<FPhysicsBodyId> TreeBodyIds;        // 트리 노드 -> 강체 슬롯
+    size_t IslandCount = 0;
+    size_t SleepingIslandCount = 0;
+
+    // 지역 서브스텝 - 섬별 최저 충돌 시간과 이른 충돌 섬의 활성 쌍 (ActiveCollisionPairs 밀집 배열 원소를 가리킴)
+    std::vector<float> IslandTimeOfImpacts;
+    std::vector<uint32_t> LocalSubstepIslands;
+    std::vector<const FCollisionPair*> LocalSubstepPairs;
+    // 좁은 단계 작업 버퍼 - 후보 위치로 기록하며 재사용
+    FPhysicsWorkerPool* WorkerPool = nullptr;
+    std::vector<const FCollisionPair*> NarrowphaseCandidates;
+    std::vector<FCollisionDetectionResult> NarrowphaseResults;
+    std::vector<uint8_t> NarrowphaseHits;
+    // 트리 노드 -> 컴포넌트, 검사 직전 노드마다 한 번만 확인 (검사 동안에는 사용자 코드가 실행되지 않음)
+    std::vector<UCollisionComponentBase*> NarrowphaseComponents;
+    std::vector<uint32_t> NarrowphaseStamps;
+    uint32_t NarrowphaseStamp = 0;
+    // 제약 해결 묶음 - 색 번호 순서로 정렬한 쌍 번호, 마지막 묶음은 순차 해결
+    static constexpr uint32_t MAX_SOLVER_COLORS = 64;
+    std::vector<uint32_t> SolverBatchPairs;
+    std::vector<uint32_t> SolverBatchOffsets;      // 묶음 i = [Offsets[i], Offsets[i + 1])
+    std::vector<uint8_t> SolverPairColors;
+    std::vector<uint64_t> SolverBodyColors;         // 강체 슬롯 -> 이미 쓰인 색 비트
+    std::vector<float> SolverPairTimes;             // 쌍별 해결 시간 (지역 서브스텝이면 섬의 충돌 시간)
+    std::vector<uint8_t> SolverIslandConverged;     // 섬 -> 수렴 여부, 마지막 칸은 섬 없는 쌍
+    std::vector<uint32_t> SolverIslandIterations;
+    // 접촉 일괄 해결기 - 쌍마다 A, B 강체 슬롯, 반복마다 해결할 쌍
+    FContactBatchSolver ContactSolver;
+    std::vector<FPhysicsBodyId> SolverPairBodies;
+    std::vector<uint8_t> SolverPairActivity;
+    EPhysicsSimdLevel ContactSimdLevel = EPhysicsSimdLevel::AVX2;
+
+    FCollisionPairFilter PairFilter;
+
+    // SimulateCollision 동안만 유효한 통계 누적 대상
+    FPhysicsTickStats* TickStats = nullptr;
+
+    uint64_t LayoutVersion = 0;
 
 private:
     float CCDVelocityThreshold = 3.0f;              // CCD 활성화 속도 임계값
     size_t InitialCollisonCapacity = 512;           // 초기 컴포넌트 및 트리 용량/
     uint16_t MaxConstraintIterations = 10;          // 제약조건 해결 최대 반복수
+    float WarmStartFactor = 0.9f;                   // 이어받은 접촉점 충격량 비율
     float FatBoundsExtentRatio = 0.1f;             // AABB 여유 공간
+
+    bool bEnableSleeping = true;                    // 섬 단위 수면 사용 여부
+    float SleepLinearVelocityThreshold = 5.0f;      // 수면 판정 선속도 임계값 (cm/s)
+    float SleepAngularVelocityThreshold = 0.05f;    // 수면 판정 각속도 임계값 (rad/s)
+    float TimeToSleep = 0.5f;                       // 임계값 아래에 머물러야 하는 시간
+
+    int NarrowphaseChunkSize = 32;                  // 좁은 단계 병렬 덩어리 크기
+    int NarrowphaseMinPairs = 128;                  // 스레드당 최소 검사 쌍 수 - 못 미치면 단일 스레드로 검사
+    int SolverChunkSize = 16;                       // 제약 해결 묶음의 병렬 덩어리 크기
+    int SolverMinBatchPairs = 64;                   // 스레드당 최소 해결 쌍 수 - 못 미치는 묶음은 단일 스레드로 해결
+    bool bUseContactBatchSolver = true;             // SoA 접촉 행 일괄 해결 사용 여부
+    bool bUseContactManifold = false;               // 다중 접촉점 다양체 사용 여부
+
+    bool bCanonicalPairOrder = false;               // 충돌쌍 처리 순서 고정 여부
+    bool bLocalSubstepping = false;                 // 이른 충돌 섬만 지역 서브스텝 진행
+    float MinSolveTime = 0.004f;                    // 접촉 해결 시간 하한 - 적분 최소 틱 시간과 같음
 };
\ No newline at end of file
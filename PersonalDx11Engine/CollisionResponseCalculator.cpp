@@ -44,9 +44,10 @@ Vector3 FCollisionResponseCalculator::CalculateNormalImpulse(const FCollisionDet
 
 Vector3 FCollisionResponseCalculator::CalculateFrictionImpulse(const FCollisionDetectionResult& DetectionResult,
                                                                const FPhysicsParameters& ParameterA, const FPhysicsParameters& ParameterB,
-                                                               float NormalLambda, float& InOutFrictionLambda) const
+                                                               float NormalLambda, float& InOutTangentLambda,
+                                                               float& InOutBitangentLambda) const
 {
-    // 법선 방향 성분 제거하여 접선 방향 상대 속도 계산
+    // 법선 방향 성분 제거하여 접선 방향 상대 속도 계산 - 정지/운동 마찰 선택용
     XMVECTOR vRelativeVel = FVelocityConstraint::CalculateRelativeVelocity(
         ParameterA, ParameterB, XMLoadFloat3(&DetectionResult.Point));
 
@@ -57,30 +58,28 @@ Vector3 FCollisionResponseCalculator::CalculateFrictionImpulse(const FCollisionD
     XMVECTOR vTangentVel = XMVectorSubtract(vRelativeVel, vNormalComponent);
 
     float TangentLength = XMVectorGetX(XMVector3Length(vTangentVel));
-    Vector3 TangentImpulse = Vector3::Zero();
 
-    if (TangentLength > KINDA_SMALL)
-    {
-        // 접선 방향 정규화
-        XMVECTOR vTangent = XMVectorDivide(vTangentVel, XMVectorReplicate(TangentLength));
-        Vector3 Tangent;
-        XMStoreFloat3(&Tangent, vTangent);
+    float StaticFriction = (ParameterA.FrictionStatic + ParameterB.FrictionStatic) * 0.5f;
+    float KineticFriction = (ParameterA.FrictionKinetic + ParameterB.FrictionKinetic) * 0.5f;
+
+    // 미끄러지는 방향을 축으로 쓰면 반복/단계마다 축이 바뀌어 누적 람다가 의미를 잃고
+    // 접촉점을 도는 순서대로 남은 오차가 한쪽 회전으로 쌓임 - 법선에서 정한 고정 축 두 개로 해결
+    Vector3 Tangents[2];
+    FContactManifold::GetTangentBasis(DetectionResult.Normal, Tangents[0], Tangents[1]);
+    float* Lambdas[2] = { &InOutTangentLambda, &InOutBitangentLambda };
 
-        // 접선 방향 제약 조건 (마찰력)
+    Vector3 TangentImpulse = Vector3::Zero();
+    for (int Axis = 0; Axis < 2; ++Axis)
+    {
         // 마찰은 속도를 0으로 만드는 것이 목표이므로 DesiredSpeed는 0.0f
-        FVelocityConstraint FrictionConstraint(Tangent, 0.0f);
+        FVelocityConstraint FrictionConstraint(Tangents[Axis], 0.0f);
         FrictionConstraint.SetContactData(DetectionResult.Point, DetectionResult.Normal);
 
-        // Warm Starting: 이전 프레임의 마찰 람다 재사용
-        TangentImpulse = FrictionConstraint.Solve(ParameterA, ParameterB, InOutFrictionLambda);
-
-        // 마찰력 크기 제한 (Coulomb 마찰 모델)
-        float StaticFriction = (ParameterA.FrictionStatic + ParameterB.FrictionStatic) * 0.5f;
-        float KineticFriction = (ParameterA.FrictionKinetic + ParameterB.FrictionKinetic) * 0.5f;
-
-        // 마찰 클램핑
-        ClampFriction(TangentLength, NormalLambda, StaticFriction, KineticFriction,
-                      InOutFrictionLambda, TangentImpulse);
+        // Warm Starting: 이전 단계의 마찰 람다에서 시작, 한계로 제한된 누적 람다의 변화만 적용
+        const float OldLambda = *Lambdas[Axis];
+        FrictionConstraint.Solve(ParameterA, ParameterB, *Lambdas[Axis]);
+        ClampFriction(TangentLength, NormalLambda, StaticFriction, KineticFriction, *Lambdas[Axis]);
+        TangentImpulse += Tangents[Axis] * (*Lambdas[Axis] - OldLambda);
     }
 
     return TangentImpulse;
@@ -90,8 +89,7 @@ void FCollisionResponseCalculator::ClampFriction(const float TangentRelativeVelo
                                                  const float NormalLambda,
                                                  const float StaticFriction,
                                                  const float KineticFriction,
-                                                 float& OutFrictionLambda,
-                                                 Vector3& OutTangentImpulse) const
+                                                 float& OutFrictionLambda) const
 {
     // 정적 마찰과 운동 마찰 적용 (Coulomb Friction Model)
     float maxFrictionImpulse = NormalLambda; // 람다는 이미 스케일링된 값이라고 가정 (충격량 크기)
@@ -107,10 +105,4 @@ void FCollisionResponseCalculator::ClampFriction(const float TangentRelativeVelo
 
     // 마찰 람다를 계산된 최대 임펄스 값으로 클램핑
     OutFrictionLambda = Math::Clamp(OutFrictionLambda, -maxFrictionImpulse, maxFrictionImpulse);
-    // 마찰 임펄스도 클램프
-    float currentTangentImpulseMagnitude = OutTangentImpulse.Length();
-    if (currentTangentImpulseMagnitude > maxFrictionImpulse)
-    {
-        OutTangentImpulse = OutTangentImpulse * (maxFrictionImpulse / currentTangentImpulseMagnitude);
-    }
-}
\ No newline at end of file
+}
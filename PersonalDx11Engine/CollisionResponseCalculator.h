@@ -18,23 +18,24 @@ public:
         float BiasSpeed = 0.0f   // 외부에서 결정된 편향 속도
     ) const;
 
-    // 마찰 방향 충격량 계산
+    // 마찰 방향 충격량 계산 - 법선에서 정한 고정 접선 두 축(FContactManifold::GetTangentBasis)으로 해결
     Vector3 CalculateFrictionImpulse(
         const FCollisionDetectionResult& DetectionResult,
         const FPhysicsParameters& ParameterA,
         const FPhysicsParameters& ParameterB,
         float NormalLambda,        // 법선 람다 (마찰 제한용)
-        float& InOutFrictionLambda   // 초기 람다이자 출력
+        float& InOutTangentLambda,   // 첫째 축 초기 람다이자 출력
+        float& InOutBitangentLambda  // 둘째 축 초기 람다이자 출력
     ) const;
 
 private:
 
+    // 누적 마찰 람다를 Coulomb 한계로 제한
     void ClampFriction(const float TangentRelativeVelocityLength,
         const float NormalLambda,
         const float StaticFriction,
         const float KineticFriction,
-        float& OutFrictionLambda,
-        Vector3& OutTangentImpulse) const;
+        float& OutFrictionLambda) const;
 
  
 };
@@ -2,12 +2,13 @@
 #include "Math.h"
 #include "Transform.h"
 
-// 충돌체 형태 정의
+// 충돌체 형태 정의 - 추가 시 FCollisionDetector의 형상 쌍 검사 표에 행/열이 함께 생김
 enum class ECollisionShapeType
 {
     None,
     Box,
-    Sphere
+    Sphere,
+    Count
 };
 
 class ICollisionShape
@@ -0,0 +1,391 @@
+#include "ContactBatchSolver.h"
+#include "ContactBatchSolverLanes.h"
+#include <algorithm>
+
+namespace
+{
+    using namespace PhysicsSimd;
+
+    // P_ApplyImpulse가 충격량을 적용하는 강체: 살아있고 활성이며 정적이 아닌 슬롯
+    constexpr uint8_t DYNAMIC_FLAG_MASK = FPhysicsBodyStore::BODY_ALIVE | FPhysicsBodyStore::BODY_ACTIVE |
+        FPhysicsBodyStore::BODY_STATIC;
+    constexpr uint8_t DYNAMIC_FLAG_VALUE = FPhysicsBodyStore::BODY_ALIVE | FPhysicsBodyStore::BODY_ACTIVE;
+
+    // 대칭 역관성 텐서 (XX, XY, XZ, YY, YZ, ZZ)로 (R x D)의 회전 기여도 계산
+    float AngularTerm(const Vector3& Radius, const Vector3& Direction, const float* Tensor)
+    {
+        const Vector3 C = Vector3::Cross(Radius, Direction);
+        const Vector3 IC(Tensor[0] * C.x + Tensor[1] * C.y + Tensor[2] * C.z,
+                         Tensor[1] * C.x + Tensor[3] * C.y + Tensor[4] * C.z,
+                         Tensor[2] * C.x + Tensor[4] * C.y + Tensor[5] * C.z);
+        return Vector3::Dot(C, IC);
+    }
+}
+
+void FContactBatchSolver::Build(const FPhysicsBodyStore& Store,
+                                const std::vector<const FCollisionPair*>& Pairs,
+                                const std::vector<FCollisionDetectionResult>& Results,
+                                const std::vector<FPhysicsBodyId>& PairBodies,
+                                const std::vector<float>& PairTimes,
+                                const std::vector<uint32_t>& BatchPairs,
+                                const std::vector<uint32_t>& BatchOffsets,
+                                size_t ConflictFreeBatchCount,
+                                float BiasFactor, float Slop)
+{
+    for (std::vector<float>& Channel : RowChannels)
+    {
+        Channel.clear();
+    }
+    RowBodyA.clear();
+    RowBodyB.clear();
+    RowPairs.clear();
+    RowPoints.clear();
+    Groups.clear();
+
+    for (std::vector<float>& Channel : BodyChannels)
+    {
+        Channel.assign(1, 0.0f);
+    }
+    BodyIds.assign(1, FPhysicsBodyStore::INVALID_BODY);
+    BodySlots.assign(Store.GetCapacity(), STATIC_BODY);
+    PairActivity.assign(Pairs.size(), 0);
+    PairUnconverged.assign(Pairs.size(), 0);
+
+    auto AddPairRow = [&](uint32_t PairIndex, uint32_t PointIndex) {
+        AddRow(Store, PairIndex, PointIndex, *Pairs[PairIndex], Results[PairIndex],
+               PairBodies[PairIndex * 2], PairBodies[PairIndex * 2 + 1], PairTimes[PairIndex], BiasFactor, Slop);
+        };
+    // 물리 상태가 없는 쪽이 있으면 기존 경로와 같이 해결하지 않음
+    auto IsSolvable = [&](uint32_t PairIndex) {
+        return Results[PairIndex].bCollided &&
+            PairBodies[PairIndex * 2] < Store.GetCapacity() && PairBodies[PairIndex * 2 + 1] < Store.GetCapacity();
+        };
+
+    const size_t BatchCount = BatchOffsets.empty() ? 0 : BatchOffsets.size() - 1;
+    for (size_t Batch = 0; Batch < BatchCount; ++Batch)
+    {
+        const uint32_t BatchBegin = BatchOffsets[Batch];
+        const uint32_t BatchEnd = BatchOffsets[Batch + 1];
+        if (BatchBegin == BatchEnd)
+            continue;
+
+        if (Batch < ConflictFreeBatchCount)
+        {
+            // 접촉점 번호별로 그룹 - 그룹 안의 행은 모두 다른 쌍, 레인 폭에 맞춰 빈 행으로 채움
+            for (uint32_t Point = 0; Point < FContactManifold::MAX_POINTS; ++Point)
+            {
+                FRowGroup Group;
+                Group.Begin = static_cast<uint32_t>(RowPairs.size());
+                for (uint32_t k = BatchBegin; k < BatchEnd; ++k)
+                {
+                    const uint32_t PairIndex = BatchPairs[k];
+                    if (IsSolvable(PairIndex) && Point < Pairs[PairIndex]->Manifold.PointCount)
+                    {
+                        AddPairRow(PairIndex, Point);
+                    }
+                }
+                if (RowPairs.size() == Group.Begin)
+                    continue;
+
+                while ((RowPairs.size() - Group.Begin) % LANE_ALIGNMENT != 0)
+                {
+                    AddEmptyRow();
+                }
+                Group.End = static_cast<uint32_t>(RowPairs.size());
+                Groups.push_back(Group);
+            }
+        }
+        else
+        {
+            // 강체를 공유할 수 있는 쌍 - 쌍 순서대로 한 그룹에서 순차 해결
+            FRowGroup Group;
+            Group.Begin = static_cast<uint32_t>(RowPairs.size());
+            Group.bConflictFree = false;
+            for (uint32_t k = BatchBegin; k < BatchEnd; ++k)
+            {
+                const uint32_t PairIndex = BatchPairs[k];
+                if (!IsSolvable(PairIndex))
+                    continue;
+                for (uint32_t Point = 0; Point < Pairs[PairIndex]->Manifold.PointCount; ++Point)
+                {
+                    AddPairRow(PairIndex, Point);
+                }
+            }
+            Group.End = static_cast<uint32_t>(RowPairs.size());
+            if (Group.End != Group.Begin)
+            {
+                Groups.push_back(Group);
+            }
+        }
+    }
+
+    // 이어받은 충격량을 먼저 적용하고 반복은 남은 차이만 해결
+    for (size_t Row = 0; Row < RowPairs.size(); ++Row)
+    {
+        WarmStartRow(Row);
+    }
+}
+
+uint32_t FContactBatchSolver::AcquireBody(const FPhysicsBodyStore& Store, FPhysicsBodyId BodyId)
+{
+    // 충격량을 받지 않는 강체(정적/비활성/없음)는 빈 강체로 대신함
+    if (BodyId >= BodySlots.size() || (Store.Flags[BodyId] & DYNAMIC_FLAG_MASK) != DYNAMIC_FLAG_VALUE)
+        return STATIC_BODY;
+    if (BodySlots[BodyId] != STATIC_BODY)
+        return BodySlots[BodyId];
+
+    const uint32_t Slot = static_cast<uint32_t>(BodyIds.size());
+    BodyIds.push_back(BodyId);
+    const Vector3& Velocity = Store.Velocities[BodyId];
+    const Vector3& AngularVelocity = Store.AngularVelocities[BodyId];
+    BodyChannels[BODY_VELOCITY_X].push_back(Velocity.x);
+    BodyChannels[BODY_VELOCITY_Y].push_back(Velocity.y);
+    BodyChannels[BODY_VELOCITY_Z].push_back(Velocity.z);
+    BodyChannels[BODY_ANGULAR_X].push_back(AngularVelocity.x);
+    BodyChannels[BODY_ANGULAR_Y].push_back(AngularVelocity.y);
+    BodyChannels[BODY_ANGULAR_Z].push_back(AngularVelocity.z);
+    BodySlots[BodyId] = Slot;
+    return Slot;
+}
+
+void FContactBatchSolver::AddRow(const FPhysicsBodyStore& Store, uint32_t PairIndex, uint32_t PointIndex,
+                                 const FCollisionPair& Pair, const FCollisionDetectionResult& Result,
+                                 FPhysicsBodyId BodyIdA, FPhysicsBodyId BodyIdB, float SolveTime, float BiasFactor, float Slop)
+{
+    const FContactPoint& Contact = Pair.Manifold.Points[PointIndex];
+    const uint32_t SlotA = AcquireBody(Store, BodyIdA);
+    const uint32_t SlotB = AcquireBody(Store, BodyIdB);
+    RowBodyA.push_back(SlotA);
+    RowBodyB.push_back(SlotB);
+    RowPairs.push_back(PairIndex);
+    RowPoints.push_back(static_cast<uint8_t>(PointIndex));
+
+    auto Push = [this](ERowChannel Channel, float Value) { RowChannels[Channel].push_back(Value); };
+
+    // 강체별 값 - 빈 강체는 질량/관성 역수 0 (GetPhysicsParams의 정적 강체와 동일)
+    struct FBodyRowData
+    {
+        float InvMass = 0.0f;
+        Vector3 Radius = Vector3::Zero();
+        Vector3 InvInertia = Vector3::Zero();
+        float Tensor[6] = {};
+    };
+    auto MakeBodyData = [&Store, &Contact](uint32_t Slot, FPhysicsBodyId BodyId) {
+        FBodyRowData Data;
+        if (Slot == STATIC_BODY)
+            return Data;
+
+        Data.InvMass = Store.InvMasses[BodyId];
+        Data.Radius = Contact.Position - Store.Positions[BodyId];
+        Data.InvInertia = Store.InvRotationalInertias[BodyId];
+
+        // 월드 역관성 텐서 - FVelocityConstraint::CalculateInvEffectiveMass와 같은 식
+        const Quaternion& Rotation = Store.Rotations[BodyId];
+        const XMMATRIX Rot = XMMatrixRotationQuaternion(XMLoadFloat4(&Rotation));
+        const XMMATRIX Tensor = Rot * XMMatrixScalingFromVector(XMLoadFloat3(&Data.InvInertia)) * XMMatrixTranspose(Rot);
+        XMFLOAT4X4 M;
+        XMStoreFloat4x4(&M, Tensor);
+        Data.Tensor[0] = M.m[0][0];
+        Data.Tensor[1] = M.m[0][1];
+        Data.Tensor[2] = M.m[0][2];
+        Data.Tensor[3] = M.m[1][1];
+        Data.Tensor[4] = M.m[1][2];
+        Data.Tensor[5] = M.m[2][2];
+        return Data;
+        };
+    const FBodyRowData A = MakeBodyData(SlotA, BodyIdA);
+    const FBodyRowData B = MakeBodyData(SlotB, BodyIdB);
+    const Vector3& Normal = Result.Normal;
+
+    Push(ROW_NORMAL_X, Normal.x);
+    Push(ROW_NORMAL_Y, Normal.y);
+    Push(ROW_NORMAL_Z, Normal.z);
+    Push(ROW_RADIUS_A_X, A.Radius.x);
+    Push(ROW_RADIUS_A_Y, A.Radius.y);
+    Push(ROW_RADIUS_A_Z, A.Radius.z);
+    Push(ROW_RADIUS_B_X, B.Radius.x);
+    Push(ROW_RADIUS_B_Y, B.Radius.y);
+    Push(ROW_RADIUS_B_Z, B.Radius.z);
+    Push(ROW_INV_MASS_A, A.InvMass);
+    Push(ROW_INV_MASS_B, B.InvMass);
+    Push(ROW_INV_INERTIA_A_X, A.InvInertia.x);
+    Push(ROW_INV_INERTIA_A_Y, A.InvInertia.y);
+    Push(ROW_INV_INERTIA_A_Z, A.InvInertia.z);
+    Push(ROW_INV_INERTIA_B_X, B.InvInertia.x);
+    Push(ROW_INV_INERTIA_B_Y, B.InvInertia.y);
+    Push(ROW_INV_INERTIA_B_Z, B.InvInertia.z);
+
+    // 수직/마찰 방향 유효 질량 - 접촉점과 법선, 마찰 축은 스텝 동안 고정
+    auto EffectiveMass = [&A, &B](const Vector3& Direction) {
+        const float InvMass = A.InvMass + B.InvMass +
+            AngularTerm(A.Radius, Direction, A.Tensor) + AngularTerm(B.Radius, Direction, B.Tensor);
+        return InvMass < KINDA_SMALL ? 0.0f : 1.0f / InvMass;
+        };
+    Push(ROW_NORMAL_MASS, EffectiveMass(Normal));
+
+    Vector3 Tangent, Bitangent;
+    FContactManifold::GetTangentBasis(Normal, Tangent, Bitangent);
+    Push(ROW_TANGENT_X, Tangent.x);
+    Push(ROW_TANGENT_Y, Tangent.y);
+    Push(ROW_TANGENT_Z, Tangent.z);
+    Push(ROW_BITANGENT_X, Bitangent.x);
+    Push(ROW_BITANGENT_Y, Bitangent.y);
+    Push(ROW_BITANGENT_Z, Bitangent.z);
+    Push(ROW_TANGENT_MASS, EffectiveMass(Tangent));
+    Push(ROW_BITANGENT_MASS, EffectiveMass(Bitangent));
+
+    // CalculatePositionBiasVelocity와 동일 - Slop 초과의 침투만 보정
+    const float BiasPenetration = std::max(0.0f, Contact.Penetration - Slop * ONE_METER);
+    Push(ROW_BIAS, BiasPenetration > KINDA_SMALL && SolveTime > 0.0f ? BiasPenetration * BiasFactor / SolveTime : 0.0f);
+
+    // 재질 - 쌍 평균
+    Push(ROW_RESTITUTION, std::min(0.9999f, (Store.Restitutions[BodyIdA] + Store.Restitutions[BodyIdB]) * 0.5f));
+    Push(ROW_FRICTION, (Store.FrictionKinetics[BodyIdA] + Store.FrictionKinetics[BodyIdB]) * 0.5f);
+
+    Push(ROW_NORMAL_LAMBDA, Contact.AccumulatedNormalImpulse);
+    Push(ROW_TANGENT_LAMBDA, Contact.AccumulatedTangentImpulse);
+    Push(ROW_BITANGENT_LAMBDA, Contact.AccumulatedBitangentImpulse);
+    Push(ROW_ACTIVE, 0.0f);
+    Push(ROW_UNCONVERGED, 0.0f);
+}
+
+void FContactBatchSolver::AddEmptyRow()
+{
+    // 빈 강체끼리의 비활성 행 - 해결해도 값이 바뀌지 않음
+    RowBodyA.push_back(STATIC_BODY);
+    RowBodyB.push_back(STATIC_BODY);
+    RowPairs.push_back(INVALID_PAIR);
+    RowPoints.push_back(0);
+    for (std::vector<float>& Channel : RowChannels)
+    {
+        Channel.push_back(0.0f);
+    }
+}
+
+void FContactBatchSolver::WarmStartRow(size_t Row)
+{
+    const float Lambda = RowChannels[ROW_NORMAL_LAMBDA][Row];
+    if (Lambda <= 0.0f)
+        return;
+
+    auto RowVector = [this, Row](ERowChannel ChannelX) {
+        return Vector3(RowChannels[ChannelX][Row], RowChannels[ChannelX + 1][Row], RowChannels[ChannelX + 2][Row]);
+        };
+    const Vector3 Impulse = RowVector(ROW_NORMAL_X) * Lambda +
+        RowVector(ROW_TANGENT_X) * RowChannels[ROW_TANGENT_LAMBDA][Row] +
+        RowVector(ROW_BITANGENT_X) * RowChannels[ROW_BITANGENT_LAMBDA][Row];
+    // P_ApplyImpulse와 같은 최소 충격량/토크 조건
+    if (Impulse.LengthSquared() <= MIN_VALID_FORCE_SQUARED)
+        return;
+
+    auto Apply = [this, Row](uint32_t Slot, const Vector3& InImpulse, ERowChannel RadiusX, ERowChannel InvMass, ERowChannel InvInertiaX) {
+        if (Slot == STATIC_BODY)
+            return;
+
+        const float Mass = RowChannels[InvMass][Row];
+        BodyChannels[BODY_VELOCITY_X][Slot] += InImpulse.x * Mass;
+        BodyChannels[BODY_VELOCITY_Y][Slot] += InImpulse.y * Mass;
+        BodyChannels[BODY_VELOCITY_Z][Slot] += InImpulse.z * Mass;
+
+        const Vector3 Radius(RowChannels[RadiusX][Row], RowChannels[RadiusX + 1][Row], RowChannels[RadiusX + 2][Row]);
+        const Vector3 AngularImpulse = Vector3::Cross(Radius, InImpulse);
+        if (AngularImpulse.LengthSquared() > MIN_VALID_TORQUE_SQUARED)
+        {
+            BodyChannels[BODY_ANGULAR_X][Slot] += AngularImpulse.x * RowChannels[InvInertiaX][Row];
+            BodyChannels[BODY_ANGULAR_Y][Slot] += AngularImpulse.y * RowChannels[InvInertiaX + 1][Row];
+            BodyChannels[BODY_ANGULAR_Z][Slot] += AngularImpulse.z * RowChannels[InvInertiaX + 2][Row];
+        }
+        };
+    //A->B 방향의 법선벡터이므로 반대로 적용
+    Apply(RowBodyA[Row], -Impulse, ROW_RADIUS_A_X, ROW_INV_MASS_A, ROW_INV_INERTIA_A_X);
+    Apply(RowBodyB[Row], Impulse, ROW_RADIUS_B_X, ROW_INV_MASS_B, ROW_INV_INERTIA_B_X);
+}
+
+void FContactBatchSolver::SetPairActivity(const std::vector<uint8_t>& InPairActivity)
+{
+    PairActivity = InPairActivity;
+    float* Active = RowChannels[ROW_ACTIVE].data();
+    float* Unconverged = RowChannels[ROW_UNCONVERGED].data();
+    for (size_t Row = 0; Row < RowPairs.size(); ++Row)
+    {
+        const uint32_t PairIndex = RowPairs[Row];
+        Active[Row] = PairIndex != INVALID_PAIR && PairActivity[PairIndex] ? 1.0f : 0.0f;
+        Unconverged[Row] = 0.0f;
+    }
+}
+
+void FContactBatchSolver::UpdatePairConvergence(const std::vector<const FCollisionPair*>& Pairs)
+{
+    std::fill(PairUnconverged.begin(), PairUnconverged.end(), 0);
+    const float* Unconverged = RowChannels[ROW_UNCONVERGED].data();
+    for (size_t Row = 0; Row < RowPairs.size(); ++Row)
+    {
+        if (Unconverged[Row] != 0.0f)
+        {
+            PairUnconverged[RowPairs[Row]] = 1;
+        }
+    }
+
+    for (size_t PairIndex = 0; PairIndex < Pairs.size(); ++PairIndex)
+    {
+        if (PairActivity[PairIndex])
+        {
+            Pairs[PairIndex]->bConverged = PairUnconverged[PairIndex] == 0;
+        }
+    }
+}
+
+void FContactBatchSolver::SolveRows(size_t Begin, size_t End, EPhysicsSimdLevel Level)
+{
+    End = std::min(End, RowPairs.size());
+    if (Begin >= End)
+        return;
+
+    Level = std::min(Level, FPhysicsBatchIntegrator::GetSupportedSimdLevel());
+
+    // 넓은 레인부터 처리하고 남은 행은 좁은 레인으로 넘김
+    size_t Index = Begin;
+    if (Level == EPhysicsSimdLevel::AVX2)
+    {
+        Index = SolveLaneRangeAvx2(Index, End);
+    }
+    if (Level >= EPhysicsSimdLevel::SSE)
+    {
+        Index = SolveLaneRange<FFloat4>(Index, End);
+    }
+    SolveLaneRange<FFloat1>(Index, End);
+}
+
+void FContactBatchSolver::Finish(FPhysicsBodyStore& Store, const std::vector<const FCollisionPair*>& Pairs)
+{
+    for (size_t Slot = 1; Slot < BodyIds.size(); ++Slot)
+    {
+        const FPhysicsBodyId BodyId = BodyIds[Slot];
+        const Vector3 Velocity(BodyChannels[BODY_VELOCITY_X][Slot], BodyChannels[BODY_VELOCITY_Y][Slot],
+                               BodyChannels[BODY_VELOCITY_Z][Slot]);
+        const Vector3 AngularVelocity(BodyChannels[BODY_ANGULAR_X][Slot], BodyChannels[BODY_ANGULAR_Y][Slot],
+                                      BodyChannels[BODY_ANGULAR_Z][Slot]);
+        if (Velocity == Store.Velocities[BodyId] && AngularVelocity == Store.AngularVelocities[BodyId])
+            continue;
+
+        Store.Velocities[BodyId] = Velocity;
+        Store.AngularVelocities[BodyId] = AngularVelocity;
+        //외부 작용은 수면 중인 강체를 깨움
+        if (Store.IsSleeping(BodyId))
+        {
+            Store.Awake(BodyId);
+        }
+    }
+
+    // 다음 스텝에서 이어받을 누적 충격량
+    for (size_t Row = 0; Row < RowPairs.size(); ++Row)
+    {
+        if (RowPairs[Row] == INVALID_PAIR)
+            continue;
+
+        FContactPoint& Contact = Pairs[RowPairs[Row]]->Manifold.Points[RowPoints[Row]];
+        Contact.AccumulatedNormalImpulse = RowChannels[ROW_NORMAL_LAMBDA][Row];
+        Contact.AccumulatedTangentImpulse = RowChannels[ROW_TANGENT_LAMBDA][Row];
+        Contact.AccumulatedBitangentImpulse = RowChannels[ROW_BITANGENT_LAMBDA][Row];
+    }
+}
@@ -0,0 +1,131 @@
+#pragma once
+#include "PhysicsBatchIntegrator.h"
+#include "PhysicsBodyStore.h"
+#include "CollisionPairCache.h"
+#include <vector>
+#include <cstdint>
+
+/// <summary>
+/// 접촉 제약 일괄 해결기 (Structure of Arrays)
+/// 스텝 시작 시 강체 속도와 접촉점 자료를 한 번 모아 접촉 행 배열로 만들고,
+/// 반복마다 행 4/8개를 SIMD 레인으로 한 번에 해결한 뒤 마지막에 속도를 저장소로 되돌려 씀
+/// 수직/마찰 충격량은 FCollisionResponseCalculator, 마찰 제한은 ClampFriction,
+/// 충격량 적용은 URigidBodyComponent::P_ApplyImpulse와 같은 식을 따름
+/// 행은 해결 묶음(색) -> 접촉점 번호 순으로 모으므로 같은 행 그룹의 행은 동적 강체를 공유하지 않음
+/// </summary>
+class FContactBatchSolver
+{
+public:
+    // 행 그룹 경계 정렬 단위 - 가장 넓은 레인 폭
+    static constexpr size_t LANE_ALIGNMENT = FPhysicsBatchIntegrator::LANE_ALIGNMENT;
+
+    struct FRowGroup
+    {
+        uint32_t Begin = 0;
+        uint32_t End = 0;
+        bool bConflictFree = true;      // 거짓이면 행끼리 강체를 공유할 수 있어 순차 해결
+    };
+
+public:
+    /// <summary>
+    /// 접촉 행 구성, 강체 속도 수집 후 이어받은 수직/접선 충격량 적용 (웜 스타트)
+    /// PairBodies는 쌍마다 A, B 강체 슬롯 2개씩 - 강체가 없는 쪽이 있으면 그 쌍은 행을 만들지 않음
+    /// BatchPairs/BatchOffsets는 해결 묶음, 앞의 ConflictFreeBatchCount개 묶음만 강체를 공유하지 않음
+    /// </summary>
+    void Build(const FPhysicsBodyStore& Store,
+               const std::vector<const FCollisionPair*>& Pairs,
+               const std::vector<FCollisionDetectionResult>& Results,
+               const std::vector<FPhysicsBodyId>& PairBodies,
+               const std::vector<float>& PairTimes,
+               const std::vector<uint32_t>& BatchPairs,
+               const std::vector<uint32_t>& BatchOffsets,
+               size_t ConflictFreeBatchCount,
+               float BiasFactor, float Slop);
+
+    // 이번 반복에서 해결할 쌍 - 0인 쌍의 행은 값을 바꾸지 않음
+    void SetPairActivity(const std::vector<uint8_t>& InPairActivity);
+    // 해결한 쌍의 수렴 여부 기록 - 모든 접촉점 행이 수렴해야 쌍 수렴
+    void UpdatePairConvergence(const std::vector<const FCollisionPair*>& Pairs);
+
+    size_t GetGroupCount() const { return Groups.size(); }
+    const FRowGroup& GetGroup(size_t Index) const { return Groups[Index]; }
+
+    /// <summary>
+    /// [Begin, End) 행을 한 번 해결
+    /// 강체를 공유하지 않는 그룹은 LANE_ALIGNMENT 경계로 나눠 여러 스레드에서 동시에 호출 가능
+    /// 공유할 수 있는 그룹은 레인 사이에 속도가 이어지지 않으므로 Scalar 수준으로 한 스레드에서 호출해야 함
+    /// </summary>
+    void SolveRows(size_t Begin, size_t End, EPhysicsSimdLevel Level);
+
+    // 속도를 저장소로 되돌려 쓰고 누적 충격량을 다양체에 기록 - 속도가 바뀐 수면 강체는 깨움
+    void Finish(FPhysicsBodyStore& Store, const std::vector<const FCollisionPair*>& Pairs);
+
+private:
+    // 접촉 행 속성 - 속성마다 연속 배열
+    enum ERowChannel : uint8_t
+    {
+        ROW_NORMAL_X, ROW_NORMAL_Y, ROW_NORMAL_Z,
+        ROW_RADIUS_A_X, ROW_RADIUS_A_Y, ROW_RADIUS_A_Z,
+        ROW_RADIUS_B_X, ROW_RADIUS_B_Y, ROW_RADIUS_B_Z,
+        ROW_INV_MASS_A, ROW_INV_MASS_B,
+        // 충격량 적용용 지역 역관성 (P_ApplyImpulse와 동일하게 회전하지 않음)
+        ROW_INV_INERTIA_A_X, ROW_INV_INERTIA_A_Y, ROW_INV_INERTIA_A_Z,
+        ROW_INV_INERTIA_B_X, ROW_INV_INERTIA_B_Y, ROW_INV_INERTIA_B_Z,
+        ROW_NORMAL_MASS,        // 수직 방향 유효 질량, 계산할 수 없으면 0
+        // 마찰 축 두 개 (FContactManifold::GetTangentBasis)와 축별 유효 질량
+        ROW_TANGENT_X, ROW_TANGENT_Y, ROW_TANGENT_Z,
+        ROW_BITANGENT_X, ROW_BITANGENT_Y, ROW_BITANGENT_Z,
+        ROW_TANGENT_MASS, ROW_BITANGENT_MASS,
+        ROW_BIAS,               // 위치 보정 속도 편향
+        ROW_RESTITUTION,
+        ROW_FRICTION,           // 운동 마찰 계수
+        ROW_NORMAL_LAMBDA,
+        ROW_TANGENT_LAMBDA,
+        ROW_BITANGENT_LAMBDA,
+        ROW_ACTIVE,             // 1 = 이번 반복에서 해결
+        ROW_UNCONVERGED,        // 1 = 마지막 해결에서 수렴하지 않음
+        ROW_CHANNEL_COUNT
+    };
+
+    // 해결기 강체 속성 - 0번은 정적/없는 강체가 함께 쓰는 빈 강체 (속도 0, 되돌려 쓰지 않음)
+    enum EBodyChannel : uint8_t
+    {
+        BODY_VELOCITY_X, BODY_VELOCITY_Y, BODY_VELOCITY_Z,
+        BODY_ANGULAR_X, BODY_ANGULAR_Y, BODY_ANGULAR_Z,
+        BODY_CHANNEL_COUNT
+    };
+
+    static constexpr uint32_t STATIC_BODY = 0;
+    static constexpr uint32_t INVALID_PAIR = static_cast<uint32_t>(-1);
+
+    uint32_t AcquireBody(const FPhysicsBodyStore& Store, FPhysicsBodyId BodyId);
+    void AddRow(const FPhysicsBodyStore& Store, uint32_t PairIndex, uint32_t PointIndex,
+                const FCollisionPair& Pair, const FCollisionDetectionResult& Result,
+                FPhysicsBodyId BodyIdA, FPhysicsBodyId BodyIdB, float SolveTime, float BiasFactor, float Slop);
+    void AddEmptyRow();
+    void WarmStartRow(size_t Row);
+
+    // F::Width개의 연속 행 해결
+    template<typename F>
+    void SolveLanes(size_t Index);
+    // 레인 폭 단위로 처리 가능한 만큼 해결하고, 처리하지 못한 첫 행 반환
+    template<typename F>
+    size_t SolveLaneRange(size_t Begin, size_t End);
+    // AVX2 레인 해결 (ContactBatchSolverAvx2.cpp) - AVX2 지원 CPU에서만 호출
+    size_t SolveLaneRangeAvx2(size_t Begin, size_t End);
+
+private:
+    std::vector<float> RowChannels[ROW_CHANNEL_COUNT];
+    std::vector<uint32_t> RowBodyA;             // 해결기 강체 번호
+    std::vector<uint32_t> RowBodyB;
+    std::vector<uint32_t> RowPairs;             // 쌍 번호, 빈 행은 INVALID_PAIR
+    std::vector<uint8_t> RowPoints;             // 다양체 접촉점 번호
+    std::vector<FRowGroup> Groups;
+
+    std::vector<float> BodyChannels[BODY_CHANNEL_COUNT];
+    std::vector<FPhysicsBodyId> BodyIds;        // 해결기 강체 번호 -> 강체 슬롯
+    std::vector<uint32_t> BodySlots;            // 강체 슬롯 -> 해결기 강체 번호, 0이면 아직 없음
+
+    std::vector<uint8_t> PairActivity;
+    std::vector<uint8_t> PairUnconverged;
+};
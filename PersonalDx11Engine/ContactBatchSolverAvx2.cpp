@@ -0,0 +1,13 @@
+// AVX2 레인 접촉 해결 - 이 번역 단위만 AVX2 명령 생성을 허용해 빌드함 (GCC/Clang은 -mavx2)
+// 스칼라/SSE 경로는 ContactBatchSolver.cpp에 있음
+#define PHYSICS_SIMD_AVX2_UNIT
+#include "ContactBatchSolver.h"
+#include "ContactBatchSolverLanes.h"
+
+size_t FContactBatchSolver::SolveLaneRangeAvx2(size_t Begin, size_t End)
+{
+    const size_t Index = SolveLaneRange<FFloat8>(Begin, End);
+    // 이후 SSE 코드의 전환 비용 방지
+    _mm256_zeroupper();
+    return Index;
+}
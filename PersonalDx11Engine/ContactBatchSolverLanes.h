@@ -0,0 +1,148 @@
+#pragma once
+#include "ContactBatchSolver.h"
+#include "PhysicsDefine.h"
+#include "PhysicsSimdLanes.h"
+
+/// <summary>
+/// 접촉 일괄 해결기 레인 커널 - ContactBatchSolver.cpp(스칼라/SSE)와 ContactBatchSolverAvx2.cpp(AVX2)에서 포함
+/// 보조 함수는 익명 이름공간으로 두어 번역 단위마다 따로 인스턴스화됨
+/// </summary>
+namespace
+{
+    using namespace PhysicsSimd;
+
+    // 해결기 강체 번호로 레인별 값 모으기 / 흩어 쓰기 - 빈 강체에는 쓰지 않음
+    template<typename F>
+    inline F Gather(const std::vector<float>& Source, const uint32_t* Slots)
+    {
+        alignas(32) float Lanes[FContactBatchSolver::LANE_ALIGNMENT];
+        for (size_t Lane = 0; Lane < F::Width; ++Lane)
+        {
+            Lanes[Lane] = Source[Slots[Lane]];
+        }
+        return F::Load(Lanes);
+    }
+
+    template<typename F>
+    inline void Scatter(std::vector<float>& Dest, const uint32_t* Slots, F Value, uint32_t SkipSlot)
+    {
+        alignas(32) float Lanes[FContactBatchSolver::LANE_ALIGNMENT];
+        F::Store(Lanes, Value);
+        for (size_t Lane = 0; Lane < F::Width; ++Lane)
+        {
+            if (Slots[Lane] != SkipSlot)
+            {
+                Dest[Slots[Lane]] = Lanes[Lane];
+            }
+        }
+    }
+}
+
+template<typename F>
+void FContactBatchSolver::SolveLanes(size_t Index)
+{
+    using FMask = typename F::FMask;
+    auto Load = [this, Index](ERowChannel Channel) { return F::Load(&RowChannels[Channel][Index]); };
+    auto Store = [this, Index](ERowChannel Channel, F Value) { F::Store(&RowChannels[Channel][Index], Value); };
+
+    const F Zero = F::Splat(0.0f);
+    const F One = F::Splat(1.0f);
+    const F Small = F::Splat(KINDA_SMALL);
+
+    const FMask bActive = Load(ROW_ACTIVE) > Zero;
+    if (!Any(bActive))
+        return;
+
+    // 강체 속도 모으기
+    const uint32_t* SlotA = &RowBodyA[Index];
+    const uint32_t* SlotB = &RowBodyB[Index];
+    TVec3<F> VelocityA = { Gather<F>(BodyChannels[BODY_VELOCITY_X], SlotA), Gather<F>(BodyChannels[BODY_VELOCITY_Y], SlotA),
+                           Gather<F>(BodyChannels[BODY_VELOCITY_Z], SlotA) };
+    TVec3<F> AngularA = { Gather<F>(BodyChannels[BODY_ANGULAR_X], SlotA), Gather<F>(BodyChannels[BODY_ANGULAR_Y], SlotA),
+                          Gather<F>(BodyChannels[BODY_ANGULAR_Z], SlotA) };
+    TVec3<F> VelocityB = { Gather<F>(BodyChannels[BODY_VELOCITY_X], SlotB), Gather<F>(BodyChannels[BODY_VELOCITY_Y], SlotB),
+                           Gather<F>(BodyChannels[BODY_VELOCITY_Z], SlotB) };
+    TVec3<F> AngularB = { Gather<F>(BodyChannels[BODY_ANGULAR_X], SlotB), Gather<F>(BodyChannels[BODY_ANGULAR_Y], SlotB),
+                          Gather<F>(BodyChannels[BODY_ANGULAR_Z], SlotB) };
+
+    const TVec3<F> Normal = { Load(ROW_NORMAL_X), Load(ROW_NORMAL_Y), Load(ROW_NORMAL_Z) };
+    const TVec3<F> RadiusA = { Load(ROW_RADIUS_A_X), Load(ROW_RADIUS_A_Y), Load(ROW_RADIUS_A_Z) };
+    const TVec3<F> RadiusB = { Load(ROW_RADIUS_B_X), Load(ROW_RADIUS_B_Y), Load(ROW_RADIUS_B_Z) };
+    const F InvMassA = Load(ROW_INV_MASS_A);
+    const F InvMassB = Load(ROW_INV_MASS_B);
+
+    // 상대 속도 = B의 접촉점 속도 - A의 접촉점 속도
+    const TVec3<F> RelativeVelocity = (VelocityB + Cross(AngularB, RadiusB)) - (VelocityA + Cross(AngularA, RadiusA));
+    const F NormalSpeed = Dot(RelativeVelocity, Normal);
+
+    // 수직 충격량 - 느린 접촉은 반발 무시, 목표 속도에 위치 편향 추가, 누적 람다는 0 이상
+    const F Restitution = Select(Abs(NormalSpeed) < Small, Zero, Load(ROW_RESTITUTION));
+    const F DesiredSpeed = Select(NormalSpeed < Zero, -NormalSpeed * Restitution, Zero) + Load(ROW_BIAS);
+    const F OldNormalLambda = Load(ROW_NORMAL_LAMBDA);
+    const F NormalLambda = Max(OldNormalLambda - (NormalSpeed - DesiredSpeed) * Load(ROW_NORMAL_MASS), Zero);
+    const F NormalApplied = NormalLambda - OldNormalLambda;
+
+    // 마찰 충격량 - 같은 속도로 계산, 법선에서 정한 고정 축 두 개로 해결 (CalculateFrictionImpulse)
+    // ClampFriction - 누적 람다를 운동 마찰 한계로 제한하고 누적 람다의 변화만 적용
+    const F MaxFriction = NormalLambda * Load(ROW_FRICTION);
+    const TVec3<F> Tangent = { Load(ROW_TANGENT_X), Load(ROW_TANGENT_Y), Load(ROW_TANGENT_Z) };
+    const TVec3<F> Bitangent = { Load(ROW_BITANGENT_X), Load(ROW_BITANGENT_Y), Load(ROW_BITANGENT_Z) };
+    const F OldTangentLambda = Load(ROW_TANGENT_LAMBDA);
+    const F OldBitangentLambda = Load(ROW_BITANGENT_LAMBDA);
+    const F TangentLambda = Min(Max(OldTangentLambda - Dot(RelativeVelocity, Tangent) * Load(ROW_TANGENT_MASS),
+                                    -MaxFriction), MaxFriction);
+    const F BitangentLambda = Min(Max(OldBitangentLambda - Dot(RelativeVelocity, Bitangent) * Load(ROW_BITANGENT_MASS),
+                                      -MaxFriction), MaxFriction);
+    const F TangentApplied = TangentLambda - OldTangentLambda;
+    const F BitangentApplied = BitangentLambda - OldBitangentLambda;
+
+    // 최종 순수 충격량 - P_ApplyImpulse와 같은 최소 충격량/토크 조건으로 적용
+    const TVec3<F> Impulse = Normal * NormalApplied + Tangent * TangentApplied + Bitangent * BitangentApplied;
+    const F ImpulseSq = LengthSq(Impulse);
+    const FMask bApply = bActive & (ImpulseSq > F::Splat(MIN_VALID_FORCE_SQUARED));
+    const F MinTorqueSq = F::Splat(MIN_VALID_TORQUE_SQUARED);
+    const TVec3<F> AngularImpulseA = Cross(RadiusA, Impulse);
+    const TVec3<F> AngularImpulseB = Cross(RadiusB, Impulse);
+    const FMask bTorqueA = bApply & (LengthSq(AngularImpulseA) > MinTorqueSq);
+    const FMask bTorqueB = bApply & (LengthSq(AngularImpulseB) > MinTorqueSq);
+    const TVec3<F> InvInertiaA = { Load(ROW_INV_INERTIA_A_X), Load(ROW_INV_INERTIA_A_Y), Load(ROW_INV_INERTIA_A_Z) };
+    const TVec3<F> InvInertiaB = { Load(ROW_INV_INERTIA_B_X), Load(ROW_INV_INERTIA_B_Y), Load(ROW_INV_INERTIA_B_Z) };
+
+    //A->B 방향의 법선벡터이므로 반대로 적용
+    VelocityA = Select(bApply, VelocityA - Impulse * InvMassA, VelocityA);
+    AngularA = Select(bTorqueA, AngularA - Mul(AngularImpulseA, InvInertiaA), AngularA);
+    VelocityB = Select(bApply, VelocityB + Impulse * InvMassB, VelocityB);
+    AngularB = Select(bTorqueB, AngularB + Mul(AngularImpulseB, InvInertiaB), AngularB);
+
+    //수렴 조건 확인 - 람다 변화가 작거나 충격량이 무시할 만하면 수렴
+    const FMask bUnconverged = bActive & (Abs(NormalApplied) >= One) & (ImpulseSq >= Small * Small);
+    Store(ROW_NORMAL_LAMBDA, Select(bActive, NormalLambda, OldNormalLambda));
+    Store(ROW_TANGENT_LAMBDA, Select(bActive, TangentLambda, OldTangentLambda));
+    Store(ROW_BITANGENT_LAMBDA, Select(bActive, BitangentLambda, OldBitangentLambda));
+    Store(ROW_UNCONVERGED, Select(bUnconverged, One, Zero));
+
+    // 강체 속도 흩어 쓰기 - 같은 그룹의 레인은 동적 강체를 공유하지 않음
+    Scatter(BodyChannels[BODY_VELOCITY_X], SlotA, VelocityA.X, STATIC_BODY);
+    Scatter(BodyChannels[BODY_VELOCITY_Y], SlotA, VelocityA.Y, STATIC_BODY);
+    Scatter(BodyChannels[BODY_VELOCITY_Z], SlotA, VelocityA.Z, STATIC_BODY);
+    Scatter(BodyChannels[BODY_ANGULAR_X], SlotA, AngularA.X, STATIC_BODY);
+    Scatter(BodyChannels[BODY_ANGULAR_Y], SlotA, AngularA.Y, STATIC_BODY);
+    Scatter(BodyChannels[BODY_ANGULAR_Z], SlotA, AngularA.Z, STATIC_BODY);
+    Scatter(BodyChannels[BODY_VELOCITY_X], SlotB, VelocityB.X, STATIC_BODY);
+    Scatter(BodyChannels[BODY_VELOCITY_Y], SlotB, VelocityB.Y, STATIC_BODY);
+    Scatter(BodyChannels[BODY_VELOCITY_Z], SlotB, VelocityB.Z, STATIC_BODY);
+    Scatter(BodyChannels[BODY_ANGULAR_X], SlotB, AngularB.X, STATIC_BODY);
+    Scatter(BodyChannels[BODY_ANGULAR_Y], SlotB, AngularB.Y, STATIC_BODY);
+    Scatter(BodyChannels[BODY_ANGULAR_Z], SlotB, AngularB.Z, STATIC_BODY);
+}
+
+template<typename F>
+size_t FContactBatchSolver::SolveLaneRange(size_t Begin, size_t End)
+{
+    size_t Index = Begin;
+    for (; Index + F::Width <= End; Index += F::Width)
+    {
+        SolveLanes<F>(Index);
+    }
+    return Index;
+}
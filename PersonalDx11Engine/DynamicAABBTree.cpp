@@ -2,6 +2,7 @@
 #include <iostream>
 #include <queue>
 #include "Debug.h"
+#include "PhysicsSnapshot.h"
 
 FDynamicAABBTree::FDynamicAABBTree(size_t InitialCapacity)
 {
@@ -48,8 +49,14 @@ size_t FDynamicAABBTree::Insert(const std::shared_ptr<IDynamicBoundable>& Object
 
     ComputeNodeAABB(NodeId, Object.get());
     NewNode.Height = 0;
+    NewNode.bStatic = Object->IsStatic();
 
     InsertLeaf(NodeId);
+    if (!NodePool[NodeId].bStatic)
+    {
+        AddDynamicLeaf(NodeId);
+    }
+    MoveBuffer.push_back(NodeId);
     return NodeId;
 }
 
@@ -58,24 +65,25 @@ void FDynamicAABBTree::Remove(size_t NodeId)
     if (!IsValidId(NodeId))
         return;
 
+    RemoveDynamicLeaf(NodeId);
     RemoveLeaf(NodeId);
     FreeNode(NodeId);
 }
 
-void FDynamicAABBTree::UpdateTree()
+size_t FDynamicAABBTree::UpdateTree()
 {
-    // 루트가 없으면 종료
-    if (RootId == NULL_NODE)
-        return;
+    // 동적 계층이 비었으면 종료
+    if (RootOf(false) == NULL_NODE)
+        return 0;
 
     std::vector<size_t> NodesToUpdate;
-    NodesToUpdate.reserve(NodeCount);
+    NodesToUpdate.reserve(DynamicLeaves.size());
 
-    // 리프 노드들의 바운드 체크 및 업데이트 필요 노드 수집
-    for (size_t i = 0; i < NodePool.size(); ++i)
+    // 동적 리프들의 바운드 체크 및 업데이트 필요 노드 수집 - 정적 리프는 검사하지 않음
+    for (size_t i : DynamicLeaves)
     {
         Node& Node = NodePool[i];
-        if (!Node.IsLeaf() || !Node.BoundableObject)
+        if (!Node.IsLeaf() || !Node.BoundableObject || Node.bSleeping)
             continue;
 
         const FTransform& CurrentWorldTransform = Node.BoundableObject->GetWorldTransform();
@@ -93,7 +101,65 @@ void FDynamicAABBTree::UpdateTree()
         RemoveLeaf(NodeId);
         UpdateNodeBounds(NodeId);
         InsertLeaf(NodeId);
+        MoveBuffer.push_back(NodeId);
+    }
+    return NodesToUpdate.size();
+}
+
+void FDynamicAABBTree::SetLeafStatic(size_t NodeId, bool bStatic)
+{
+    if (!IsLeafNode(NodeId) || NodePool[NodeId].bStatic == bStatic)
+        return;
+
+    RemoveLeaf(NodeId);
+    if (bStatic)
+    {
+        RemoveDynamicLeaf(NodeId);
     }
+    NodePool[NodeId].bStatic = bStatic;
+    if (!bStatic)
+    {
+        AddDynamicLeaf(NodeId);
+    }
+    UpdateNodeBounds(NodeId);
+    InsertLeaf(NodeId);
+    MoveBuffer.push_back(NodeId);
+}
+
+bool FDynamicAABBTree::RefitLeaf(size_t NodeId)
+{
+    if (!IsLeafNode(NodeId))
+        return false;
+
+    const Node& Leaf = NodePool[NodeId];
+    if (!Leaf.NeedsUpdate(Leaf.BoundableObject->GetHalfExtent(), Leaf.BoundableObject->GetWorldTransform()))
+        return false;
+
+    RemoveLeaf(NodeId);
+    UpdateNodeBounds(NodeId);
+    InsertLeaf(NodeId);
+    MoveBuffer.push_back(NodeId);
+    return true;
+}
+
+void FDynamicAABBTree::AddDynamicLeaf(size_t NodeId)
+{
+    NodePool[NodeId].DynamicLeafIndex = static_cast<uint32_t>(DynamicLeaves.size());
+    DynamicLeaves.push_back(NodeId);
+}
+
+void FDynamicAABBTree::RemoveDynamicLeaf(size_t NodeId)
+{
+    const uint32_t Index = NodePool[NodeId].DynamicLeafIndex;
+    if (Index >= DynamicLeaves.size() || DynamicLeaves[Index] != NodeId)
+        return;
+
+    // 마지막 원소를 빈 자리로 옮김
+    const size_t LastId = DynamicLeaves.back();
+    DynamicLeaves[Index] = LastId;
+    NodePool[LastId].DynamicLeafIndex = Index;
+    DynamicLeaves.pop_back();
+    NodePool[NodeId].DynamicLeafIndex = UINT32_MAX;
 }
 
 size_t FDynamicAABBTree::AllocateNode()
@@ -133,6 +199,10 @@ void FDynamicAABBTree::FreeNode(size_t NodeId)
 
 void FDynamicAABBTree::InsertLeaf(size_t LeafId)
 {
+    // 리프가 속한 계층에 삽입
+    const bool bStatic = NodePool[LeafId].bStatic;
+    size_t& RootId = RootOf(bStatic);
+
     // 첫 노드면 루트로 설정
     if (RootId == NULL_NODE)
     {
@@ -141,8 +211,8 @@ void FDynamicAABBTree::InsertLeaf(size_t LeafId)
         return;
     }
 
-    // 삽입 위치 찾기
-    Node& Leaf = NodePool[LeafId];
+    // 삽입 위치 찾기 - 아래의 노드 할당으로 풀이 커질 수 있으므로 리프 바운드는 복사해 둠
+    const AABB LeafBounds = NodePool[LeafId].Bounds;
     size_t CurrentId = RootId;
 
     while (!NodePool[CurrentId].IsLeaf())
@@ -154,8 +224,8 @@ void FDynamicAABBTree::InsertLeaf(size_t LeafId)
         // SAH 비용 계산
         float CurrentCost = ComputeCost(Current.Bounds);
         AABB CombinedBounds;
-        CombinedBounds.Min = Vector3::Min(Current.Bounds.Min, Leaf.Bounds.Min);
-        CombinedBounds.Max = Vector3::Max(Current.Bounds.Max, Leaf.Bounds.Max);
+        CombinedBounds.Min = Vector3::Min(Current.Bounds.Min, LeafBounds.Min);
+        CombinedBounds.Max = Vector3::Max(Current.Bounds.Max, LeafBounds.Max);
         float CombinedCost = ComputeCost(CombinedBounds);
 
         // 왼쪽, 오른쪽 자식과의 결합 비용 계산
@@ -163,13 +233,13 @@ void FDynamicAABBTree::InsertLeaf(size_t LeafId)
         Node& RightChild = NodePool[RightId];
 
         AABB LeftCombined;
-        LeftCombined.Min = Vector3::Min(LeftChild.Bounds.Min, Leaf.Bounds.Min);
-        LeftCombined.Max = Vector3::Max(LeftChild.Bounds.Max, Leaf.Bounds.Max);
+        LeftCombined.Min = Vector3::Min(LeftChild.Bounds.Min, LeafBounds.Min);
+        LeftCombined.Max = Vector3::Max(LeftChild.Bounds.Max, LeafBounds.Max);
         float LeftCost = ComputeCost(LeftCombined);
 
         AABB RightCombined;
-        RightCombined.Min = Vector3::Min(RightChild.Bounds.Min, Leaf.Bounds.Min);
-        RightCombined.Max = Vector3::Max(RightChild.Bounds.Max, Leaf.Bounds.Max);
+        RightCombined.Min = Vector3::Min(RightChild.Bounds.Min, LeafBounds.Min);
+        RightCombined.Max = Vector3::Max(RightChild.Bounds.Max, LeafBounds.Max);
         float RightCost = ComputeCost(RightCombined);
 
         // 최소 비용 경로 선택
@@ -188,16 +258,17 @@ void FDynamicAABBTree::InsertLeaf(size_t LeafId)
         }
     }
 
-    // 새로운 부모 노드 생성
+    // 새로운 부모 노드 생성 - 리프와 같은 계층
     size_t NewParentId = AllocateNode();
     Node& NewParent = NodePool[NewParentId];
+    NewParent.bStatic = bStatic;
 
     size_t OldParentId = NodePool[CurrentId].Parent;
     NewParent.Parent = OldParentId;
 
     // 새 부모의 AABB 설정
-    NewParent.Bounds.Min = Vector3::Min(Leaf.Bounds.Min, NodePool[CurrentId].Bounds.Min);
-    NewParent.Bounds.Max = Vector3::Max(Leaf.Bounds.Max, NodePool[CurrentId].Bounds.Max);
+    NewParent.Bounds.Min = Vector3::Min(LeafBounds.Min, NodePool[CurrentId].Bounds.Min);
+    NewParent.Bounds.Max = Vector3::Max(LeafBounds.Max, NodePool[CurrentId].Bounds.Max);
     NewParent.Height = NodePool[CurrentId].Height + 1;
 
     if (OldParentId != NULL_NODE)
@@ -244,15 +315,16 @@ void FDynamicAABBTree::InsertLeaf(size_t LeafId)
 
 void FDynamicAABBTree::RemoveLeaf(size_t LeafId)
 {
+    if (!IsValidId(LeafId))
+        return;
+
+    size_t& RootId = RootOf(NodePool[LeafId].bStatic);
     if (LeafId == RootId)
     {
         RootId = NULL_NODE;
         return;
     }
 
-    if (!IsValidId(LeafId))
-        return;
-
     size_t ParentId = NodePool[LeafId].Parent;
     if (!IsValidId(ParentId))
         return;  
@@ -359,7 +431,7 @@ size_t FDynamicAABBTree::Rebalance(size_t NodeId)
                 NodePool[RightChild.Parent].Right = RightId;
         }
         else
-            RootId = RightId;
+            RootOf(N.bStatic) = RightId;
 
         // 높이 조정
         N.Height = 1 + std::max(LeftChild.Height,
@@ -414,7 +486,7 @@ size_t FDynamicAABBTree::Rebalance(size_t NodeId)
                 NodePool[LeftChild.Parent].Right = LeftId;
         }
         else
-            RootId = LeftId;
+            RootOf(N.bStatic) = LeftId;
 
         // 높이 조정
         N.Height = 1 + std::max(RightChild.Height,
@@ -504,7 +576,10 @@ void FDynamicAABBTree::ClearTree(const size_t InitialCapacity)
 {
     NodePool.clear();
     FreeNodes.clear();
-    RootId = NULL_NODE;
+    MoveBuffer.clear();
+    DynamicLeaves.clear();
+    RootOf(false) = NULL_NODE;
+    RootOf(true) = NULL_NODE;
     NodeCount = 0;
 
     // 초기 용량으로 다시 초기화
@@ -544,12 +619,22 @@ void FDynamicAABBTree::ComputeNodeAABB(size_t NodeId, IDynamicBoundable* Object)
 
 void FDynamicAABBTree::PrintTreeStructure(std::ostream& os) const
 {
-    PrintBinaryTree(RootId, os);
+    os << "[Dynamic]" << std::endl;
+    PrintBinaryTree(RootIds[static_cast<size_t>(ETreeType::Dynamic)], os);
+    os << "[Static]" << std::endl;
+    PrintBinaryTree(RootIds[static_cast<size_t>(ETreeType::Static)], os);
 }
 
 void FDynamicAABBTree::QueryOverlap(const AABB& QueryBounds, const std::function<void(size_t)>& Func)
+{
+    QueryOverlap(ETreeType::Dynamic, QueryBounds, Func);
+    QueryOverlap(ETreeType::Static, QueryBounds, Func);
+}
+
+void FDynamicAABBTree::QueryOverlap(ETreeType Type, const AABB& QueryBounds, const std::function<void(size_t)>& Func)
 {
     // 루트가 없으면 종료
+    const size_t RootId = RootIds[static_cast<size_t>(Type)];
     if (RootId == NULL_NODE)
         return;
 
@@ -655,4 +740,53 @@ void FDynamicAABBTree::PrintBinaryTree(size_t root, std::ostream& os, std::strin
     // 왼쪽, 오른쪽 자식 출력 (왼쪽 먼저)
     PrintBinaryTree(RootNode.Left, os, newPrefix, true);
     PrintBinaryTree(RootNode.Right, os, newPrefix, false);
-}
\ No newline at end of file
+}
+
+void FDynamicAABBTree::WriteSnapshot(FPhysicsSnapshotWriter& Writer) const
+{
+    Writer.WriteArray(NodePool);
+    Writer.WriteArray(MoveBuffer);
+    Writer.WriteArray(DynamicLeaves);
+    Writer.Write<uint64_t>(RootIds[static_cast<size_t>(ETreeType::Dynamic)]);
+    Writer.Write<uint64_t>(RootIds[static_cast<size_t>(ETreeType::Static)]);
+    Writer.Write<uint64_t>(NodeCount);
+
+    // 빈 노드 목록 - 복원 후 할당 순서가 달라져도 트리 모양만 바뀌고 겹침 결과는 같음
+    Writer.Write<uint64_t>(FreeNodes.size());
+    for (size_t NodeId : FreeNodes)
+    {
+        Writer.Write<uint64_t>(NodeId);
+    }
+}
+
+bool FDynamicAABBTree::ReadSnapshot(FPhysicsSnapshotReader& Reader)
+{
+    uint64_t InDynamicRootId = 0;
+    uint64_t InStaticRootId = 0;
+    uint64_t InNodeCount = 0;
+    uint64_t FreeCount = 0;
+
+    Reader.ReadArray(NodePool);
+    Reader.ReadArray(MoveBuffer);
+    Reader.ReadArray(DynamicLeaves);
+    Reader.Read(InDynamicRootId);
+    Reader.Read(InStaticRootId);
+    Reader.Read(InNodeCount);
+    Reader.Read(FreeCount);
+    if (!Reader.IsGood() || FreeCount > NodePool.size())
+        return false;
+
+    RootIds[static_cast<size_t>(ETreeType::Dynamic)] = static_cast<size_t>(InDynamicRootId);
+    RootIds[static_cast<size_t>(ETreeType::Static)] = static_cast<size_t>(InStaticRootId);
+    NodeCount = static_cast<size_t>(InNodeCount);
+
+    FreeNodes.clear();
+    for (uint64_t i = 0; i < FreeCount; ++i)
+    {
+        uint64_t NodeId = 0;
+        if (!Reader.Read(NodeId))
+            return false;
+        FreeNodes.insert(static_cast<size_t>(NodeId));
+    }
+    return true;
+}
@@ -3,12 +3,21 @@
 #include "Transform.h"
 #include "DynamicBoundableInterface.h"
 #include <vector>
+#include <cstdint>
 #include <unordered_map>
 #include <unordered_set>
 #include <memory>
 #include <functional>
 #include <iostream>
 
+class FPhysicsSnapshotWriter;
+class FPhysicsSnapshotReader;
+
+/// <summary>
+/// 동적 AABB 트리 - 정적/동적 리프를 한 노드 풀 안의 두 계층으로 나눠 관리
+/// 노드 번호는 두 계층이 공유하므로 리프 번호는 트리 전체에서 유일함
+/// UpdateTree는 동적 리프만 검사하며, 정적 리프는 RefitLeaf로 요청할 때만 바운드를 갱신
+/// </summary>
 class FDynamicAABBTree
 {
 public:
@@ -17,6 +26,14 @@ public:
     float AABB_Extension = 0.1f;    // AABB 확장 계수
     static constexpr float MIN_MARGIN = 0.01f;
 
+    // 리프가 속한 계층
+    enum class ETreeType : uint8_t
+    {
+        Dynamic = 0,
+        Static,
+        Count
+    };
+
     struct AABB
     {
         Vector3 Min;
@@ -110,9 +127,15 @@ public:
        
         // 4바이트 데이터
         int32_t Height = 0;
+        uint32_t DynamicLeafIndex = UINT32_MAX;  // 동적 리프 목록 위치
+
+        // 수면 중인 리프는 트리 갱신에서 제외
+        bool bSleeping = false;
+        // 정적 계층 노드 - 내부 노드도 자신이 속한 계층을 기록
+        bool bStatic = false;
 
         //패딩
-        int32_t Padding[3];      //총 108 + 12 
+        uint8_t Padding[6];       //총 114 + 6 + 정렬 8
 
         bool IsLeaf() const { return Left == NULL_NODE && BoundableObject != nullptr; }
         bool NeedsUpdate(const Vector3& LocalHalfExtent, const FTransform& WorldTransform) const
@@ -130,13 +153,30 @@ public:
     FDynamicAABBTree(size_t InitialCapacity = 1024);
     ~FDynamicAABBTree();
 
-    // 핵심 기능
+    // 핵심 기능 - 삽입 시 Object->IsStatic()으로 계층 결정
     size_t Insert(const std::shared_ptr<IDynamicBoundable>& Object);
     void Remove(size_t NodeId);
-    void UpdateTree();
-
-    // 쿼리 기능
+    // 뚱뚱한 바운드를 벗어난 동적 리프 재삽입 - 재삽입한 리프 수 반환, 재삽입한 리프는 이동 버퍼에 기록
+    // 검사 비용은 깨어있는 동적 리프 수에만 비례
+    size_t UpdateTree();
+
+    // 리프를 다른 계층으로 옮김 - 현재 바운드로 다시 삽입하고 이동 버퍼에 기록
+    void SetLeafStatic(size_t NodeId, bool bStatic);
+    bool IsStaticLeaf(size_t NodeId) const { return NodePool[NodeId].bStatic; }
+    // 정적 리프가 뚱뚱한 바운드를 벗어났으면 재삽입 - 재삽입했으면 참
+    bool RefitLeaf(size_t NodeId);
+    size_t GetDynamicLeafCount() const { return DynamicLeaves.size(); }
+
+    // 이동 버퍼 - 마지막 ClearMoveBuffer 이후 삽입/재삽입된 리프 (제거된 노드가 남아 있을 수 있음)
+    // 뚱뚱한 바운드는 재삽입 때만 바뀌므로 여기에 없는 리프끼리의 겹침 여부는 변하지 않음
+    const std::vector<size_t>& GetMoveBuffer() const { return MoveBuffer; }
+    void ClearMoveBuffer() { MoveBuffer.clear(); }
+    // 움직이지 않았어도 다음 넓은 단계에서 다시 질의할 리프 기록 - 충돌 필터 변경 등
+    void MarkMoved(size_t NodeId) { MoveBuffer.push_back(NodeId); }
+
+    // 쿼리 기능 - 두 계층 모두 / 한 계층만
     void QueryOverlap(const AABB& QueryBounds, const std::function<void(size_t)>& Func);
+    void QueryOverlap(ETreeType Type, const AABB& QueryBounds, const std::function<void(size_t)>& Func);
 
     const AABB& GetBounds(const size_t NodeId)
     {
@@ -155,11 +195,25 @@ public:
     //현재 사용중인 노드인지 검사
     bool IsValidId(const size_t NodeId) const;
 
+    // 수면 상태 리프 - UpdateTree에서 바운드 검사를 생략
+    void SetSleeping(const size_t NodeId, const bool bSleeping)
+    {
+        NodePool[NodeId].bSleeping = bSleeping;
+    }
+    bool IsSleeping(const size_t NodeId) const
+    {
+        return NodePool[NodeId].bSleeping;
+    }
+
     // 리프 노드 관련 디버깅 유틸리티 함수들
     size_t GetLeafNodeCount() const;
     bool IsLeafNode(size_t NodeId) const;
     std::vector<size_t> GetAllLeafNodeIds() const;
 
+    // 노드 풀과 빈 노드 목록을 그대로 기록/복원 - 리프가 가리키는 객체는 캡처 시점과 같아야 함
+    void WriteSnapshot(FPhysicsSnapshotWriter& Writer) const;
+    bool ReadSnapshot(FPhysicsSnapshotReader& Reader);
+
 private:
     // 노드 풀 관리
     size_t AllocateNode();
@@ -183,6 +237,11 @@ private:
     //현재상태를 기반으로 AABB 재계산 및 이전 정보 저장
     void ComputeNodeAABB(size_t NodeId, IDynamicBoundable* Object);
 
+    // 노드가 속한 계층의 루트
+    size_t& RootOf(bool bStatic) { return RootIds[static_cast<size_t>(bStatic ? ETreeType::Static : ETreeType::Dynamic)]; }
+    void AddDynamicLeaf(size_t NodeId);
+    void RemoveDynamicLeaf(size_t NodeId);
+
 public:
 	void PrintTreeStructure(std::ostream& os = std::cout) const;
 private:
@@ -193,6 +252,8 @@ private:
 private:
     std::vector<Node> NodePool;           // 노드 메모리 풀 - 모든 노드를 보관
     std::unordered_set<size_t> FreeNodes; // 재사용 가능한 노드 인덱스만 보관
-    size_t RootId = NULL_NODE;            // 루트 노드 인덱스
+    size_t RootIds[static_cast<size_t>(ETreeType::Count)] = { NULL_NODE, NULL_NODE };   // 계층별 루트 노드 인덱스
+    std::vector<size_t> DynamicLeaves;    // UpdateTree에서 검사할 동적 리프
     size_t NodeCount = 0;                 // 현재 사용 중인 노드 수
+    std::vector<size_t> MoveBuffer;       // 넓은 단계에서 다시 질의할 리프
 };
\ No newline at end of file
@@ -68,7 +68,7 @@ public:
 	const Vector3 GetWorldUp() const;
 	const Vector3 GetWorldRight() const;
 
-	__forceinline const FTransform& GetWorldTransform() const { return RootComponent->GetWorldTransform(); }
+	inline const FTransform& GetWorldTransform() const { return RootComponent->GetWorldTransform(); }
 	Matrix GetWorldMatrix() const  { return RootComponent->GetWorldTransform().GetModelingMatrix(); }
 
 protected:
@@ -146,7 +146,7 @@ Quaternion Quaternion::LookRotation(const Vector3& LookAtDirection, const Vector
 
 	// Up과 Forward가 거의 평행하여 Right 벡터가 매우 작을 때 처리합니다.
 	// 이 상황에서는 Forward에 직교하는 다른 기준 축을 사용하여 Right를 다시 계산해야 합니다.
-	if (XMVector3LengthSq(vRight).m128_f32[0] < KINDA_SMALL)
+	if (XMVectorGetX(XMVector3LengthSq(vRight)) < KINDA_SMALL)
 	{
 		// Forward 벡터에 직교하는 안정적인 대체 축을 선택합니다.
 		// 만약 Forward가 Z축과 거의 평행하다면 (0,0,1)과 외적 시 영벡터가 될 수 있으므로 (0,1,0) Y축을 사용합니다.
@@ -165,7 +165,7 @@ Quaternion Quaternion::LookRotation(const Vector3& LookAtDirection, const Vector
 
 		// 예외적인 상황: 만약 대체 축 선택 로직에도 문제가 있거나 (매우 드물지만)
 		// Right 벡터가 여전히 너무 작다면 유효한 회전 행렬 생성이 불가능합니다.
-		if (XMVector3LengthSq(vRight).m128_f32[0] < KINDA_SMALL)
+		if (XMVectorGetX(XMVector3LengthSq(vRight)) < KINDA_SMALL)
 		{
 			// 최후의 안전 장치: 유효한 입력을 얻지 못했으므로 기본 회전 (identity) 반환
 			return Quaternion(0, 0, 0, 1.0f);
@@ -1,5 +1,5 @@
 #pragma once
-#include <directxmath.h>
+#include <DirectXMath.h>
 #include <cmath>
 #include <algorithm>
 
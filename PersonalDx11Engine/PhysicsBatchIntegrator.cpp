@@ -0,0 +1,68 @@
+#include "PhysicsBatchIntegrator.h"
+#include "PhysicsBatchIntegratorLanes.h"
+#include <algorithm>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace
+{
+    EPhysicsSimdLevel DetectSimdLevel()
+    {
+#ifdef _MSC_VER
+        int Info[4];
+        __cpuid(Info, 0);
+        const int MaxLeaf = Info[0];
+
+        __cpuid(Info, 1);
+        const bool bOSXSave = (Info[2] & (1 << 27)) != 0;
+        const bool bAVX = (Info[2] & (1 << 28)) != 0;
+        // OS가 YMM 레지스터 상태를 저장하는 경우에만 AVX 사용 가능
+        if (MaxLeaf >= 7 && bOSXSave && bAVX && (_xgetbv(0) & 0x6) == 0x6)
+        {
+            __cpuidex(Info, 7, 0);
+            if ((Info[1] & (1 << 5)) != 0)
+                return EPhysicsSimdLevel::AVX2;
+        }
+        return EPhysicsSimdLevel::SSE;
+#else
+        return __builtin_cpu_supports("avx2") ? EPhysicsSimdLevel::AVX2 : EPhysicsSimdLevel::SSE;
+#endif
+    }
+}
+
+EPhysicsSimdLevel FPhysicsBatchIntegrator::GetSupportedSimdLevel()
+{
+    static const EPhysicsSimdLevel Supported = DetectSimdLevel();
+    return Supported;
+}
+
+void FPhysicsBatchIntegrator::Integrate(FPhysicsBodyStore& Store, size_t Begin, size_t End, float DeltaTime,
+                                        EPhysicsSimdLevel Level)
+{
+    End = std::min(End, Store.GetCapacity());
+    if (Begin >= End)
+        return;
+
+    Level = std::min(Level, GetSupportedSimdLevel());
+
+    // 넓은 레인부터 처리하고 남은 슬롯은 좁은 레인으로 넘김
+    size_t Index = Begin;
+    if (Level == EPhysicsSimdLevel::AVX2)
+    {
+        Index = IntegrateAvx2(Store, Index, End, DeltaTime);
+    }
+    if (Level >= EPhysicsSimdLevel::SSE)
+    {
+        Index = IntegrateLanes<FFloat4>(Store, Index, End, DeltaTime);
+    }
+    IntegrateLanes<FFloat1>(Store, Index, End, DeltaTime);
+}
+
+void FPhysicsBatchIntegrator::IntegrateBody(FPhysicsBodyStore& Store, FPhysicsBodyId Id, float DeltaTime)
+{
+    if (Id >= Store.GetCapacity())
+        return;
+
+    IntegrateGroup<FFloat1>(Store, Id, DeltaTime, BODY_FLAG_MASK);
+}
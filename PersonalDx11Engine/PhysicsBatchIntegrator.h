@@ -0,0 +1,44 @@
+#pragma once
+#include "PhysicsBodyStore.h"
+#include <cstdint>
+
+enum class EPhysicsSimdLevel : uint8_t
+{
+    Scalar = 0,
+    SSE = 1,    // 4 강체 / 명령
+    AVX2 = 2,   // 8 강체 / 명령
+};
+
+/// <summary>
+/// FPhysicsBodyStore 배열을 직접 순회하는 일괄 강체 적분기
+/// URigidBodyComponent::TickPhysics와 동일한 드래그/중력/마찰/속도 제한/트랜스폼 갱신을
+/// SIMD 레인 단위로 수행하며, 분기는 레인 마스크 선택으로 대체함
+/// 나머지 강체는 스칼라 경로로 처리
+/// </summary>
+class FPhysicsBatchIntegrator
+{
+public:
+    // 범위 분할 시 덩어리 경계 정렬 단위 - 가장 넓은 레인 폭
+    static constexpr size_t LANE_ALIGNMENT = 8;
+
+    // 현재 CPU에서 사용 가능한 최고 SIMD 수준
+    static EPhysicsSimdLevel GetSupportedSimdLevel();
+
+    /// <summary>
+    /// [Begin, End) 범위의 슬롯을 DeltaTime만큼 적분
+    /// 활성(ALIVE|ACTIVE)이면서 정적/수면/지역 서브스텝 상태가 아닌 슬롯만 갱신되고, 나머지 슬롯은 그대로 유지됨
+    /// 요청 수준이 지원되지 않으면 지원되는 최고 수준으로 낮춤
+    /// </summary>
+    static void Integrate(FPhysicsBodyStore& Store, size_t Begin, size_t End, float DeltaTime,
+                          EPhysicsSimdLevel Level);
+
+    /// <summary>
+    /// 단일 슬롯을 스칼라 경로로 적분 - 지역 서브스텝 중인 슬롯도 갱신함
+    /// 정적/수면/비활성 슬롯은 그대로 유지됨
+    /// </summary>
+    static void IntegrateBody(FPhysicsBodyStore& Store, FPhysicsBodyId Id, float DeltaTime);
+
+private:
+    // AVX2 레인 적분 (PhysicsBatchIntegratorAvx2.cpp) - 처리하지 못한 첫 인덱스 반환, AVX2 지원 CPU에서만 호출
+    static size_t IntegrateAvx2(FPhysicsBodyStore& Store, size_t Begin, size_t End, float DeltaTime);
+};
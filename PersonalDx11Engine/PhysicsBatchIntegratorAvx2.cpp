@@ -0,0 +1,13 @@
+// AVX2 레인 적분 - 이 번역 단위만 AVX2 명령 생성을 허용해 빌드함 (GCC/Clang은 -mavx2)
+// 스칼라/SSE 경로와 CPU 지원 검사는 PhysicsBatchIntegrator.cpp에 있음
+#define PHYSICS_SIMD_AVX2_UNIT
+#include "PhysicsBatchIntegrator.h"
+#include "PhysicsBatchIntegratorLanes.h"
+
+size_t FPhysicsBatchIntegrator::IntegrateAvx2(FPhysicsBodyStore& Store, size_t Begin, size_t End, float DeltaTime)
+{
+    const size_t Index = IntegrateLanes<FFloat8>(Store, Begin, End, DeltaTime);
+    // 이후 SSE 코드의 전환 비용 방지
+    _mm256_zeroupper();
+    return Index;
+}
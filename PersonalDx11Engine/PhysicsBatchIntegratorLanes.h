@@ -0,0 +1,208 @@
+#pragma once
+#include "PhysicsBatchIntegrator.h"
+#include "PhysicsDefine.h"
+#include "PhysicsSimdLanes.h"
+#include "Transform.h"
+#include <cmath>
+
+/// <summary>
+/// 일괄 적분기 레인 커널 - PhysicsBatchIntegrator.cpp(스칼라/SSE)와 PhysicsBatchIntegratorAvx2.cpp(AVX2)에서 포함
+/// 익명 이름공간으로 두어 번역 단위마다 따로 인스턴스화됨 (AVX2로 빌드한 사본이 다른 경로에 쓰이지 않음)
+/// </summary>
+namespace
+{
+    using namespace PhysicsSimd;
+
+    // 적분 대상: 살아있고 활성이며, 정적/수면이 아닌 슬롯
+    constexpr uint8_t BODY_FLAG_MASK = FPhysicsBodyStore::BODY_ALIVE | FPhysicsBodyStore::BODY_ACTIVE |
+        FPhysicsBodyStore::BODY_STATIC | FPhysicsBodyStore::BODY_SLEEP;
+    // 전체 적분은 지역 서브스텝 중인 슬롯도 제외
+    constexpr uint8_t SIMULATE_FLAG_MASK = BODY_FLAG_MASK | FPhysicsBodyStore::BODY_SUBSTEP;
+    constexpr uint8_t SIMULATE_FLAG_VALUE = FPhysicsBodyStore::BODY_ALIVE | FPhysicsBodyStore::BODY_ACTIVE;
+
+#pragma region Lane Vector Math
+    // URigidBodyComponent::ClampLinearVelocity / ClampAngularVelocity와 동일
+    template<typename F>
+    inline TVec3<F> ClampSpeed(const TVec3<F>& InVelocity, F MaxSpeed)
+    {
+        const auto bRestricted = !(MaxSpeed < F::Splat(0.0f));
+        const F SpeedSq = LengthSq(InVelocity);
+        const auto bOver = bRestricted & (SpeedSq > MaxSpeed * MaxSpeed);
+        const auto bUnder = bRestricted & !bOver & (SpeedSq < F::Splat(KINDA_SMALL));
+        return Select(bOver, Normalize(InVelocity) * MaxSpeed,
+                      Select(bUnder, Zero3<F>(), InVelocity));
+    }
+#pragma endregion
+
+    /// <summary>
+    /// F::Width개의 연속 슬롯을 적분 - URigidBodyComponent::TickPhysics 분기를 레인 마스크로 옮긴 것
+    /// 조건이 거짓인 레인은 기존 값을 그대로 다시 기록함
+    /// </summary>
+    template<typename F>
+    void IntegrateGroup(FPhysicsBodyStore& Store, const size_t Index, const float DeltaTime, const uint8_t FlagMask)
+    {
+        using FMask = typename F::FMask;
+
+        const FMask bSimulate = F::LoadFlagMask(&Store.Flags[Index], FlagMask, SIMULATE_FLAG_VALUE);
+        if (!Any(bSimulate))
+            return;
+        const FMask bGravity = F::LoadFlagMask(&Store.Flags[Index], FPhysicsBodyStore::BODY_GRAVITY,
+                                               FPhysicsBodyStore::BODY_GRAVITY);
+
+        const F Small = F::Splat(KINDA_SMALL);
+        const F Dt = F::Splat(DeltaTime);
+        const TVec3<F> ZeroVec = Zero3<F>();
+
+        //물리 상태 초기화
+        const TVec3<F> OldVelocity = LoadVec3<F>(&Store.Velocities[Index]);
+        const TVec3<F> OldAngularVelocity = LoadVec3<F>(&Store.AngularVelocities[Index]);
+        const TVec3<F> OldForce = LoadVec3<F>(&Store.AccumulatedForces[Index]);
+        const TVec3<F> OldTorque = LoadVec3<F>(&Store.AccumulatedTorques[Index]);
+
+        TVec3<F> Velocity = OldVelocity;
+        TVec3<F> AngularVelocity = OldAngularVelocity;
+        TVec3<F> Force = OldForce;
+        const TVec3<F> Torque = OldTorque;
+
+        const F InvMass = F::Load(&Store.InvMasses[Index]);
+        const TVec3<F> InvInertia = LoadVec3<F>(&Store.InvRotationalInertias[Index]);
+        const F FrictionKinetic = F::Load(&Store.FrictionKinetics[Index]);
+        const F FrictionStatic = F::Load(&Store.FrictionStatics[Index]);
+        const F GravityFactor = F::Load(&Store.GravityScales[Index]) * F::Splat(ONE_METER);
+
+        //공기 저항
+        TVec3<F> TotalAcceleration =
+            Normalize(Velocity) * (-LengthSq(Velocity) * F::Splat(LINEAR_DRAG_COEFFICIENT) * InvMass);
+        TVec3<F> TotalAngularAcceleration =
+            Mul(Normalize(AngularVelocity) * (-LengthSq(AngularVelocity) * F::Splat(ANGULAR_DRAG_COEFFICIENT)),
+                InvInertia);
+
+        // 중력 가속도 추가
+        TotalAcceleration = TotalAcceleration +
+            Select(bGravity, LoadVec3<F>(&Store.GravityDirections[Index]) * GravityFactor, ZeroVec);
+
+        //마찰력
+        {
+            const F SpeedSq = LengthSq(Velocity);
+            const FMask bMoving = SpeedSq > Small;
+            // 정적 마찰력이 외력을 상쇄 (|F| <= Fs * g / InvMass)
+            const FMask bStaticFriction = bMoving & (Sqrt(SpeedSq) < Small) &
+                (Sqrt(LengthSq(Force)) * InvMass <= FrictionStatic * GravityFactor);
+            Force = Select(bStaticFriction, ZeroVec, Force);
+            Velocity = Select(bStaticFriction, ZeroVec, Velocity);
+
+            // 운동 마찰력 - 속도의 방향을 바꾸지 않는 범위에서만 적용
+            const FMask bKinetic = bMoving & !bStaticFriction;
+            const TVec3<F> FrictionAccel = Normalize(Velocity) * (-(FrictionKinetic * GravityFactor));
+            const TVec3<F> NewVelocity = Velocity + FrictionAccel * Dt;
+            const FMask bKeepDirection = Dot(NewVelocity, Velocity) > Small;
+
+            TotalAcceleration = TotalAcceleration + Select(bKinetic & bKeepDirection, FrictionAccel, ZeroVec);
+            Velocity = Select(bKinetic & !bKeepDirection, ZeroVec, Velocity);
+        }
+
+        // 각운동 마찰력 처리 - 축별 정적/운동 마찰
+        {
+            const FMask bSpinning = LengthSq(AngularVelocity) > Small;
+            auto AxisFriction = [&](F Angular, F AxisTorque, F AxisInvInertia)
+                {
+                    const FMask bStatic = (Abs(Angular) < Small) & (Abs(AxisTorque) * AxisInvInertia <= FrictionStatic);
+                    return Select(bStatic, -AxisTorque, -(Angular * FrictionKinetic));
+                };
+            const TVec3<F> FrictionAccel = {
+                AxisFriction(AngularVelocity.X, Torque.X, InvInertia.X),
+                AxisFriction(AngularVelocity.Y, Torque.Y, InvInertia.Y),
+                AxisFriction(AngularVelocity.Z, Torque.Z, InvInertia.Z)
+            };
+            TotalAngularAcceleration = TotalAngularAcceleration + Select(bSpinning, FrictionAccel, ZeroVec);
+        }
+
+        // 외부에서 적용된 힘에 의한 가속도 추가
+        const F ForceThresholdSq = F::Splat(100.0f);
+        TotalAcceleration = TotalAcceleration +
+            Select(LengthSq(Force) > ForceThresholdSq, Force * InvMass, ZeroVec);
+        TotalAngularAcceleration = TotalAngularAcceleration +
+            Select(LengthSq(Torque) > ForceThresholdSq, Mul(Torque, InvInertia), ZeroVec);
+
+        // 통합된 가속도로 속도 업데이트
+        const F One = F::Splat(1.0f);
+        Velocity = Velocity + Select(LengthSq(TotalAcceleration) > One, TotalAcceleration * Dt, ZeroVec);
+        AngularVelocity = AngularVelocity +
+            Select(LengthSq(TotalAngularAcceleration) > One, TotalAngularAcceleration * Dt, ZeroVec);
+
+        // 속도 제한
+        Velocity = ClampSpeed(Velocity, F::Load(&Store.MaxSpeeds[Index]));
+        AngularVelocity = ClampSpeed(AngularVelocity, F::Load(&Store.MaxAngularSpeeds[Index]));
+
+        //상태값 저장 - 의미있는 변화만 반영, 외부힘은 제로로 초기화
+        Velocity = Select(bSimulate & (LengthSq(OldVelocity - Velocity) > Small), Velocity, OldVelocity);
+        AngularVelocity = Select(bSimulate & (LengthSq(OldAngularVelocity - AngularVelocity) > Small),
+                                 AngularVelocity, OldAngularVelocity);
+        StoreVec3(&Store.Velocities[Index], Velocity);
+        StoreVec3(&Store.AngularVelocities[Index], AngularVelocity);
+        StoreVec3(&Store.AccumulatedForces[Index], Select(bSimulate, ZeroVec, OldForce));
+        StoreVec3(&Store.AccumulatedTorques[Index], Select(bSimulate, ZeroVec, OldTorque));
+
+        //  저장된 상태값에 따른 위치 업데이트 (P_UpdateTransformByVelocity)
+        const TVec3<F> Position = LoadVec3<F>(&Store.Positions[Index]);
+        TQuat<F> Rotation;
+        F::LoadQuat(&Store.Rotations[Index].x, Rotation.X, Rotation.Y, Rotation.Z, Rotation.W);
+
+        const FMask bMove = bSimulate & (LengthSq(Velocity) > Small);
+        const TVec3<F> NewPosition = Select(bMove, Position + Velocity * Dt, Position);
+
+        const F AngularSpeedSq = LengthSq(AngularVelocity);
+        const FMask bSpin = bSimulate & (AngularSpeedSq > Small);
+        const F AngularSpeed = Sqrt(AngularSpeedSq);
+        const F Angle = AngularSpeed * Dt;
+        const FMask bRotate = bSpin & (AngularSpeed > Small) &
+            (Angle * F::Splat(180.0f / XM_PI) > Small);
+
+        TQuat<F> NewRotation = Rotation;
+        if (Any(bRotate))
+        {
+            // FTransform::RotateAroundAxis - 현재 자세로 회전축을 변환한 뒤 결합
+            const TVec3<F> Axis = AngularVelocity * (One / Select(bRotate, AngularSpeed, One));
+            const TVec3<F> LocalAxis = Normalize(RotateVector(Axis, NormalizeQuat(Rotation)));
+
+            F HalfSin, HalfCos;
+            SinCos(Angle * F::Splat(0.5f), HalfSin, HalfCos);
+            const TQuat<F> Delta = { LocalAxis.X * HalfSin, LocalAxis.Y * HalfSin, LocalAxis.Z * HalfSin, HalfCos };
+            const TQuat<F> Combined = NormalizeQuat(MultiplyQuat(Rotation, Delta));
+
+            NewRotation = {
+                Select(bRotate, Combined.X, Rotation.X),
+                Select(bRotate, Combined.Y, Rotation.Y),
+                Select(bRotate, Combined.Z, Rotation.Z),
+                Select(bRotate, Combined.W, Rotation.W)
+            };
+        }
+
+        // P_SetWorldTransform - 의미있는 변화가 있을 때만 기록
+        const F TransformEpsilon = F::Splat(FTransform::TRANSFORM_EPSILON);
+        const FMask bPositionChanged = LengthSq(NewPosition - Position) > TransformEpsilon * TransformEpsilon;
+        const FMask bRotationChanged = Abs(One - Abs(DotQuat(Rotation, NewRotation))) > TransformEpsilon;
+        const FMask bUpdate = (bMove | bSpin) & (bPositionChanged | bRotationChanged);
+        if (!Any(bUpdate))
+            return;
+
+        StoreVec3(&Store.Positions[Index], Select(bUpdate, NewPosition, Position));
+        F::StoreQuat(&Store.Rotations[Index].x,
+                     Select(bUpdate, NewRotation.X, Rotation.X),
+                     Select(bUpdate, NewRotation.Y, Rotation.Y),
+                     Select(bUpdate, NewRotation.Z, Rotation.Z),
+                     Select(bUpdate, NewRotation.W, Rotation.W));
+    }
+
+    // 레인 폭 단위로 처리 가능한 만큼 적분하고, 처리하지 못한 첫 인덱스 반환
+    template<typename F>
+    size_t IntegrateLanes(FPhysicsBodyStore& Store, size_t Begin, size_t End, float DeltaTime)
+    {
+        size_t Index = Begin;
+        for (; Index + F::Width <= End; Index += F::Width)
+        {
+            IntegrateGroup<F>(Store, Index, DeltaTime, SIMULATE_FLAG_MASK);
+        }
+        return Index;
+    }
+}
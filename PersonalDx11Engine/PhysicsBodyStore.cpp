@@ -0,0 +1,328 @@
+#include "PhysicsBodyStore.h"
+#include "PhysicsJob.h"
+#include "PhysicsDefine.h"
+#include "PhysicsSnapshot.h"
+#include <cstring>
+
+namespace
+{
+    // 최대 속력으로 제한 - 음수면 제한 없음
+    void ClampSpeed(Vector3& OutVelocity, const float MaxSpeed)
+    {
+        if (MaxSpeed < 0.0f)
+            return;
+
+        const float SpeedSq = OutVelocity.LengthSquared();
+        if (SpeedSq > MaxSpeed * MaxSpeed)
+        {
+            OutVelocity = OutVelocity.GetNormalized() * MaxSpeed;
+        }
+        else if (SpeedSq < KINDA_SMALL)
+        {
+            OutVelocity = Vector3::Zero();
+        }
+    }
+}
+
+void FPhysicsBodyStore::Reserve(size_t InCapacity)
+{
+    Positions.reserve(InCapacity);
+    Rotations.reserve(InCapacity);
+    Scales.reserve(InCapacity);
+    PrevPositions.reserve(InCapacity);
+    PrevRotations.reserve(InCapacity);
+    Velocities.reserve(InCapacity);
+    AngularVelocities.reserve(InCapacity);
+    AccumulatedForces.reserve(InCapacity);
+    AccumulatedTorques.reserve(InCapacity);
+    InvMasses.reserve(InCapacity);
+    InvRotationalInertias.reserve(InCapacity);
+    Restitutions.reserve(InCapacity);
+    FrictionStatics.reserve(InCapacity);
+    FrictionKinetics.reserve(InCapacity);
+    GravityDirections.reserve(InCapacity);
+    GravityScales.reserve(InCapacity);
+    MaxSpeeds.reserve(InCapacity);
+    MaxAngularSpeeds.reserve(InCapacity);
+    SleepTimers.reserve(InCapacity);
+    Flags.reserve(InCapacity);
+    FreeIds.reserve(InCapacity);
+    Generations.reserve(InCapacity);
+}
+
+bool FPhysicsBodyStore::Reset()
+{
+    if (GetAliveCount() > 0)
+        return false;
+
+    Positions.clear();
+    Rotations.clear();
+    Scales.clear();
+    PrevPositions.clear();
+    PrevRotations.clear();
+    Velocities.clear();
+    AngularVelocities.clear();
+    AccumulatedForces.clear();
+    AccumulatedTorques.clear();
+    InvMasses.clear();
+    InvRotationalInertias.clear();
+    Restitutions.clear();
+    FrictionStatics.clear();
+    FrictionKinetics.clear();
+    GravityDirections.clear();
+    GravityScales.clear();
+    MaxSpeeds.clear();
+    MaxAngularSpeeds.clear();
+    SleepTimers.clear();
+    Flags.clear();
+    FreeIds.clear();
+    Generations.clear();
+    ++LayoutVersion;
+    return true;
+}
+
+FPhysicsBodyId FPhysicsBodyStore::Allocate()
+{
+    FPhysicsBodyId Id;
+    if (!FreeIds.empty())
+    {
+        Id = FreeIds.back();
+        FreeIds.pop_back();
+    }
+    else
+    {
+        Id = static_cast<FPhysicsBodyId>(Flags.size());
+        Positions.emplace_back();
+        Rotations.emplace_back();
+        Scales.emplace_back();
+        PrevPositions.emplace_back();
+        PrevRotations.emplace_back();
+        Velocities.emplace_back();
+        AngularVelocities.emplace_back();
+        AccumulatedForces.emplace_back();
+        AccumulatedTorques.emplace_back();
+        InvMasses.emplace_back();
+        InvRotationalInertias.emplace_back();
+        Restitutions.emplace_back();
+        FrictionStatics.emplace_back();
+        FrictionKinetics.emplace_back();
+        GravityDirections.emplace_back();
+        GravityScales.emplace_back();
+        MaxSpeeds.emplace_back();
+        MaxAngularSpeeds.emplace_back();
+        SleepTimers.emplace_back();
+        Flags.emplace_back();
+        Generations.emplace_back(0);
+    }
+
+    // 슬롯 초기화
+    Positions[Id] = Vector3::Zero();
+    Rotations[Id] = Quaternion::Identity();
+    Scales[Id] = Vector3::One();
+    PrevPositions[Id] = Vector3::Zero();
+    PrevRotations[Id] = Quaternion::Identity();
+    ResetMotion(Id);
+    InvMasses[Id] = 1.0f;
+    InvRotationalInertias[Id] = Vector3::Zero();
+    Restitutions[Id] = 0.5f;
+    FrictionStatics[Id] = 0.5f;
+    FrictionKinetics[Id] = 0.3f;
+    GravityDirections[Id] = -Vector3::Up();
+    GravityScales[Id] = 9.81f;
+    MaxSpeeds[Id] = -1.0f;
+    MaxAngularSpeeds[Id] = -1.0f;
+    SleepTimers[Id] = 0.0f;
+    Flags[Id] = BODY_ALIVE;
+    ++LayoutVersion;
+
+    return Id;
+}
+
+void FPhysicsBodyStore::Free(FPhysicsBodyId Id)
+{
+    if (!IsValid(Id))
+        return;
+
+    Flags[Id] = 0;
+    ++Generations[Id];
+    FreeIds.push_back(Id);
+    ++LayoutVersion;
+}
+
+void FPhysicsBodyStore::SetSleeping(FPhysicsBodyId Id, bool bSleep)
+{
+    SetFlag(Id, BODY_SLEEP, bSleep);
+    if (bSleep)
+    {
+        ResetMotion(Id);
+    }
+}
+
+void FPhysicsBodyStore::ResetMotion(FPhysicsBodyId Id)
+{
+    Velocities[Id] = Vector3::Zero();
+    AngularVelocities[Id] = Vector3::Zero();
+    AccumulatedForces[Id] = Vector3::Zero();
+    AccumulatedTorques[Id] = Vector3::Zero();
+}
+
+void FPhysicsBodyStore::Awake(FPhysicsBodyId Id)
+{
+    SetFlag(Id, BODY_SLEEP, false);
+    SleepTimers[Id] = 0.0f;
+}
+
+void FPhysicsBodyStore::ApplyCoalescedJob(FPhysicsBodyId Id, const FCoalescedPhysicsJob& InJob)
+{
+    if (!IsValid(Id) || IsStatic(Id))
+        return;
+
+    const bool bActive = HasFlag(Id, BODY_ACTIVE);
+    bool bWake = false;
+
+    if (InJob.Check(EPhysicsJob::SET_WORLDTRANSFORM))
+    {
+        const FTransform& InTransform = InJob.WorldTransform;
+        const bool bIsUpdate = FTransform::IsValidScale(Scales[Id] - InTransform.Scale) ||
+            FTransform::IsValidRotation(Rotations[Id], InTransform.Rotation) ||
+            FTransform::IsValidPosition(Positions[Id] - InTransform.Position);
+        if (bIsUpdate)
+        {
+            Teleport(Id, InTransform);
+            bWake = true;
+        }
+    }
+
+    // 선속도 - 설정값 적용 후 증분과 충격량 합산, 제한은 마지막에 한 번
+    Vector3 Velocity = Velocities[Id];
+    bool bVelocityChanged = false;
+    if (InJob.Check(EPhysicsJob::SET_VELOCITY) && (Velocity - InJob.Velocity).LengthSquared() > KINDA_SMALL)
+    {
+        Velocity = InJob.Velocity;
+        bVelocityChanged = true;
+    }
+    Vector3 VelocityDelta = InJob.VelocityDelta;
+    if (bActive && InJob.Impulse.LengthSquared() > MIN_VALID_FORCE_SQUARED)
+    {
+        VelocityDelta += InJob.Impulse * InvMasses[Id];
+    }
+    if (VelocityDelta.LengthSquared() > KINDA_SMALL)
+    {
+        Velocity += VelocityDelta;
+        bVelocityChanged = true;
+    }
+    if (bVelocityChanged)
+    {
+        ClampSpeed(Velocity, MaxSpeeds[Id]);
+        Velocities[Id] = Velocity;
+        bWake = true;
+    }
+
+    // 각속도
+    Vector3 AngularVelocity = AngularVelocities[Id];
+    bool bAngularChanged = false;
+    if (InJob.Check(EPhysicsJob::SET_ANGULARVELOCITY) && (AngularVelocity - InJob.AngularVelocity).LengthSquared() > KINDA_SMALL)
+    {
+        AngularVelocity = InJob.AngularVelocity;
+        bAngularChanged = true;
+    }
+    Vector3 AngularDelta = InJob.AngularVelocityDelta;
+    if (bActive && InJob.AngularImpulse.LengthSquared() > MIN_VALID_TORQUE_SQUARED)
+    {
+        const Vector3& InvInertia = InvRotationalInertias[Id];
+        AngularDelta += Vector3(
+            InJob.AngularImpulse.x * InvInertia.x,
+            InJob.AngularImpulse.y * InvInertia.y,
+            InJob.AngularImpulse.z * InvInertia.z);
+    }
+    if (AngularDelta.LengthSquared() > KINDA_SMALL)
+    {
+        AngularVelocity += AngularDelta;
+        bAngularChanged = true;
+    }
+    if (bAngularChanged)
+    {
+        ClampSpeed(AngularVelocity, MaxAngularSpeeds[Id]);
+        AngularVelocities[Id] = AngularVelocity;
+        bWake = true;
+    }
+
+    // 누적 외력
+    if (bActive)
+    {
+        if (InJob.Force.LengthSquared() > MIN_VALID_FORCE_SQUARED)
+        {
+            AccumulatedForces[Id] += InJob.Force;
+            bWake = true;
+        }
+        if (InJob.Torque.LengthSquared() > MIN_VALID_TORQUE_SQUARED)
+        {
+            AccumulatedTorques[Id] += InJob.Torque;
+            bWake = true;
+        }
+    }
+
+    //외부 작용은 수면 중인 강체를 깨움
+    if (bWake && IsSleeping(Id))
+    {
+        Awake(Id);
+    }
+}
+
+void FPhysicsBodyStore::SavePreviousTransforms()
+{
+    // 크기가 같은 연속 배열이므로 통째로 복사
+    if (Positions.empty())
+        return;
+    std::memcpy(PrevPositions.data(), Positions.data(), Positions.size() * sizeof(Vector3));
+    std::memcpy(PrevRotations.data(), Rotations.data(), Rotations.size() * sizeof(Quaternion));
+}
+
+void FPhysicsBodyStore::WriteSnapshot(FPhysicsSnapshotWriter& Writer) const
+{
+    Writer.WriteArray(Positions);
+    Writer.WriteArray(Rotations);
+    Writer.WriteArray(Scales);
+    Writer.WriteArray(Velocities);
+    Writer.WriteArray(AngularVelocities);
+    Writer.WriteArray(AccumulatedForces);
+    Writer.WriteArray(AccumulatedTorques);
+    Writer.WriteArray(InvMasses);
+    Writer.WriteArray(InvRotationalInertias);
+    Writer.WriteArray(Restitutions);
+    Writer.WriteArray(FrictionStatics);
+    Writer.WriteArray(FrictionKinetics);
+    Writer.WriteArray(GravityDirections);
+    Writer.WriteArray(GravityScales);
+    Writer.WriteArray(MaxSpeeds);
+    Writer.WriteArray(MaxAngularSpeeds);
+    Writer.WriteArray(SleepTimers);
+    Writer.WriteArray(Flags);
+}
+
+bool FPhysicsBodyStore::ReadSnapshot(FPhysicsSnapshotReader& Reader)
+{
+    const size_t Capacity = Flags.size();
+
+    Reader.ReadArray(Positions);
+    Reader.ReadArray(Rotations);
+    Reader.ReadArray(Scales);
+    Reader.ReadArray(Velocities);
+    Reader.ReadArray(AngularVelocities);
+    Reader.ReadArray(AccumulatedForces);
+    Reader.ReadArray(AccumulatedTorques);
+    Reader.ReadArray(InvMasses);
+    Reader.ReadArray(InvRotationalInertias);
+    Reader.ReadArray(Restitutions);
+    Reader.ReadArray(FrictionStatics);
+    Reader.ReadArray(FrictionKinetics);
+    Reader.ReadArray(GravityDirections);
+    Reader.ReadArray(GravityScales);
+    Reader.ReadArray(MaxSpeeds);
+    Reader.ReadArray(MaxAngularSpeeds);
+    Reader.ReadArray(SleepTimers);
+    Reader.ReadArray(Flags);
+
+    // 슬롯 수가 달라졌다면 버전 검사를 우회한 잘못된 스냅샷
+    return Reader.IsGood() && Flags.size() == Capacity;
+}
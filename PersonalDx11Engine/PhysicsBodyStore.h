@@ -0,0 +1,171 @@
+#pragma once
+#include "Math.h"
+#include "Transform.h"
+#include <vector>
+#include <cstdint>
+
+using FPhysicsBodyId = uint32_t;
+
+struct FCoalescedPhysicsJob;
+class FPhysicsSnapshotWriter;
+class FPhysicsSnapshotReader;
+
+/// <summary>
+/// 물리 시스템 소유의 강체 시뮬레이션 상태 저장소 (Structure of Arrays)
+/// 각 속성을 연속 배열로 보관하며, 안정적인 BodyId로 인덱싱함
+/// 강체 컴포넌트는 BodyId를 통해 이 저장소를 읽고 쓰는 얇은 뷰 역할만 수행
+/// </summary>
+class FPhysicsBodyStore
+{
+public:
+    static constexpr FPhysicsBodyId INVALID_BODY = static_cast<FPhysicsBodyId>(-1);
+
+    enum EBodyFlag : uint8_t
+    {
+        BODY_ALIVE = 1 << 0,
+        BODY_STATIC = 1 << 1,
+        BODY_ACTIVE = 1 << 2,   // 컴포넌트 활성 상태
+        BODY_SLEEP = 1 << 3,
+        BODY_GRAVITY = 1 << 4,
+        BODY_SUBSTEP = 1 << 5,  // 지역 서브스텝 진행 중 - 전체 적분에서 제외
+    };
+
+public:
+    FPhysicsBodyStore() = default;
+    ~FPhysicsBodyStore() = default;
+
+    // 복사 및 이동 방지
+    FPhysicsBodyStore(const FPhysicsBodyStore&) = delete;
+    FPhysicsBodyStore& operator=(const FPhysicsBodyStore&) = delete;
+    FPhysicsBodyStore(FPhysicsBodyStore&&) = delete;
+    FPhysicsBodyStore& operator=(FPhysicsBodyStore&&) = delete;
+
+    void Reserve(size_t InCapacity);
+    // 살아 있는 강체가 없을 때 모든 슬롯을 비움 - 이후 할당은 0번 슬롯부터 순서대로, 용량은 유지
+    bool Reset();
+
+    // 새 강체 슬롯 할당 - 해제된 슬롯을 우선 재사용
+    FPhysicsBodyId Allocate();
+    void Free(FPhysicsBodyId Id);
+
+    bool IsValid(FPhysicsBodyId Id) const
+    {
+        return Id < Flags.size() && (Flags[Id] & BODY_ALIVE);
+    }
+    // 같은 세대의 강체가 살아 있는지 - 해제 후 재사용된 슬롯은 세대가 다름
+    bool IsValid(FPhysicsBodyId Id, uint16_t InGeneration) const
+    {
+        return IsValid(Id) && Generations[Id] == InGeneration;
+    }
+
+    // 슬롯 세대 - 해제마다 증가
+    uint16_t GetGeneration(FPhysicsBodyId Id) const { return Id < Generations.size() ? Generations[Id] : 0; }
+
+    // 할당된 슬롯 범위 (해제된 슬롯 포함)
+    size_t GetCapacity() const { return Flags.size(); }
+    size_t GetAliveCount() const { return Flags.size() - FreeIds.size(); }
+    // 할당/해제마다 증가 - 스냅샷 복원 가능 여부 판정용
+    uint64_t GetLayoutVersion() const { return LayoutVersion; }
+
+    inline FTransform GetWorldTransform(FPhysicsBodyId Id) const
+    {
+        FTransform Result;
+        Result.Position = Positions[Id];
+        Result.Rotation = Rotations[Id];
+        Result.Scale = Scales[Id];
+        return Result;
+    }
+
+    inline void SetWorldTransform(FPhysicsBodyId Id, const FTransform& InTransform)
+    {
+        Positions[Id] = InTransform.Position;
+        Rotations[Id] = InTransform.Rotation;
+        Scales[Id] = InTransform.Scale;
+    }
+
+    // 순간 이동 - 이전 단계 트랜스폼도 같이 설정하여 보간하지 않음
+    inline void Teleport(FPhysicsBodyId Id, const FTransform& InTransform)
+    {
+        SetWorldTransform(Id, InTransform);
+        PrevPositions[Id] = InTransform.Position;
+        PrevRotations[Id] = InTransform.Rotation;
+    }
+
+    // 이전 단계와 현재 트랜스폼 사이 보간 - 스케일은 현재값 사용
+    inline FTransform GetInterpolatedTransform(FPhysicsBodyId Id, float Alpha) const
+    {
+        FTransform Result;
+        Result.Position = Math::Lerp(PrevPositions[Id], Positions[Id], Alpha);
+        Result.Rotation = Math::Slerp(PrevRotations[Id], Rotations[Id], Alpha);
+        Result.Scale = Scales[Id];
+        return Result;
+    }
+
+    // 단계 시작 전 현재 위치/자세를 이전 단계 값으로 복사
+    void SavePreviousTransforms();
+
+    inline bool HasFlag(FPhysicsBodyId Id, EBodyFlag InFlag) const { return (Flags[Id] & InFlag) != 0; }
+    inline void SetFlag(FPhysicsBodyId Id, EBodyFlag InFlag, bool bEnable)
+    {
+        Flags[Id] = bEnable ? (Flags[Id] | InFlag) : (Flags[Id] & ~InFlag);
+    }
+
+    inline bool IsStatic(FPhysicsBodyId Id) const { return HasFlag(Id, BODY_STATIC); }
+    inline void SetStatic(FPhysicsBodyId Id, bool bStatic) { SetFlag(Id, BODY_STATIC, bStatic); }
+
+    inline bool IsSleeping(FPhysicsBodyId Id) const { return HasFlag(Id, BODY_SLEEP); }
+    // 수면 진입 시 운동 상태도 초기화
+    void SetSleeping(FPhysicsBodyId Id, bool bSleep);
+
+    // 속도와 누적 외력 초기화
+    void ResetMotion(FPhysicsBodyId Id);
+
+    // 외부 작용으로 수면 해제 - 수면 판정 시간도 초기화
+    void Awake(FPhysicsBodyId Id);
+
+    // 합쳐진 작업을 슬롯에 한 번에 적용 - 정적/비활성 판정과 속도 제한 포함
+    void ApplyCoalescedJob(FPhysicsBodyId Id, const FCoalescedPhysicsJob& InJob);
+
+    // 모든 속성 배열을 그대로 기록/복원 - 슬롯 구성이 같을 때만 복원
+    void WriteSnapshot(FPhysicsSnapshotWriter& Writer) const;
+    bool ReadSnapshot(FPhysicsSnapshotReader& Reader);
+
+public:
+    // 위치/자세
+    std::vector<Vector3> Positions;
+    std::vector<Quaternion> Rotations;
+    std::vector<Vector3> Scales;
+
+    // 직전 단계 시작 시점 위치/자세 - 렌더링 보간용
+    std::vector<Vector3> PrevPositions;
+    std::vector<Quaternion> PrevRotations;
+
+    // 운동 상태
+    std::vector<Vector3> Velocities;
+    std::vector<Vector3> AngularVelocities;
+    std::vector<Vector3> AccumulatedForces;
+    std::vector<Vector3> AccumulatedTorques;
+
+    // 물리 속성
+    std::vector<float> InvMasses;
+    std::vector<Vector3> InvRotationalInertias;
+    std::vector<float> Restitutions;
+    std::vector<float> FrictionStatics;
+    std::vector<float> FrictionKinetics;
+
+    // 적분 설정 - 일괄 적분기가 컴포넌트를 거치지 않고 읽음
+    std::vector<Vector3> GravityDirections;
+    std::vector<float> GravityScales;
+    std::vector<float> MaxSpeeds;           // 음수면 제한 없음
+    std::vector<float> MaxAngularSpeeds;    // 음수면 제한 없음
+
+    // 수면 판정 - 에너지 임계값 아래에 머문 누적 시간
+    std::vector<float> SleepTimers;
+
+    std::vector<uint8_t> Flags;
+
+private:
+    std::vector<FPhysicsBodyId> FreeIds;
+    std::vector<uint16_t> Generations;     // 슬롯별 해제 횟수 - 재사용된 슬롯으로 향한 작업 판별용
+    uint64_t LayoutVersion = 0;
+};
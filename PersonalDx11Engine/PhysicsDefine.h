@@ -3,3 +3,11 @@
 //1m에 해당하는 수치
 #define ONE_METER (100.0f)
 
+
+//공기 저항 계수
+#define LINEAR_DRAG_COEFFICIENT (0.01f)
+#define ANGULAR_DRAG_COEFFICIENT (0.1f)
+
+//외부 작용 유효 판정 기준 (크기 제곱)
+#define MIN_VALID_FORCE_SQUARED (100.0f)
+#define MIN_VALID_TORQUE_SQUARED (100.0f)
@@ -1,6 +1,10 @@
 #pragma once
-#include "PhysicsStateInternalInterface.h"
+#include "Math.h"
+#include "Transform.h"
+#include "PhysicsBodyStore.h"
 #include <bitset>
+#include <cstdint>
+#include <type_traits>
 
 using maksType = std::uint16_t;
 
@@ -15,177 +19,181 @@ enum class EPhysicsJob : uint8_t
 	SET_WORLDTRANSFORM,
 };
 
- struct alignas(16) FPhysicsJob
+/// <summary>
+/// 물리 작업 명령 - 작업 종류 태그와 페이로드만 가진 고정 크기 POD
+/// 가상 함수/소멸자가 없어 평탄한 버퍼에 memcpy로 기록하고, 제출 순서대로 대상별로 합쳐 switch로 실행함
+/// </summary>
+struct alignas(16) FPhysicsJob
 {
-private:
-	std::bitset<16> JobTypeMask;
-protected:
-	inline uint16_t GetRaw() { return JobTypeMask.to_ulong(); }
-	inline uint16_t Count() { return JobTypeMask.count(); }
-
-	inline void ResetAll() { JobTypeMask.reset(); }
-	inline void Reset(EPhysicsJob JobType) { if(Check(JobType)) JobTypeMask.flip((maksType)JobType); }
-
-	inline void Flip() { JobTypeMask.flip(); }
-	inline void Flip(EPhysicsJob JobType) { JobTypeMask.flip((maksType)JobType); }
-
-	inline void Set(EPhysicsJob JobType) { JobTypeMask.set((maksType)JobType); }
-	inline bool Check(EPhysicsJob JobType) { return JobTypeMask.test((maksType)JobType); }
-
-public:
-	virtual void Execute(IPhysicsStateInternal* PhysicsObj) = 0;
-};
-
-struct alignas(16) FJobApplyForce : public FPhysicsJob
-{
-private:
-	Vector3 Force;
-	Vector3 WorldPosition;
-	bool bToCOM : 1;
-
-public:
-
-	explicit  FJobApplyForce(Vector3 InForece, Vector3 InWorldPosition) :
-		Force(InForece), WorldPosition(InWorldPosition), bToCOM(false)
+	enum EJobFlag : uint8_t
 	{
-		Set(EPhysicsJob::APPLY_FORCE);
+		JOB_AT_LOCATION = 1 << 0,	// 위치 지정 힘/충격량 - 아니면 질량 중심에 작용
 	};
-	explicit  FJobApplyForce(Vector3 InForece) :
-		Force(InForece), WorldPosition(Vector3::Zero()), bToCOM(true)
+
+	struct FVectorPayload
 	{
-		Set(EPhysicsJob::APPLY_FORCE);
+		Vector3 Value;
+		Vector3 Location;
 	};
 
-	void Execute(IPhysicsStateInternal* PhysicsObj)
+	union FPayload
 	{
-		if (bToCOM)
-		{
-			PhysicsObj->P_ApplyForce(Force);
-		}
-		else
-		{
-			PhysicsObj->P_ApplyForce(Force, WorldPosition);
-		}
+		FVectorPayload Vector;
+		FTransform Transform;
 
-	}
-};
+		FPayload() : Vector() {}
+	};
 
-struct alignas(16) FJobApplyImpulse : public FPhysicsJob
-{
-private:
-	Vector3 Force;
-	Vector3 WorldPosition;
-	bool bToCOM : 1;
+	EPhysicsJob Type = EPhysicsJob::APPLY_FORCE;
+	uint8_t Flags = 0;
+	uint16_t TargetGeneration = 0;	// 큐가 기록하는 제출 시점 대상 슬롯 세대 - 실행 시 다르면 폐기
+	FPhysicsBodyId TargetId = FPhysicsBodyStore::INVALID_BODY;
+	uint64_t Sequence = 0;		// 큐가 기록하는 전역 제출 순서
+	FPayload Payload;
 
-public:
+	inline bool HasFlag(EJobFlag InFlag) const { return (Flags & InFlag) != 0; }
 
-	explicit  FJobApplyImpulse(Vector3 InForece, Vector3 InWorldPosition) :
-		Force(InForece), WorldPosition(InWorldPosition), bToCOM(false)
+#pragma region Factory
+	static FPhysicsJob ApplyForce(FPhysicsBodyId InTarget, const Vector3& InForce)
 	{
-		Set(EPhysicsJob::APPLY_IMPULSE);
-	};
-	explicit  FJobApplyImpulse(Vector3 InForece) :
-		Force(InForece), WorldPosition(Vector3::Zero()), bToCOM(true)
+		return MakeVector(EPhysicsJob::APPLY_FORCE, InTarget, InForce);
+	}
+	static FPhysicsJob ApplyForce(FPhysicsBodyId InTarget, const Vector3& InForce, const Vector3& InWorldPosition)
 	{
-		Set(EPhysicsJob::APPLY_IMPULSE);
-	};
-
-	void Execute(IPhysicsStateInternal* PhysicsObj)
+		return MakeVector(EPhysicsJob::APPLY_FORCE, InTarget, InForce, &InWorldPosition);
+	}
+	static FPhysicsJob ApplyImpulse(FPhysicsBodyId InTarget, const Vector3& InImpulse)
 	{
-		if (bToCOM)
-		{
-			PhysicsObj->P_ApplyImpulse(Force);
-		}
-		else
-		{
-			PhysicsObj->P_ApplyImpulse(Force, WorldPosition);
-		}
-
+		return MakeVector(EPhysicsJob::APPLY_IMPULSE, InTarget, InImpulse);
 	}
-};
-
-struct alignas(16) FJobSetVelocity : public FPhysicsJob
-{
-private:
-	Vector3 Velocity;
-
-public:
-	explicit  FJobSetVelocity(Vector3 InVelocity) : Velocity(InVelocity)
+	static FPhysicsJob ApplyImpulse(FPhysicsBodyId InTarget, const Vector3& InImpulse, const Vector3& InWorldPosition)
 	{
-		Set(EPhysicsJob::SET_VELOCITY);
-	}; 
-
-	void Execute(IPhysicsStateInternal* PhysicsObj)
+		return MakeVector(EPhysicsJob::APPLY_IMPULSE, InTarget, InImpulse, &InWorldPosition);
+	}
+	static FPhysicsJob SetVelocity(FPhysicsBodyId InTarget, const Vector3& InVelocity)
 	{
-		PhysicsObj->P_SetVelocity(Velocity);
+		return MakeVector(EPhysicsJob::SET_VELOCITY, InTarget, InVelocity);
 	}
-};
-
-struct alignas(16) FJobAddVelocity : public FPhysicsJob
-{
-private:
-	Vector3 Velocity;
-
-public:
-	explicit  FJobAddVelocity(Vector3 InVelocity) : Velocity(InVelocity)
+	static FPhysicsJob AddVelocity(FPhysicsBodyId InTarget, const Vector3& InVelocityDelta)
 	{
-		Set(EPhysicsJob::ADD_VELOCITY);
-	};
-
-	void Execute(IPhysicsStateInternal* PhysicsObj)
+		return MakeVector(EPhysicsJob::ADD_VELOCITY, InTarget, InVelocityDelta);
+	}
+	static FPhysicsJob SetAngularVelocity(FPhysicsBodyId InTarget, const Vector3& InAngularVelocity)
 	{
-		PhysicsObj->P_AddVelocity(Velocity);
+		return MakeVector(EPhysicsJob::SET_ANGULARVELOCITY, InTarget, InAngularVelocity);
 	}
-};
-
-struct alignas(16) FJobSetAngularVelocity : public FPhysicsJob
-{
-private:
-	Vector3 AngularVelocity;
-
-public:
-	explicit  FJobSetAngularVelocity(Vector3 InAngularVelocity) : AngularVelocity(InAngularVelocity)
+	static FPhysicsJob AddAngularVelocity(FPhysicsBodyId InTarget, const Vector3& InAngularVelocityDelta)
 	{
-		Set(EPhysicsJob::SET_ANGULARVELOCITY);
-	};
-
-	void Execute(IPhysicsStateInternal* PhysicsObj)
+		return MakeVector(EPhysicsJob::ADD_ANGULARVELOCITY, InTarget, InAngularVelocityDelta);
+	}
+	static FPhysicsJob SetWorldTransform(FPhysicsBodyId InTarget, const FTransform& InWorldTransform)
 	{
-		PhysicsObj->P_SetAngularVelocity(AngularVelocity);
+		FPhysicsJob Job;
+		Job.Type = EPhysicsJob::SET_WORLDTRANSFORM;
+		Job.TargetId = InTarget;
+		Job.Payload.Transform = InWorldTransform;
+		return Job;
 	}
-};
+#pragma endregion
 
-struct alignas(16) FJobAddAngularVelocity : public FPhysicsJob
-{
 private:
-	Vector3 AngularVelocity;
-
-public:
-	explicit  FJobAddAngularVelocity(Vector3 InAngularVelocity) : AngularVelocity(InAngularVelocity)
-	{
-		Set(EPhysicsJob::ADD_ANGULARVELOCITY);
-	};
-
-	void Execute(IPhysicsStateInternal* PhysicsObj)
-	{
-		PhysicsObj->P_AddAngularVelocity(AngularVelocity);
+	static FPhysicsJob MakeVector(EPhysicsJob InType, FPhysicsBodyId InTarget, const Vector3& InValue,
+								  const Vector3* InLocation = nullptr)
+	{
+		FPhysicsJob Job;
+		Job.Type = InType;
+		Job.TargetId = InTarget;
+		Job.Payload.Vector.Value = InValue;
+		if (InLocation)
+		{
+			Job.Payload.Vector.Location = *InLocation;
+			Job.Flags |= JOB_AT_LOCATION;
+		}
+		return Job;
 	}
 };
 
-struct alignas(16) FJobSetWorldTransform : public FPhysicsJob
+static_assert(std::is_trivially_copyable<FPhysicsJob>::value, "FPhysicsJob must be memcpy-able");
+static_assert(std::is_trivially_destructible<FPhysicsJob>::value, "FPhysicsJob must not need destruction");
+static_assert(sizeof(FPhysicsJob) == 64, "FPhysicsJob is expected to fill one cache line");
+
+/// <summary>
+/// 같은 대상에 대한 작업들을 제출 순서대로 합친 결과
+/// 누적형 작업은 합산하고, 설정형 작업은 마지막 값만 남겨 대상당 한 번의 갱신으로 적용
+/// </summary>
+struct alignas(16) FCoalescedPhysicsJob
 {
-private:
-	FTransform WorldTransform;
+	std::bitset<16> JobTypeMask;
+
+	FTransform WorldTransform;			// 마지막 SET_WORLDTRANSFORM
+	Vector3 CenterOfMass;				// 합치는 시점의 질량 중심 - 위치 지정 힘의 토크 계산용
+
+	Vector3 Velocity;					// 마지막 SET_VELOCITY
+	Vector3 VelocityDelta;				// 마지막 설정 이후 ADD_VELOCITY 합
+	Vector3 Impulse;					// 마지막 설정 이후 충격량 합
 
-public:
-	explicit  FJobSetWorldTransform(FTransform InWorldTransform) :  WorldTransform(InWorldTransform)
+	Vector3 AngularVelocity;			// 마지막 SET_ANGULARVELOCITY
+	Vector3 AngularVelocityDelta;		// 마지막 설정 이후 ADD_ANGULARVELOCITY 합
+	Vector3 AngularImpulse;				// 마지막 설정 이후 각충격량 합
+
+	Vector3 Force;
+	Vector3 Torque;
+
+	explicit FCoalescedPhysicsJob(const Vector3& InCenterOfMass) :
+		CenterOfMass(InCenterOfMass),
+		Velocity(Vector3::Zero()), VelocityDelta(Vector3::Zero()), Impulse(Vector3::Zero()),
+		AngularVelocity(Vector3::Zero()), AngularVelocityDelta(Vector3::Zero()), AngularImpulse(Vector3::Zero()),
+		Force(Vector3::Zero()), Torque(Vector3::Zero())
 	{
-		Set(EPhysicsJob::SET_WORLDTRANSFORM);
-	};
+	}
 
-	void Execute(IPhysicsStateInternal* PhysicsObj)
+	inline void Set(EPhysicsJob JobType) { JobTypeMask.set((maksType)JobType); }
+	inline bool Check(EPhysicsJob JobType) const { return JobTypeMask.test((maksType)JobType); }
+
+	// 작업 종류에 따라 분기하여 합침
+	inline void Fold(const FPhysicsJob& InJob)
 	{
-		PhysicsObj->P_SetWorldTransform(WorldTransform);
+		const FPhysicsJob::FVectorPayload& Vector = InJob.Payload.Vector;
+		switch (InJob.Type)
+		{
+			case EPhysicsJob::APPLY_FORCE:
+				Force += Vector.Value;
+				if (InJob.HasFlag(FPhysicsJob::JOB_AT_LOCATION))
+				{
+					Torque += Vector3::Cross(Vector.Location - CenterOfMass, Vector.Value);
+				}
+				break;
+			case EPhysicsJob::APPLY_IMPULSE:
+				Impulse += Vector.Value;
+				if (InJob.HasFlag(FPhysicsJob::JOB_AT_LOCATION))
+				{
+					AngularImpulse += Vector3::Cross(Vector.Location - CenterOfMass, Vector.Value);
+				}
+				break;
+			case EPhysicsJob::SET_VELOCITY:
+				// 이전 증분과 충격량은 덮어씀
+				Velocity = Vector.Value;
+				VelocityDelta = Vector3::Zero();
+				Impulse = Vector3::Zero();
+				break;
+			case EPhysicsJob::ADD_VELOCITY:
+				VelocityDelta += Vector.Value;
+				break;
+			case EPhysicsJob::SET_ANGULARVELOCITY:
+				// 이전 증분과 각충격량은 덮어씀
+				AngularVelocity = Vector.Value;
+				AngularVelocityDelta = Vector3::Zero();
+				AngularImpulse = Vector3::Zero();
+				break;
+			case EPhysicsJob::ADD_ANGULARVELOCITY:
+				AngularVelocityDelta += Vector.Value;
+				break;
+			case EPhysicsJob::SET_WORLDTRANSFORM:
+				// 마지막 값만 유지, 이후 위치 지정 힘은 새 위치 기준
+				WorldTransform = InJob.Payload.Transform;
+				CenterOfMass = WorldTransform.Position;
+				break;
+		}
+		Set(InJob.Type);
 	}
 };
-
@@ -0,0 +1,166 @@
+#include "PhysicsJobBuffer.h"
+#include <algorithm>
+#include <cstring>
+#include <new>
+#include <utility>
+
+namespace
+{
+    inline bool IsJobEarlier(const FPhysicsJob& A, const FPhysicsJob& B)
+    {
+        return A.Sequence < B.Sequence;
+    }
+
+    inline bool IsJobLess(const FPhysicsJob& A, const FPhysicsJob& B)
+    {
+        return A.TargetId != B.TargetId ? A.TargetId < B.TargetId : A.Sequence < B.Sequence;
+    }
+}
+
+FPhysicsJobBuffer::~FPhysicsJobBuffer()
+{
+    FreeRecords(Buffer);
+    FreeRecords(Scratch);
+    Buffer = nullptr;
+    Scratch = nullptr;
+}
+
+void FPhysicsJobBuffer::Reserve(size_t InCapacity)
+{
+    if (InCapacity > Capacity)
+    {
+        Grow(InCapacity);
+    }
+}
+
+void FPhysicsJobBuffer::Append(const FPhysicsJob* InJobs, size_t InCount)
+{
+    if (!InJobs || InCount == 0)
+        return;
+
+    if (Count + InCount > Capacity)
+    {
+        Grow(Count + InCount);
+    }
+    std::memcpy(GetData() + Count, InJobs, InCount * sizeof(FPhysicsJob));
+    Count += InCount;
+}
+
+void FPhysicsJobBuffer::SortBySequence()
+{
+    FPhysicsJob* Jobs = GetData();
+    if (Count < 2 || std::is_sorted(Jobs, Jobs + Count, IsJobEarlier))
+        return;
+
+    std::sort(Jobs, Jobs + Count, IsJobEarlier);
+}
+
+void FPhysicsJobBuffer::SortByTarget()
+{
+    if (Count < 2)
+        return;
+
+    FPhysicsJob* Jobs = GetData();
+
+    // 이미 정렬된 경우(단일 대상, 대상 순 제출 등) 바로 반환
+    FPhysicsBodyId MaxId = Jobs[0].TargetId;
+    bool bSorted = true;
+    for (size_t i = 1; i < Count; ++i)
+    {
+        MaxId = std::max(MaxId, Jobs[i].TargetId);
+        bSorted = bSorted && !IsJobLess(Jobs[i], Jobs[i - 1]);
+    }
+    if (bSorted)
+        return;
+
+    // 대상 범위가 작업 수에 비해 너무 넓으면 계수 배열 비용이 커지므로 비교 정렬
+    if (static_cast<size_t>(MaxId) > Count * 4 + 4096)
+    {
+        std::sort(Jobs, Jobs + Count, IsJobLess);
+        return;
+    }
+
+    // 대상별 시작 위치 계산
+    BucketOffsets.assign(static_cast<size_t>(MaxId) + 1, 0);
+    for (size_t i = 0; i < Count; ++i)
+    {
+        ++BucketOffsets[Jobs[i].TargetId];
+    }
+    uint32_t Offset = 0;
+    for (uint32_t& Bucket : BucketOffsets)
+    {
+        const uint32_t BucketCount = Bucket;
+        Bucket = Offset;
+        Offset += BucketCount;
+    }
+
+    if (ScratchCapacity < Count)
+    {
+        FreeRecords(Scratch);
+        Scratch = nullptr;
+        Scratch = AllocateRecords(Capacity);
+        ScratchCapacity = Capacity;
+    }
+
+    // 안정 분배는 4바이트 인덱스로 하고, 레코드는 순차 기록으로 한 번만 옮김
+    SortedIndices.resize(Count);
+    for (size_t i = 0; i < Count; ++i)
+    {
+        SortedIndices[BucketOffsets[Jobs[i].TargetId]++] = static_cast<uint32_t>(i);
+    }
+    FPhysicsJob* Sorted = reinterpret_cast<FPhysicsJob*>(Scratch);
+    for (size_t i = 0; i < Count; ++i)
+    {
+        Sorted[i] = Jobs[SortedIndices[i]];
+    }
+    std::swap(Buffer, Scratch);
+    std::swap(Capacity, ScratchCapacity);
+
+    // 여러 생산자 버퍼가 이어붙은 경우 대상 안의 제출 순서가 어긋날 수 있으므로 구간별 보정
+    Jobs = GetData();
+    size_t Begin = 0;
+    while (Begin < Count)
+    {
+        size_t End = Begin + 1;
+        bool bRunSorted = true;
+        while (End < Count && Jobs[End].TargetId == Jobs[Begin].TargetId)
+        {
+            bRunSorted = bRunSorted && Jobs[End - 1].Sequence < Jobs[End].Sequence;
+            ++End;
+        }
+        if (!bRunSorted)
+        {
+            std::sort(Jobs + Begin, Jobs + End, IsJobLess);
+        }
+        Begin = End;
+    }
+}
+
+void FPhysicsJobBuffer::Grow(size_t InMinCapacity)
+{
+    const size_t NewCapacity = std::max<size_t>({ InMinCapacity, Capacity * 2, 64 });
+
+    uint8_t* NewBuffer = AllocateRecords(NewCapacity);
+    if (Buffer)
+    {
+        std::memcpy(NewBuffer, Buffer, Count * sizeof(FPhysicsJob));
+        FreeRecords(Buffer);
+    }
+
+    Buffer = NewBuffer;
+    Capacity = NewCapacity;
+}
+
+uint8_t* FPhysicsJobBuffer::AllocateRecords(size_t InCapacity)
+{
+    return static_cast<uint8_t*>(
+        ::operator new(InCapacity * sizeof(FPhysicsJob), std::align_val_t(alignof(FPhysicsJob))));
+}
+
+void FPhysicsJobBuffer::FreeRecords(uint8_t* InBuffer)
+{
+    if (InBuffer)
+    {
+        ::operator delete(InBuffer, std::align_val_t(alignof(FPhysicsJob)));
+    }
+}
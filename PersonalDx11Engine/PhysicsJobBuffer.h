@@ -0,0 +1,73 @@
+#pragma once
+#include "PhysicsJob.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/// <summary>
+/// 물리 작업 명령 버퍼 - FPhysicsJob 레코드를 하나의 평탄한 바이트 버퍼에 연속 기록
+/// 레코드가 POD이므로 기록/확장/정렬 모두 memcpy 수준이며, 소멸자 호출이 필요 없음
+/// </summary>
+class FPhysicsJobBuffer
+{
+public:
+    FPhysicsJobBuffer() = default;
+    ~FPhysicsJobBuffer();
+
+    // 복사 및 이동 방지
+    FPhysicsJobBuffer(const FPhysicsJobBuffer&) = delete;
+    FPhysicsJobBuffer& operator=(const FPhysicsJobBuffer&) = delete;
+    FPhysicsJobBuffer(FPhysicsJobBuffer&&) = delete;
+    FPhysicsJobBuffer& operator=(FPhysicsJobBuffer&&) = delete;
+
+    void Reserve(size_t InCapacity);
+
+    inline void Push(const FPhysicsJob& InJob)
+    {
+        if (Count == Capacity)
+        {
+            Grow(Count + 1);
+        }
+        GetData()[Count++] = InJob;
+    }
+
+    // 연속된 작업 배열 일괄 기록
+    void Append(const FPhysicsJob* InJobs, size_t InCount);
+
+    // 제출 순서로 정렬 - 이미 정렬되어 있으면 확인만 함
+    void SortBySequence();
+
+    // 대상 BodyId 순, 같은 대상 안에서는 제출 순서
+    // 대상 범위가 좁으면 계수 정렬(안정)로 O(N), 넓으면 비교 정렬
+    void SortByTarget();
+
+    // 레코드 파괴가 필요 없으므로 개수만 초기화
+    inline void Clear() { Count = 0; }
+
+    inline FPhysicsJob* GetData() { return reinterpret_cast<FPhysicsJob*>(Buffer); }
+    inline const FPhysicsJob* GetData() const { return reinterpret_cast<const FPhysicsJob*>(Buffer); }
+    inline size_t GetCount() const { return Count; }
+    inline size_t GetCapacity() const { return Capacity; }
+    inline bool IsEmpty() const { return Count == 0; }
+
+    inline const FPhysicsJob* begin() const { return GetData(); }
+    inline const FPhysicsJob* end() const { return GetData() + Count; }
+    inline const FPhysicsJob& operator[](size_t Index) const { return GetData()[Index]; }
+
+private:
+    void Grow(size_t InMinCapacity);
+
+    static uint8_t* AllocateRecords(size_t InCapacity);
+    static void FreeRecords(uint8_t* InBuffer);
+
+private:
+    uint8_t* Buffer = nullptr;
+    size_t Count = 0;       // 기록된 레코드 수
+    size_t Capacity = 0;    // 레코드 단위 용량
+
+    // 계수 정렬용 - 정렬 후 Buffer와 교체
+    uint8_t* Scratch = nullptr;
+    size_t ScratchCapacity = 0;
+    std::vector<uint32_t> BucketOffsets;
+    std::vector<uint32_t> SortedIndices;
+};
@@ -0,0 +1,225 @@
+#include "PhysicsJobQueue.h"
+#include <algorithm>
+#include <new>
+#include <thread>
+
+namespace
+{
+    // 큐 인스턴스/세대 구분용 - 해제 후 같은 주소에 재생성되어도 캐시가 섞이지 않도록 전역으로 증가
+    std::atomic<uint64_t> GQueueGeneration{ 0 };
+}
+
+FPhysicsJobQueue::~FPhysicsJobQueue()
+{
+    Release();
+}
+
+void FPhysicsJobQueue::Initialize(size_t InJobCapacity, const FPhysicsBodyStore* InTargetStore)
+{
+    Release();
+    JobCapacity = std::max<size_t>(InJobCapacity, 1);
+    TargetStore = InTargetStore;
+}
+
+void FPhysicsJobQueue::Release()
+{
+    // 기존 스레드 캐시 무효화
+    Generation.store(GQueueGeneration.fetch_add(1, std::memory_order_relaxed) + 1, std::memory_order_release);
+
+    Drained.Clear();
+    bDraining = false;
+
+    FProducerArena* Arena = ArenaHead.exchange(nullptr, std::memory_order_acq_rel);
+    while (Arena)
+    {
+        FProducerArena* Next = Arena->Next;
+        delete Arena;
+        Arena = Next;
+    }
+}
+
+FPhysicsJobQueue::FProducerArena* FPhysicsJobQueue::GetThreadArena()
+{
+    struct FThreadArenaCache
+    {
+        const FPhysicsJobQueue* Queue = nullptr;
+        uint64_t Generation = 0;
+        FProducerArena* Arena = nullptr;
+    };
+    thread_local FThreadArenaCache Cache;
+
+    const uint64_t CurrentGeneration = Generation.load(std::memory_order_acquire);
+    if (Cache.Queue == this && Cache.Generation == CurrentGeneration && Cache.Arena)
+    {
+        return Cache.Arena;
+    }
+
+    FProducerArena* NewArena = nullptr;
+    try
+    {
+        NewArena = new FProducerArena();
+        NewArena->Buffers[0].Reserve(JobCapacity);
+        NewArena->Buffers[1].Reserve(JobCapacity);
+    }
+    catch (const std::bad_alloc&)
+    {
+        delete NewArena;
+        return nullptr;
+    }
+
+    // 목록 머리에 추가 - 제거는 Release에서만 일어나므로 ABA 없음
+    FProducerArena* Head = ArenaHead.load(std::memory_order_relaxed);
+    do
+    {
+        NewArena->Next = Head;
+    } while (!ArenaHead.compare_exchange_weak(Head, NewArena,
+                                               std::memory_order_release,
+                                               std::memory_order_relaxed));
+
+    Cache.Queue = this;
+    Cache.Generation = CurrentGeneration;
+    Cache.Arena = NewArena;
+    return NewArena;
+}
+
+uint32_t FPhysicsJobQueue::BeginWrite(FProducerArena& Arena)
+{
+    // 기록 표시 후 인덱스를 다시 확인 - 표시와 교체가 엇갈렸으면 새 버퍼로 재시도
+    // 소비자는 교체 후 이전 버퍼를 표시한 기록만 기다리므로 연속 제출에 막히지 않음
+    uint32_t Index = WriteIndex.load(std::memory_order_seq_cst) & 1;
+    while (true)
+    {
+        Arena.ActiveBuffer.store(Index + 1, std::memory_order_seq_cst);
+        const uint32_t Current = WriteIndex.load(std::memory_order_seq_cst) & 1;
+        if (Current == Index)
+            return Index;
+        Index = Current;
+    }
+}
+
+bool FPhysicsJobQueue::Submit(const FPhysicsJob& InJob)
+{
+    return Submit(&InJob, 1);
+}
+
+bool FPhysicsJobQueue::Submit(const FPhysicsJob* InJobs, size_t InCount)
+{
+    if (!InJobs || InCount == 0)
+        return false;
+
+    FProducerArena* Arena = GetThreadArena();
+    if (!Arena)
+        return false;
+
+    const uint32_t Index = BeginWrite(*Arena);
+    FPhysicsJobBuffer& Buffer = Arena->Buffers[Index];
+
+    // 버퍼 용량 고정 - 소비가 늦어져도 메모리가 무한히 늘지 않도록 초과분은 폐기
+    if (Buffer.GetCount() + InCount > JobCapacity)
+    {
+        Arena->ActiveBuffer.store(0, std::memory_order_release);
+        return false;
+    }
+
+    bool bSubmitted = false;
+    try
+    {
+        // 배열 전체에 연속된 제출 순서와 제출 시점 대상 세대 부여
+        const size_t First = Buffer.GetCount();
+        Buffer.Append(InJobs, InCount);
+
+        uint64_t Sequence = NextSequence.fetch_add(InCount, std::memory_order_relaxed);
+        FPhysicsJob* Written = Buffer.GetData() + First;
+        for (size_t i = 0; i < InCount; ++i)
+        {
+            Written[i].Sequence = Sequence++;
+            Written[i].TargetGeneration = TargetStore ? TargetStore->GetGeneration(Written[i].TargetId) : 0;
+        }
+        bSubmitted = true;
+    }
+    catch (const std::bad_alloc&)
+    {
+        // 버퍼 확장 실패 - 작업 폐기
+    }
+
+    // 기록 완료 공개
+    Arena->ActiveBuffer.store(0, std::memory_order_release);
+    return bSubmitted;
+}
+
+const FPhysicsJobBuffer& FPhysicsJobQueue::BeginDrain(bool bSortByTarget)
+{
+    if (bDraining)
+    {
+        EndDrain();
+    }
+    bDraining = true;
+    Drained.Clear();
+
+    // 기록 버퍼 교체 - 이후 제출은 반대편 버퍼로 향함
+    DrainIndex = WriteIndex.fetch_xor(1, std::memory_order_seq_cst) & 1;
+
+    const FPhysicsJobBuffer* Single = nullptr;
+    size_t FilledCount = 0;
+    for (FProducerArena* Arena = ArenaHead.load(std::memory_order_acquire); Arena; Arena = Arena->Next)
+    {
+        // 교체 전에 이전 버퍼를 잡은 기록만 대기 - 한 번의 제출을 기록하는 시간으로 한정됨
+        while (Arena->ActiveBuffer.load(std::memory_order_seq_cst) == DrainIndex + 1)
+        {
+            std::this_thread::yield();
+        }
+
+        if (!Arena->Buffers[DrainIndex].IsEmpty())
+        {
+            Single = &Arena->Buffers[DrainIndex];
+            ++FilledCount;
+        }
+    }
+
+    // 제출 스레드 하나의 버퍼는 이미 제출 순서이므로 그대로 반환
+    if (FilledCount == 1 && !bSortByTarget)
+    {
+        return *Single;
+    }
+
+    for (FProducerArena* Arena = ArenaHead.load(std::memory_order_acquire); Arena; Arena = Arena->Next)
+    {
+        const FPhysicsJobBuffer& Buffer = Arena->Buffers[DrainIndex];
+        Drained.Append(Buffer.GetData(), Buffer.GetCount());
+    }
+
+    if (bSortByTarget)
+    {
+        Drained.SortByTarget();
+    }
+    else
+    {
+        // 여러 제출 스레드의 버퍼를 이어붙였으므로 제출 순서로 정렬
+        Drained.SortBySequence();
+    }
+
+    return Drained;
+}
+
+void FPhysicsJobQueue::EndDrain()
+{
+    if (!bDraining)
+        return;
+
+    Drained.Clear();
+    for (FProducerArena* Arena = ArenaHead.load(std::memory_order_acquire); Arena; Arena = Arena->Next)
+    {
+        Arena->Buffers[DrainIndex].Clear();
+    }
+    bDraining = false;
+}
+
+size_t FPhysicsJobQueue::GetProducerCount() const
+{
+    size_t Count = 0;
+    for (FProducerArena* Arena = ArenaHead.load(std::memory_order_acquire); Arena; Arena = Arena->Next)
+    {
+        ++Count;
+    }
+    return Count;
+}
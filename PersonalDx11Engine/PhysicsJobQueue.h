@@ -0,0 +1,77 @@
+#pragma once
+#include "PhysicsJob.h"
+#include "PhysicsJobBuffer.h"
+#include <atomic>
+#include <cstdint>
+
+/// <summary>
+/// 다중 생산자 / 단일 소비자 물리 작업 큐
+/// 제출 스레드마다 전용 작업 버퍼(이중 버퍼)를 두어 생산자는 잠금 없이 기록하고,
+/// 소비자(물리 스레드)는 기록 버퍼를 교체한 뒤 이전 버퍼들을 제출 순서로 모아 실행함
+/// 제출 시 대상 슬롯 세대를 기록하여 실행 전에 해제/재사용된 슬롯으로 향한 작업을 걸러낼 수 있게 함
+/// </summary>
+class FPhysicsJobQueue
+{
+public:
+    FPhysicsJobQueue() = default;
+    ~FPhysicsJobQueue();
+
+    // 복사 및 이동 방지
+    FPhysicsJobQueue(const FPhysicsJobQueue&) = delete;
+    FPhysicsJobQueue& operator=(const FPhysicsJobQueue&) = delete;
+    FPhysicsJobQueue(FPhysicsJobQueue&&) = delete;
+    FPhysicsJobQueue& operator=(FPhysicsJobQueue&&) = delete;
+
+    // 제출 스레드별 버퍼 용량 (버퍼 하나 기준, 작업 수) - Tick 사이에 이보다 많이 제출하면 폐기
+    // InTargetStore가 있으면 제출 시 대상 슬롯 세대 기록 - 다른 스레드의 제출은 강체 할당/해제와 겹치지 않아야 함
+    void Initialize(size_t InJobCapacity, const FPhysicsBodyStore* InTargetStore = nullptr);
+    // 모든 버퍼 해제 - 제출 중인 생산자가 없을 때만 호출
+    void Release();
+
+    // 생산자 - 어느 스레드에서나 호출 가능, 버퍼가 가득 차면 false
+    bool Submit(const FPhysicsJob& InJob);
+    // 생산자 - 연속된 작업 배열을 한 번에 제출, 배열 안의 순서 유지
+    bool Submit(const FPhysicsJob* InJobs, size_t InCount);
+
+    // 소비자 전용 - 기록 버퍼를 교체하고 교체 이전 제출분을 제출 순서로 반환
+    // 제출 스레드가 하나면 그 버퍼를 복사 없이 그대로 반환
+    // bSortByTarget이면 모아서 (대상, 제출 순서)로 정렬하여 반환
+    const FPhysicsJobBuffer& BeginDrain(bool bSortByTarget = false);
+    // 소비자 전용 - 반환했던 버퍼들을 재사용 가능 상태로 되돌림
+    void EndDrain();
+
+    size_t GetProducerCount() const;
+    size_t GetJobCapacity() const { return JobCapacity; }
+
+private:
+    // 제출 스레드 전용 버퍼 - Buffers[i]는 i가 기록 버퍼인 동안 소유 스레드만 접근
+    struct FProducerArena
+    {
+        FPhysicsJobBuffer Buffers[2];
+
+        // 기록 중인 버퍼 인덱스 + 1, 0이면 기록 중 아님
+        std::atomic<uint32_t> ActiveBuffer{ 0 };
+        FProducerArena* Next = nullptr;
+    };
+
+    // 호출 스레드의 버퍼 - 최초 제출 시 생성하여 목록에 등록
+    FProducerArena* GetThreadArena();
+
+    // 기록 버퍼를 선택하고 소비자에게 알림 - 교체와 겹치면 새 버퍼로 다시 선택
+    uint32_t BeginWrite(FProducerArena& Arena);
+
+private:
+    // 등록된 버퍼 목록 - 추가만 하는 잠금 없는 스택
+    std::atomic<FProducerArena*> ArenaHead{ nullptr };
+    std::atomic<uint32_t> WriteIndex{ 0 };
+    std::atomic<uint64_t> NextSequence{ 0 };
+    // 스레드별 버퍼 캐시 무효화용 - Release마다 갱신
+    std::atomic<uint64_t> Generation{ 0 };
+    size_t JobCapacity = 1024;
+    const FPhysicsBodyStore* TargetStore = nullptr;
+
+    // 소비자 전용 상태
+    FPhysicsJobBuffer Drained;
+    uint32_t DrainIndex = 0;
+    bool bDraining = false;
+};
@@ -1,8 +1,13 @@
 #pragma once
+#include "PhysicsBodyStore.h"
+
 ///물리시스템 관리 객체
 class IPhysicsObejct
 {
 public:
+    //물리 상태 저장소 슬롯
+    virtual FPhysicsBodyId GetPhysicsBodyId() const = 0;
+
     virtual void TickPhysics(const float DeltaTime) = 0;
 
     virtual void RegisterPhysicsSystem() = 0;
@@ -0,0 +1,168 @@
+#include "PhysicsObjectRegistry.h"
+#include "PhysicsObjectInterface.h"
+#include <algorithm>
+
+void FPhysicsObjectRegistry::Reserve(size_t InCapacity)
+{
+    Slots.reserve(InCapacity);
+    FreeSlots.reserve(InCapacity);
+    Objects.reserve(InCapacity);
+    DenseSlots.reserve(InCapacity);
+}
+
+void FPhysicsObjectRegistry::Clear()
+{
+    // 세대는 유지 - 기존 핸들이 새 등록과 섞이지 않도록
+    FreeSlots.clear();
+    for (uint32_t i = 0; i < Slots.size(); ++i)
+    {
+        if (Slots[i].DenseIndex != INVALID_DENSE)
+        {
+            ++Slots[i].Generation;
+            Slots[i].DenseIndex = INVALID_DENSE;
+        }
+        FreeSlots.push_back(i);
+    }
+    Objects.clear();
+    DenseSlots.clear();
+    PendingRemovals = 0;
+    bLocked = false;
+}
+
+FPhysicsObjectHandle FPhysicsObjectRegistry::Register(IPhysicsObejct* InObject)
+{
+    FPhysicsObjectHandle Handle;
+    if (!InObject)
+        return Handle;
+
+    uint32_t SlotIndex;
+    if (!FreeSlots.empty())
+    {
+        SlotIndex = FreeSlots.back();
+        FreeSlots.pop_back();
+    }
+    else
+    {
+        SlotIndex = static_cast<uint32_t>(Slots.size());
+        Slots.emplace_back();
+    }
+
+    FSlot& Slot = Slots[SlotIndex];
+    Slot.DenseIndex = static_cast<uint32_t>(Objects.size());
+    Objects.push_back(InObject);
+    DenseSlots.push_back(SlotIndex);
+
+    Handle.Index = SlotIndex;
+    Handle.Generation = Slot.Generation;
+    return Handle;
+}
+
+void FPhysicsObjectRegistry::Unregister(const FPhysicsObjectHandle& InHandle)
+{
+    if (!IsValid(InHandle))
+        return;
+
+    FSlot& Slot = Slots[InHandle.Index];
+    const uint32_t DenseIndex = Slot.DenseIndex;
+
+    // 슬롯은 바로 반환 - 세대가 바뀌므로 이전 핸들로는 접근 불가
+    ++Slot.Generation;
+    Slot.DenseIndex = INVALID_DENSE;
+    FreeSlots.push_back(InHandle.Index);
+
+    if (bLocked)
+    {
+        // 순회 중인 배열은 건드리지 않고 표시만
+        Objects[DenseIndex] = nullptr;
+        DenseSlots[DenseIndex] = FPhysicsObjectHandle::INVALID_INDEX;
+        ++PendingRemovals;
+        return;
+    }
+
+    RemoveDense(DenseIndex);
+}
+
+bool FPhysicsObjectRegistry::IsValid(const FPhysicsObjectHandle& InHandle) const
+{
+    return InHandle.Index < Slots.size() &&
+        Slots[InHandle.Index].Generation == InHandle.Generation &&
+        Slots[InHandle.Index].DenseIndex != INVALID_DENSE;
+}
+
+IPhysicsObejct* FPhysicsObjectRegistry::Get(const FPhysicsObjectHandle& InHandle) const
+{
+    return IsValid(InHandle) ? Objects[Slots[InHandle.Index].DenseIndex] : nullptr;
+}
+
+void FPhysicsObjectRegistry::Unlock()
+{
+    bLocked = false;
+    if (PendingRemovals == 0)
+        return;
+
+    // 순서를 유지하며 표시된 항목 제거 - 정렬 상태가 유지되어 다음 정렬 비용이 작음
+    size_t Write = 0;
+    for (size_t Read = 0; Read < Objects.size(); ++Read)
+    {
+        if (!Objects[Read])
+            continue;
+
+        Objects[Write] = Objects[Read];
+        DenseSlots[Write] = DenseSlots[Read];
+        Slots[DenseSlots[Write]].DenseIndex = static_cast<uint32_t>(Write);
+        ++Write;
+    }
+    Objects.resize(Write);
+    DenseSlots.resize(Write);
+    PendingRemovals = 0;
+}
+
+void FPhysicsObjectRegistry::SortByBodyId()
+{
+    if (bLocked || Objects.size() < 2)
+        return;
+
+    // 대부분 이미 정렬되어 있음 - 등록 순서가 저장소 할당 순서와 거의 같음
+    bool bSorted = true;
+    for (size_t i = 1; i < Objects.size() && bSorted; ++i)
+    {
+        bSorted = Objects[i - 1]->GetPhysicsBodyId() <= Objects[i]->GetPhysicsBodyId();
+    }
+    if (bSorted)
+        return;
+
+    // (BodyId, 밀집 위치) 키 정렬 후 한 번에 재배치
+    const size_t Count = Objects.size();
+    SortKeys.resize(Count);
+    for (size_t i = 0; i < Count; ++i)
+    {
+        SortKeys[i] = (static_cast<uint64_t>(Objects[i]->GetPhysicsBodyId()) << 32) | static_cast<uint64_t>(i);
+    }
+    std::sort(SortKeys.begin(), SortKeys.end());
+
+    SortedObjects.resize(Count);
+    SortedSlots.resize(Count);
+    for (size_t i = 0; i < Count; ++i)
+    {
+        const size_t From = static_cast<size_t>(SortKeys[i] & 0xFFFFFFFFull);
+        SortedObjects[i] = Objects[From];
+        SortedSlots[i] = DenseSlots[From];
+        Slots[SortedSlots[i]].DenseIndex = static_cast<uint32_t>(i);
+    }
+    Objects.swap(SortedObjects);
+    DenseSlots.swap(SortedSlots);
+}
+
+void FPhysicsObjectRegistry::RemoveDense(uint32_t InDenseIndex)
+{
+    // 마지막 항목을 빈 자리로 이동
+    const uint32_t Last = static_cast<uint32_t>(Objects.size() - 1);
+    if (InDenseIndex != Last)
+    {
+        Objects[InDenseIndex] = Objects[Last];
+        DenseSlots[InDenseIndex] = DenseSlots[Last];
+        Slots[DenseSlots[InDenseIndex]].DenseIndex = InDenseIndex;
+    }
+    Objects.pop_back();
+    DenseSlots.pop_back();
+}
@@ -0,0 +1,81 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class IPhysicsObejct;
+
+// 등록 핸들 - 슬롯 번호 + 세대, 슬롯이 재사용되면 이전 핸들은 무효
+struct FPhysicsObjectHandle
+{
+    static constexpr uint32_t INVALID_INDEX = static_cast<uint32_t>(-1);
+
+    uint32_t Index = INVALID_INDEX;
+    uint32_t Generation = 0;
+
+    bool IsSet() const { return Index != INVALID_INDEX; }
+    bool operator==(const FPhysicsObjectHandle& Other) const { return Index == Other.Index && Generation == Other.Generation; }
+    bool operator!=(const FPhysicsObjectHandle& Other) const { return !(*this == Other); }
+};
+
+/// <summary>
+/// 물리 객체 등록부 (slot map)
+/// 등록/해제는 O(1)이며, 등록된 객체는 원시 포인터 밀집 배열로 순회함
+/// 객체는 소멸 전에 반드시 스스로 해제해야 함 - 등록부는 수명을 소유하거나 감시하지 않음
+/// 잠금(시뮬레이션) 중 해제된 객체는 밀집 배열에서 nullptr로 표시만 하고 잠금 해제 시 정리
+/// </summary>
+class FPhysicsObjectRegistry
+{
+public:
+    void Reserve(size_t InCapacity);
+    void Clear();
+
+    FPhysicsObjectHandle Register(IPhysicsObejct* InObject);
+    void Unregister(const FPhysicsObjectHandle& InHandle);
+
+    bool IsValid(const FPhysicsObjectHandle& InHandle) const;
+    IPhysicsObejct* Get(const FPhysicsObjectHandle& InHandle) const;
+
+    // 시뮬레이션 동안 밀집 배열 순서/크기 고정 - 해제는 nullptr 표시로 대체, 등록은 뒤에 추가
+    void Lock() { bLocked = true; }
+    // 잠금 중 해제된 항목 정리
+    void Unlock();
+    bool IsLocked() const { return bLocked; }
+
+    // 밀집 배열을 저장소 순서(BodyId)로 정렬 - 잠금 중에는 호출 불가
+    void SortByBodyId();
+
+    // 밀집 배열 - 잠금 중에는 nullptr 항목이 있을 수 있음
+    // InDenseIndex < GetDenseCount() - 잠금 중 등록으로 배열이 재할당될 수 있으므로 포인터 대신 위치로 접근
+    IPhysicsObejct* GetObjectAt(size_t InDenseIndex) const { return Objects[InDenseIndex]; }
+    size_t GetDenseCount() const { return Objects.size(); }
+    // 실제 등록된 객체 수
+    size_t GetCount() const { return Objects.size() - PendingRemovals; }
+
+private:
+    void RemoveDense(uint32_t InDenseIndex);
+
+private:
+    static constexpr uint32_t INVALID_DENSE = static_cast<uint32_t>(-1);
+
+    struct FSlot
+    {
+        uint32_t Generation = 0;
+        uint32_t DenseIndex = INVALID_DENSE;    // 해제된 슬롯이면 INVALID_DENSE
+    };
+
+    std::vector<FSlot> Slots;
+    std::vector<uint32_t> FreeSlots;
+
+    // 밀집 배열 - 같은 위치끼리 대응
+    std::vector<IPhysicsObejct*> Objects;
+    std::vector<uint32_t> DenseSlots;
+
+    // 정렬용 임시 버퍼
+    std::vector<uint64_t> SortKeys;
+    std::vector<IPhysicsObejct*> SortedObjects;
+    std::vector<uint32_t> SortedSlots;
+
+    size_t PendingRemovals = 0;
+    bool bLocked = false;
+};
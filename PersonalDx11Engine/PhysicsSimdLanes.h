@@ -0,0 +1,418 @@
+#pragma once
+#include "Math.h"
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <emmintrin.h>
+#include <immintrin.h>
+
+static_assert(sizeof(Vector3) == sizeof(float) * 3, "Vector3 must be tightly packed for lane loads");
+static_assert(sizeof(Quaternion) == sizeof(float) * 4, "Quaternion must be tightly packed for lane loads");
+
+/// <summary>
+/// 물리 일괄 처리용 SIMD 레인 타입과 레인 벡터 연산
+/// 같은 템플릿 코드를 스칼라(폭 1) / SSE(폭 4) / AVX2(폭 8) 레인으로 인스턴스화함
+/// AVX2 레인은 포함 전에 PHYSICS_SIMD_AVX2_UNIT을 정의한 *Avx2.cpp 번역 단위에서만 보임
+/// 그 번역 단위만 AVX2 명령 생성을 허용해 빌드하고, 호출 여부는 실행 시 CPU 지원 여부로 분기함
+/// </summary>
+// AVX2 번역 단위의 인라인 함수 사본이 다른 번역 단위의 사본과 섞이지 않도록 이름공간을 나눔
+#ifdef PHYSICS_SIMD_AVX2_UNIT
+#define PHYSICS_SIMD_TARGET Avx2
+#else
+#define PHYSICS_SIMD_TARGET Base
+#endif
+
+namespace PhysicsSimd
+{
+inline namespace PHYSICS_SIMD_TARGET
+{
+#pragma region Lane Types
+    //////////////////////////////////////////////////////////////////////////
+    // 스칼라 레인 (폭 1) - SIMD 미지원 및 나머지 처리용
+    struct FMask1 { bool V; };
+    inline FMask1 operator&(FMask1 A, FMask1 B) { return { A.V && B.V }; }
+    inline FMask1 operator|(FMask1 A, FMask1 B) { return { A.V || B.V }; }
+    inline FMask1 operator!(FMask1 A) { return { !A.V }; }
+    inline bool Any(FMask1 M) { return M.V; }
+
+    struct FFloat1
+    {
+        using FMask = FMask1;
+        static constexpr size_t Width = 1;
+
+        float V;
+
+        static FFloat1 Splat(float In) { return { In }; }
+        static FFloat1 Load(const float* P) { return { *P }; }
+        static void Store(float* P, FFloat1 In) { *P = In.V; }
+
+        static void LoadVec3(const float* P, FFloat1& X, FFloat1& Y, FFloat1& Z)
+        {
+            X.V = P[0]; Y.V = P[1]; Z.V = P[2];
+        }
+        static void StoreVec3(float* P, FFloat1 X, FFloat1 Y, FFloat1 Z)
+        {
+            P[0] = X.V; P[1] = Y.V; P[2] = Z.V;
+        }
+        static void LoadQuat(const float* P, FFloat1& X, FFloat1& Y, FFloat1& Z, FFloat1& W)
+        {
+            X.V = P[0]; Y.V = P[1]; Z.V = P[2]; W.V = P[3];
+        }
+        static void StoreQuat(float* P, FFloat1 X, FFloat1 Y, FFloat1 Z, FFloat1 W)
+        {
+            P[0] = X.V; P[1] = Y.V; P[2] = Z.V; P[3] = W.V;
+        }
+        static FMask1 LoadFlagMask(const uint8_t* P, uint8_t Mask, uint8_t Value)
+        {
+            return { (*P & Mask) == Value };
+        }
+    };
+    inline FFloat1 operator+(FFloat1 A, FFloat1 B) { return { A.V + B.V }; }
+    inline FFloat1 operator-(FFloat1 A, FFloat1 B) { return { A.V - B.V }; }
+    inline FFloat1 operator*(FFloat1 A, FFloat1 B) { return { A.V * B.V }; }
+    inline FFloat1 operator/(FFloat1 A, FFloat1 B) { return { A.V / B.V }; }
+    inline FFloat1 operator-(FFloat1 A) { return { -A.V }; }
+    inline FMask1 operator<(FFloat1 A, FFloat1 B) { return { A.V < B.V }; }
+    inline FMask1 operator<=(FFloat1 A, FFloat1 B) { return { A.V <= B.V }; }
+    inline FMask1 operator>(FFloat1 A, FFloat1 B) { return { A.V > B.V }; }
+    inline FMask1 operator>=(FFloat1 A, FFloat1 B) { return { A.V >= B.V }; }
+    inline FFloat1 Select(FMask1 M, FFloat1 A, FFloat1 B) { return M.V ? A : B; }
+    inline FFloat1 Sqrt(FFloat1 A) { return { std::sqrt(A.V) }; }
+    inline FFloat1 Abs(FFloat1 A) { return { std::abs(A.V) }; }
+    inline FFloat1 Min(FFloat1 A, FFloat1 B) { return { A.V < B.V ? A.V : B.V }; }
+    inline FFloat1 Max(FFloat1 A, FFloat1 B) { return { A.V > B.V ? A.V : B.V }; }
+    inline FFloat1 Round(FFloat1 A) { return { std::nearbyint(A.V) }; }
+
+    //////////////////////////////////////////////////////////////////////////
+    // SSE 레인 (폭 4)
+    struct FMask4 { __m128 V; };
+    inline FMask4 operator&(FMask4 A, FMask4 B) { return { _mm_and_ps(A.V, B.V) }; }
+    inline FMask4 operator|(FMask4 A, FMask4 B) { return { _mm_or_ps(A.V, B.V) }; }
+    inline FMask4 operator!(FMask4 A) { return { _mm_xor_ps(A.V, _mm_castsi128_ps(_mm_set1_epi32(-1))) }; }
+    inline bool Any(FMask4 M) { return _mm_movemask_ps(M.V) != 0; }
+
+    // 연속된 Vector3 4개 (x0 y0 z0 x1 | y1 z1 x2 y2 | z2 x3 y3 z3) <-> X,Y,Z 레지스터 전치
+    inline void TransposeLoadVec3x4(const float* P, __m128& X, __m128& Y, __m128& Z)
+    {
+        const __m128 A = _mm_loadu_ps(P);
+        const __m128 B = _mm_loadu_ps(P + 4);
+        const __m128 C = _mm_loadu_ps(P + 8);
+
+        const __m128 XT = _mm_shuffle_ps(B, C, _MM_SHUFFLE(2, 1, 1, 2));          // x2 .. x3 ..
+        X = _mm_shuffle_ps(A, XT, _MM_SHUFFLE(2, 0, 3, 0));                      // x0 x1 x2 x3
+        const __m128 YA = _mm_shuffle_ps(A, B, _MM_SHUFFLE(0, 0, 1, 1));          // y0 y0 y1 y1
+        const __m128 YB = _mm_shuffle_ps(B, C, _MM_SHUFFLE(2, 2, 3, 3));          // y2 y2 y3 y3
+        Y = _mm_shuffle_ps(YA, YB, _MM_SHUFFLE(2, 0, 2, 0));
+        const __m128 ZA = _mm_shuffle_ps(A, B, _MM_SHUFFLE(1, 1, 2, 2));          // z0 z0 z1 z1
+        const __m128 ZB = _mm_shuffle_ps(C, C, _MM_SHUFFLE(3, 3, 0, 0));          // z2 z2 z3 z3
+        Z = _mm_shuffle_ps(ZA, ZB, _MM_SHUFFLE(2, 0, 2, 0));
+    }
+
+    inline void TransposeStoreVec3x4(float* P, __m128 X, __m128 Y, __m128 Z)
+    {
+        const __m128 A = _mm_shuffle_ps(_mm_shuffle_ps(X, Y, _MM_SHUFFLE(0, 0, 0, 0)),
+                                        _mm_shuffle_ps(Z, X, _MM_SHUFFLE(1, 1, 0, 0)),
+                                        _MM_SHUFFLE(2, 0, 2, 0));                // x0 y0 z0 x1
+        const __m128 B = _mm_shuffle_ps(_mm_shuffle_ps(Y, Z, _MM_SHUFFLE(1, 1, 1, 1)),
+                                        _mm_shuffle_ps(X, Y, _MM_SHUFFLE(2, 2, 2, 2)),
+                                        _MM_SHUFFLE(2, 0, 2, 0));                // y1 z1 x2 y2
+        const __m128 C = _mm_shuffle_ps(_mm_shuffle_ps(Z, X, _MM_SHUFFLE(3, 3, 2, 2)),
+                                        _mm_shuffle_ps(Y, Z, _MM_SHUFFLE(3, 3, 3, 3)),
+                                        _MM_SHUFFLE(2, 0, 2, 0));                // z2 x3 y3 z3
+        _mm_storeu_ps(P, A);
+        _mm_storeu_ps(P + 4, B);
+        _mm_storeu_ps(P + 8, C);
+    }
+
+    inline void TransposeLoadQuatx4(const float* P, __m128& X, __m128& Y, __m128& Z, __m128& W)
+    {
+        X = _mm_loadu_ps(P);
+        Y = _mm_loadu_ps(P + 4);
+        Z = _mm_loadu_ps(P + 8);
+        W = _mm_loadu_ps(P + 12);
+        _MM_TRANSPOSE4_PS(X, Y, Z, W);
+    }
+
+    inline void TransposeStoreQuatx4(float* P, __m128 X, __m128 Y, __m128 Z, __m128 W)
+    {
+        _MM_TRANSPOSE4_PS(X, Y, Z, W);
+        _mm_storeu_ps(P, X);
+        _mm_storeu_ps(P + 4, Y);
+        _mm_storeu_ps(P + 8, Z);
+        _mm_storeu_ps(P + 12, W);
+    }
+
+    struct FFloat4
+    {
+        using FMask = FMask4;
+        static constexpr size_t Width = 4;
+
+        __m128 V;
+
+        static FFloat4 Splat(float In) { return { _mm_set1_ps(In) }; }
+        static FFloat4 Load(const float* P) { return { _mm_loadu_ps(P) }; }
+        static void Store(float* P, FFloat4 In) { _mm_storeu_ps(P, In.V); }
+
+        static void LoadVec3(const float* P, FFloat4& X, FFloat4& Y, FFloat4& Z)
+        {
+            TransposeLoadVec3x4(P, X.V, Y.V, Z.V);
+        }
+        static void StoreVec3(float* P, FFloat4 X, FFloat4 Y, FFloat4 Z)
+        {
+            TransposeStoreVec3x4(P, X.V, Y.V, Z.V);
+        }
+        static void LoadQuat(const float* P, FFloat4& X, FFloat4& Y, FFloat4& Z, FFloat4& W)
+        {
+            TransposeLoadQuatx4(P, X.V, Y.V, Z.V, W.V);
+        }
+        static void StoreQuat(float* P, FFloat4 X, FFloat4 Y, FFloat4 Z, FFloat4 W)
+        {
+            TransposeStoreQuatx4(P, X.V, Y.V, Z.V, W.V);
+        }
+        static FMask4 LoadFlagMask(const uint8_t* P, uint8_t Mask, uint8_t Value)
+        {
+            int32_t Packed;
+            std::memcpy(&Packed, P, sizeof(Packed));
+            const __m128i Zero = _mm_setzero_si128();
+            __m128i Lanes = _mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128(Packed), Zero), Zero);
+            Lanes = _mm_and_si128(Lanes, _mm_set1_epi32(Mask));
+            return { _mm_castsi128_ps(_mm_cmpeq_epi32(Lanes, _mm_set1_epi32(Value))) };
+        }
+    };
+    inline FFloat4 operator+(FFloat4 A, FFloat4 B) { return { _mm_add_ps(A.V, B.V) }; }
+    inline FFloat4 operator-(FFloat4 A, FFloat4 B) { return { _mm_sub_ps(A.V, B.V) }; }
+    inline FFloat4 operator*(FFloat4 A, FFloat4 B) { return { _mm_mul_ps(A.V, B.V) }; }
+    inline FFloat4 operator/(FFloat4 A, FFloat4 B) { return { _mm_div_ps(A.V, B.V) }; }
+    inline FFloat4 operator-(FFloat4 A) { return { _mm_xor_ps(A.V, _mm_set1_ps(-0.0f)) }; }
+    inline FMask4 operator<(FFloat4 A, FFloat4 B) { return { _mm_cmplt_ps(A.V, B.V) }; }
+    inline FMask4 operator<=(FFloat4 A, FFloat4 B) { return { _mm_cmple_ps(A.V, B.V) }; }
+    inline FMask4 operator>(FFloat4 A, FFloat4 B) { return { _mm_cmpgt_ps(A.V, B.V) }; }
+    inline FMask4 operator>=(FFloat4 A, FFloat4 B) { return { _mm_cmpge_ps(A.V, B.V) }; }
+    inline FFloat4 Select(FMask4 M, FFloat4 A, FFloat4 B)
+    {
+        return { _mm_or_ps(_mm_and_ps(M.V, A.V), _mm_andnot_ps(M.V, B.V)) };
+    }
+    inline FFloat4 Sqrt(FFloat4 A) { return { _mm_sqrt_ps(A.V) }; }
+    inline FFloat4 Abs(FFloat4 A) { return { _mm_andnot_ps(_mm_set1_ps(-0.0f), A.V) }; }
+    inline FFloat4 Min(FFloat4 A, FFloat4 B) { return { _mm_min_ps(A.V, B.V) }; }
+    inline FFloat4 Max(FFloat4 A, FFloat4 B) { return { _mm_max_ps(A.V, B.V) }; }
+    // 기본 반올림 모드(최근접 짝수) - 정수 범위를 넘는 값은 고려하지 않음
+    inline FFloat4 Round(FFloat4 A) { return { _mm_cvtepi32_ps(_mm_cvtps_epi32(A.V)) }; }
+
+#ifdef PHYSICS_SIMD_AVX2_UNIT
+    //////////////////////////////////////////////////////////////////////////
+    // AVX2 레인 (폭 8)
+    struct FMask8 { __m256 V; };
+    inline FMask8 operator&(FMask8 A, FMask8 B) { return { _mm256_and_ps(A.V, B.V) }; }
+    inline FMask8 operator|(FMask8 A, FMask8 B) { return { _mm256_or_ps(A.V, B.V) }; }
+    inline FMask8 operator!(FMask8 A)
+    {
+        return { _mm256_xor_ps(A.V, _mm256_castsi256_ps(_mm256_set1_epi32(-1))) };
+    }
+    inline bool Any(FMask8 M) { return _mm256_movemask_ps(M.V) != 0; }
+
+    inline __m256 Combine(__m128 Low, __m128 High)
+    {
+        return _mm256_insertf128_ps(_mm256_castps128_ps256(Low), High, 1);
+    }
+
+    struct FFloat8
+    {
+        using FMask = FMask8;
+        static constexpr size_t Width = 8;
+
+        __m256 V;
+
+        static FFloat8 Splat(float In) { return { _mm256_set1_ps(In) }; }
+        static FFloat8 Load(const float* P) { return { _mm256_loadu_ps(P) }; }
+        static void Store(float* P, FFloat8 In) { _mm256_storeu_ps(P, In.V); }
+
+        // 4개씩 두 번 전치하여 상/하위 128비트에 배치
+        static void LoadVec3(const float* P, FFloat8& X, FFloat8& Y, FFloat8& Z)
+        {
+            __m128 X0, Y0, Z0, X1, Y1, Z1;
+            TransposeLoadVec3x4(P, X0, Y0, Z0);
+            TransposeLoadVec3x4(P + 12, X1, Y1, Z1);
+            X.V = Combine(X0, X1);
+            Y.V = Combine(Y0, Y1);
+            Z.V = Combine(Z0, Z1);
+        }
+        static void StoreVec3(float* P, FFloat8 X, FFloat8 Y, FFloat8 Z)
+        {
+            TransposeStoreVec3x4(P, _mm256_castps256_ps128(X.V), _mm256_castps256_ps128(Y.V),
+                                 _mm256_castps256_ps128(Z.V));
+            TransposeStoreVec3x4(P + 12, _mm256_extractf128_ps(X.V, 1), _mm256_extractf128_ps(Y.V, 1),
+                                 _mm256_extractf128_ps(Z.V, 1));
+        }
+        static void LoadQuat(const float* P, FFloat8& X, FFloat8& Y, FFloat8& Z, FFloat8& W)
+        {
+            __m128 X0, Y0, Z0, W0, X1, Y1, Z1, W1;
+            TransposeLoadQuatx4(P, X0, Y0, Z0, W0);
+            TransposeLoadQuatx4(P + 16, X1, Y1, Z1, W1);
+            X.V = Combine(X0, X1);
+            Y.V = Combine(Y0, Y1);
+            Z.V = Combine(Z0, Z1);
+            W.V = Combine(W0, W1);
+        }
+        static void StoreQuat(float* P, FFloat8 X, FFloat8 Y, FFloat8 Z, FFloat8 W)
+        {
+            TransposeStoreQuatx4(P, _mm256_castps256_ps128(X.V), _mm256_castps256_ps128(Y.V),
+                                 _mm256_castps256_ps128(Z.V), _mm256_castps256_ps128(W.V));
+            TransposeStoreQuatx4(P + 16, _mm256_extractf128_ps(X.V, 1), _mm256_extractf128_ps(Y.V, 1),
+                                 _mm256_extractf128_ps(Z.V, 1), _mm256_extractf128_ps(W.V, 1));
+        }
+        static FMask8 LoadFlagMask(const uint8_t* P, uint8_t Mask, uint8_t Value)
+        {
+            __m256i Lanes = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(P)));
+            Lanes = _mm256_and_si256(Lanes, _mm256_set1_epi32(Mask));
+            return { _mm256_castsi256_ps(_mm256_cmpeq_epi32(Lanes, _mm256_set1_epi32(Value))) };
+        }
+    };
+    inline FFloat8 operator+(FFloat8 A, FFloat8 B) { return { _mm256_add_ps(A.V, B.V) }; }
+    inline FFloat8 operator-(FFloat8 A, FFloat8 B) { return { _mm256_sub_ps(A.V, B.V) }; }
+    inline FFloat8 operator*(FFloat8 A, FFloat8 B) { return { _mm256_mul_ps(A.V, B.V) }; }
+    inline FFloat8 operator/(FFloat8 A, FFloat8 B) { return { _mm256_div_ps(A.V, B.V) }; }
+    inline FFloat8 operator-(FFloat8 A) { return { _mm256_xor_ps(A.V, _mm256_set1_ps(-0.0f)) }; }
+    inline FMask8 operator<(FFloat8 A, FFloat8 B) { return { _mm256_cmp_ps(A.V, B.V, _CMP_LT_OQ) }; }
+    inline FMask8 operator<=(FFloat8 A, FFloat8 B) { return { _mm256_cmp_ps(A.V, B.V, _CMP_LE_OQ) }; }
+    inline FMask8 operator>(FFloat8 A, FFloat8 B) { return { _mm256_cmp_ps(A.V, B.V, _CMP_GT_OQ) }; }
+    inline FMask8 operator>=(FFloat8 A, FFloat8 B) { return { _mm256_cmp_ps(A.V, B.V, _CMP_GE_OQ) }; }
+    inline FFloat8 Select(FMask8 M, FFloat8 A, FFloat8 B) { return { _mm256_blendv_ps(B.V, A.V, M.V) }; }
+    inline FFloat8 Sqrt(FFloat8 A) { return { _mm256_sqrt_ps(A.V) }; }
+    inline FFloat8 Abs(FFloat8 A) { return { _mm256_andnot_ps(_mm256_set1_ps(-0.0f), A.V) }; }
+    inline FFloat8 Min(FFloat8 A, FFloat8 B) { return { _mm256_min_ps(A.V, B.V) }; }
+    inline FFloat8 Max(FFloat8 A, FFloat8 B) { return { _mm256_max_ps(A.V, B.V) }; }
+    inline FFloat8 Round(FFloat8 A)
+    {
+        return { _mm256_round_ps(A.V, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC) };
+    }
+#endif
+#pragma endregion
+
+#pragma region Lane Vector Math
+    template<typename F>
+    struct TVec3
+    {
+        F X, Y, Z;
+    };
+
+    template<typename F>
+    struct TQuat
+    {
+        F X, Y, Z, W;
+    };
+
+    template<typename F>
+    inline TVec3<F> operator+(const TVec3<F>& A, const TVec3<F>& B) { return { A.X + B.X, A.Y + B.Y, A.Z + B.Z }; }
+    template<typename F>
+    inline TVec3<F> operator-(const TVec3<F>& A, const TVec3<F>& B) { return { A.X - B.X, A.Y - B.Y, A.Z - B.Z }; }
+    template<typename F>
+    inline TVec3<F> operator*(const TVec3<F>& A, F S) { return { A.X * S, A.Y * S, A.Z * S }; }
+
+    template<typename F>
+    inline TVec3<F> Zero3() { const F Zero = F::Splat(0.0f); return { Zero, Zero, Zero }; }
+    template<typename F>
+    inline TVec3<F> Mul(const TVec3<F>& A, const TVec3<F>& B) { return { A.X * B.X, A.Y * B.Y, A.Z * B.Z }; }
+    template<typename F>
+    inline F Dot(const TVec3<F>& A, const TVec3<F>& B) { return A.X * B.X + A.Y * B.Y + A.Z * B.Z; }
+    template<typename F>
+    inline F LengthSq(const TVec3<F>& A) { return Dot(A, A); }
+    template<typename F>
+    inline TVec3<F> Cross(const TVec3<F>& A, const TVec3<F>& B)
+    {
+        return { A.Y * B.Z - A.Z * B.Y, A.Z * B.X - A.X * B.Z, A.X * B.Y - A.Y * B.X };
+    }
+    template<typename F, typename M>
+    inline TVec3<F> Select(M Mask, const TVec3<F>& A, const TVec3<F>& B)
+    {
+        return { Select(Mask, A.X, B.X), Select(Mask, A.Y, B.Y), Select(Mask, A.Z, B.Z) };
+    }
+
+    // Vector3::Normalize와 동일 - 길이가 KINDA_SMALL 미만이면 영벡터
+    template<typename F>
+    inline TVec3<F> Normalize(const TVec3<F>& A)
+    {
+        const F Length = Sqrt(LengthSq(A));
+        const auto bValid = Length >= F::Splat(KINDA_SMALL);
+        const F InvLength = F::Splat(1.0f) / Select(bValid, Length, F::Splat(1.0f));
+        return Select(bValid, A * InvLength, Zero3<F>());
+    }
+
+    template<typename F>
+    inline TVec3<F> LoadVec3(const Vector3* P)
+    {
+        TVec3<F> Result;
+        F::LoadVec3(&P->x, Result.X, Result.Y, Result.Z);
+        return Result;
+    }
+    template<typename F>
+    inline void StoreVec3(Vector3* P, const TVec3<F>& In)
+    {
+        F::StoreVec3(&P->x, In.X, In.Y, In.Z);
+    }
+
+    template<typename F>
+    inline F DotQuat(const TQuat<F>& A, const TQuat<F>& B)
+    {
+        return A.X * B.X + A.Y * B.Y + A.Z * B.Z + A.W * B.W;
+    }
+    template<typename F>
+    inline TQuat<F> NormalizeQuat(const TQuat<F>& Q)
+    {
+        const F Length = Sqrt(DotQuat(Q, Q));
+        const F Zero = F::Splat(0.0f);
+        const F InvLength = F::Splat(1.0f) / Select(Length > Zero, Length, F::Splat(1.0f));
+        return { Q.X * InvLength, Q.Y * InvLength, Q.Z * InvLength, Q.W * InvLength };
+    }
+    // 해밀턴 곱 A*B - XMQuaternionMultiply(B, A)와 동일 (B 회전 후 A 회전)
+    template<typename F>
+    inline TQuat<F> MultiplyQuat(const TQuat<F>& A, const TQuat<F>& B)
+    {
+        return {
+            A.W * B.X + A.X * B.W + A.Y * B.Z - A.Z * B.Y,
+            A.W * B.Y - A.X * B.Z + A.Y * B.W + A.Z * B.X,
+            A.W * B.Z + A.X * B.Y - A.Y * B.X + A.Z * B.W,
+            A.W * B.W - A.X * B.X - A.Y * B.Y - A.Z * B.Z
+        };
+    }
+    // 단위 쿼터니언으로 벡터 회전 - XMVector3Rotate와 동일
+    template<typename F>
+    inline TVec3<F> RotateVector(const TVec3<F>& V, const TQuat<F>& Q)
+    {
+        const TVec3<F> U = { Q.X, Q.Y, Q.Z };
+        const TVec3<F> T = Cross(U, V) * F::Splat(2.0f);
+        return V + T * Q.W + Cross(U, T);
+    }
+
+    // XMScalarSinCos와 같은 범위 축소 및 최소최대 다항식 근사
+    template<typename F>
+    inline void SinCos(F Value, F& OutSin, F& OutCos)
+    {
+        const F Quotient = Round(Value * F::Splat(XM_1DIV2PI));
+        F Y = Value - Quotient * F::Splat(XM_2PI);
+
+        // [-pi/2, pi/2] 로 접기
+        const F HalfPi = F::Splat(XM_PIDIV2);
+        const auto bAbove = Y > HalfPi;
+        const auto bBelow = Y < -HalfPi;
+        Y = Select(bAbove, F::Splat(XM_PI) - Y, Select(bBelow, F::Splat(-XM_PI) - Y, Y));
+        const F Sign = Select(bAbove | bBelow, F::Splat(-1.0f), F::Splat(1.0f));
+
+        const F Y2 = Y * Y;
+        F SinPoly = F::Splat(-2.3889859e-08f) * Y2 + F::Splat(2.7525562e-06f);
+        SinPoly = SinPoly * Y2 - F::Splat(0.00019840874f);
+        SinPoly = SinPoly * Y2 + F::Splat(0.0083333310f);
+        SinPoly = SinPoly * Y2 - F::Splat(0.16666667f);
+        SinPoly = SinPoly * Y2 + F::Splat(1.0f);
+        OutSin = SinPoly * Y;
+
+        F CosPoly = F::Splat(-2.6051615e-07f) * Y2 + F::Splat(2.4760495e-05f);
+        CosPoly = CosPoly * Y2 - F::Splat(0.0013888378f);
+        CosPoly = CosPoly * Y2 + F::Splat(0.041666638f);
+        CosPoly = CosPoly * Y2 - F::Splat(0.5f);
+        CosPoly = CosPoly * Y2 + F::Splat(1.0f);
+        OutCos = Sign * CosPoly;
+    }
+#pragma endregion
+}
+}
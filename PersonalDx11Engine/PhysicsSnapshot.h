@@ -0,0 +1,111 @@
+#pragma once
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+/// <summary>
+/// 물리 상태 스냅샷 - 강체 저장소, 충돌 트리, 충돌쌍 캐시(누적 람다 포함)를 하나의 바이트 버퍼에 복사
+/// 컴포넌트를 거치지 않고 배열 단위 memcpy로만 기록/복원하며, 버퍼를 재사용하면 추가 할당이 없음
+/// 등록된 강체/충돌체 구성이 캡처 시점과 같을 때만 복원 가능
+/// </summary>
+struct FPhysicsSnapshot
+{
+    std::vector<uint8_t> Data;
+
+    uint64_t SimulationStep = 0;          // 캡처 시점까지 진행한 고정 단계 수
+    uint64_t BodyLayoutVersion = 0;       // 강체 할당/해제 버전
+    uint64_t CollisionLayoutVersion = 0;  // 충돌체 등록/해제 버전
+
+    bool IsValid() const { return !Data.empty(); }
+    size_t GetSize() const { return Data.size(); }
+};
+
+// 스냅샷 버퍼 순차 기록
+class FPhysicsSnapshotWriter
+{
+public:
+    // 기존 내용은 버리되 용량은 유지
+    explicit FPhysicsSnapshotWriter(std::vector<uint8_t>& InData) : Data(InData) { Data.clear(); }
+
+    template<typename T>
+    void Write(const T& InValue)
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "Snapshot value must be memcpy-able");
+        Append(&InValue, sizeof(T));
+    }
+
+    // 개수 + 원소 배열
+    template<typename T>
+    void WriteArray(const std::vector<T>& InValues)
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "Snapshot element must be memcpy-able");
+        Write<uint64_t>(InValues.size());
+        Append(InValues.data(), InValues.size() * sizeof(T));
+    }
+
+private:
+    void Append(const void* InSrc, size_t InBytes)
+    {
+        if (InBytes == 0)
+            return;
+        const size_t Offset = Data.size();
+        Data.resize(Offset + InBytes);
+        std::memcpy(Data.data() + Offset, InSrc, InBytes);
+    }
+
+private:
+    std::vector<uint8_t>& Data;
+};
+
+// 스냅샷 버퍼 순차 읽기 - 범위를 벗어나면 실패 상태로 남음
+class FPhysicsSnapshotReader
+{
+public:
+    explicit FPhysicsSnapshotReader(const std::vector<uint8_t>& InData) : Data(InData) {}
+
+    template<typename T>
+    bool Read(T& OutValue)
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "Snapshot value must be memcpy-able");
+        return Extract(&OutValue, sizeof(T));
+    }
+
+    template<typename T>
+    bool ReadArray(std::vector<T>& OutValues)
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "Snapshot element must be memcpy-able");
+        uint64_t Count = 0;
+        if (!Read(Count) || Count > (Data.size() - Offset) / sizeof(T))
+        {
+            bGood = false;
+            return false;
+        }
+        OutValues.resize(static_cast<size_t>(Count));
+        return Extract(OutValues.data(), static_cast<size_t>(Count) * sizeof(T));
+    }
+
+    bool IsGood() const { return bGood; }
+    bool IsEnd() const { return Offset == Data.size(); }
+
+private:
+    bool Extract(void* OutDst, size_t InBytes)
+    {
+        if (!bGood || InBytes > Data.size() - Offset)
+        {
+            bGood = false;
+            return false;
+        }
+        if (InBytes > 0)
+        {
+            std::memcpy(OutDst, Data.data() + Offset, InBytes);
+            Offset += InBytes;
+        }
+        return true;
+    }
+
+private:
+    const std::vector<uint8_t>& Data;
+    size_t Offset = 0;
+    bool bGood = true;
+};
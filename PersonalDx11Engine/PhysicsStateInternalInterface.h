@@ -23,9 +23,9 @@ public:
     virtual void P_SetAngularVelocity(const Vector3& InAngularVelocity) = 0;
     virtual void P_AddAngularVelocity(const Vector3& InAngularVelocityDelta) = 0;
 
-    virtual const FTransform& P_GetWorldTransform() const = 0;
-    const Vector3 P_GetWorldPosition() const { return P_GetWorldTransform().Position; }
-    const Quaternion P_GetWorldRotation() const { return P_GetWorldTransform().Rotation; }
+    virtual FTransform P_GetWorldTransform() const = 0;
+    virtual Vector3 P_GetWorldPosition() const = 0;
+    virtual Quaternion P_GetWorldRotation() const = 0;
 
     virtual void P_SetWorldTransform(const FTransform& InTransform) = 0;
     
@@ -0,0 +1,250 @@
+#pragma once
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
+// 물리 Tick 구간 - 서로 겹치지 않으며 합계가 Tick 전체 시간
+enum class EPhysicsPhase : uint8_t
+{
+    Prepare = 0,        // 객체 수집, 상태 캡처
+    JobExecution,       // 작업 큐 정렬 및 실행
+    CollisionTransform, // 충돌 트리 바운드 갱신 (서브스텝 합계)
+    CollisionPairs,     // 넓은 단계 충돌쌍 갱신 (서브스텝 합계)
+    Islands,            // 시뮬레이션 섬 구성 및 수면 판정 (서브스텝 합계)
+    Narrowphase,        // 좁은 단계 충돌 검사 (서브스텝 합계)
+    Solver,             // 위치 보정 및 제약 반복 (서브스텝 합계)
+    Events,             // 충돌 이벤트 전달 (서브스텝 합계)
+    Integrate,          // 적분 (서브스텝 합계)
+    Finalize,           // 시뮬레이션 결과 동기화
+    Count
+};
+
+/// <summary>
+/// 물리 Tick 한 번의 구간별 소요시간과 처리량
+/// </summary>
+struct FPhysicsTickStats
+{
+    double PhaseTimeMs[static_cast<size_t>(EPhysicsPhase::Count)] = {};
+
+    uint64_t TickIndex = 0;             // 물리 시스템 시작 이후 Tick 번호
+    uint32_t SubSteps = 0;              // 적분까지 진행한 서브스텝 수
+    uint32_t SimulatedObjects = 0;
+    uint32_t JobRequests = 0;
+    uint32_t BroadphasePairs = 0;       // 서브스텝별 활성 충돌쌍 수 합계
+    uint32_t NarrowphaseHits = 0;       // 서브스텝별 실제 접촉 수 합계
+    uint32_t TreeReinserts = 0;         // 뚱뚱한 바운드를 벗어나 트리에 다시 삽입한 리프 수
+    uint32_t SolverIterations = 0;      // 섬별로 수행한 제약 반복 수 합계
+    uint32_t UnconvergedIslands = 0;    // 최대 반복 수까지 수렴하지 못한 섬 수
+    uint32_t LocalSubstepBodies = 0;    // 이른 충돌로 지역 서브스텝을 진행한 강체 수 합계
+    uint32_t LocalSubSteps = 0;         // 서브스텝별 지역 서브스텝 수 합계
+
+    inline double GetPhaseTimeMs(EPhysicsPhase InPhase) const { return PhaseTimeMs[static_cast<size_t>(InPhase)]; }
+
+    double GetTotalTimeMs() const
+    {
+        double Total = 0.0;
+        for (double Time : PhaseTimeMs)
+        {
+            Total += Time;
+        }
+        return Total;
+    }
+
+    static const char* GetPhaseName(EPhysicsPhase InPhase)
+    {
+        switch (InPhase)
+        {
+            case EPhysicsPhase::Prepare:            return "Prepare";
+            case EPhysicsPhase::JobExecution:       return "JobExecution";
+            case EPhysicsPhase::CollisionTransform: return "CollisionTransform";
+            case EPhysicsPhase::CollisionPairs:     return "CollisionPairs";
+            case EPhysicsPhase::Islands:            return "Islands";
+            case EPhysicsPhase::Narrowphase:        return "Narrowphase";
+            case EPhysicsPhase::Solver:             return "Solver";
+            case EPhysicsPhase::Events:             return "Events";
+            case EPhysicsPhase::Integrate:          return "Integrate";
+            case EPhysicsPhase::Finalize:           return "Finalize";
+            default:                                return "Unknown";
+        }
+    }
+};
+
+// 범위 시간 측정 - 소멸 시 해당 구간에 누적, 통계 대상이 없으면 시간을 읽지 않음
+class FPhysicsPhaseTimer
+{
+public:
+    FPhysicsPhaseTimer(FPhysicsTickStats* InStats, EPhysicsPhase InPhase)
+        : Stats(InStats), Phase(InPhase)
+    {
+        if (Stats)
+        {
+            StartTime = std::chrono::high_resolution_clock::now();
+        }
+    }
+
+    ~FPhysicsPhaseTimer()
+    {
+        if (!Stats)
+            return;
+
+        auto EndTime = std::chrono::high_resolution_clock::now();
+        Stats->PhaseTimeMs[static_cast<size_t>(Phase)] +=
+            std::chrono::duration<double, std::milli>(EndTime - StartTime).count();
+    }
+
+    FPhysicsPhaseTimer(const FPhysicsPhaseTimer&) = delete;
+    FPhysicsPhaseTimer& operator=(const FPhysicsPhaseTimer&) = delete;
+
+private:
+    FPhysicsTickStats* Stats;
+    EPhysicsPhase Phase;
+    std::chrono::high_resolution_clock::time_point StartTime;
+};
+
+// 기록 구간 평균/최대값
+struct FPhysicsStatsSummary
+{
+    size_t TickCount = 0;
+    double AvgPhaseTimeMs[static_cast<size_t>(EPhysicsPhase::Count)] = {};
+    double AvgTotalTimeMs = 0.0;
+    double MaxTotalTimeMs = 0.0;
+    double AvgSubSteps = 0.0;
+    double AvgBroadphasePairs = 0.0;
+    double AvgNarrowphaseHits = 0.0;
+    double AvgTreeReinserts = 0.0;
+    double AvgSolverIterations = 0.0;
+    double AvgLocalSubstepBodies = 0.0;
+    uint32_t MaxSubSteps = 0;
+    uint32_t TotalUnconvergedIslands = 0;
+};
+
+/// <summary>
+/// 최근 물리 Tick 통계 고정 크기 원형 버퍼
+/// 초기화 시 한번만 할당하며 가득 차면 가장 오래된 기록을 덮어씀
+/// </summary>
+class FPhysicsStatsHistory
+{
+public:
+    void Initialize(size_t InCapacity)
+    {
+        Entries.assign(InCapacity > 0 ? InCapacity : 1, FPhysicsTickStats());
+        Clear();
+    }
+
+    void Clear()
+    {
+        Head = 0;
+        Count = 0;
+    }
+
+    void Push(const FPhysicsTickStats& InStats)
+    {
+        if (Entries.empty())
+            return;
+
+        Entries[Head] = InStats;
+        Head = (Head + 1) % Entries.size();
+        if (Count < Entries.size())
+        {
+            ++Count;
+        }
+    }
+
+    size_t GetCount() const { return Count; }
+    size_t GetCapacity() const { return Entries.size(); }
+
+    // 0이 가장 최근 기록 - InAge < GetCount()
+    const FPhysicsTickStats& GetRecent(size_t InAge) const
+    {
+        const size_t Capacity = Entries.size();
+        return Entries[(Head + Capacity - 1 - InAge) % Capacity];
+    }
+
+    // 오래된 기록부터 순회
+    template<typename Func>
+    void ForEach(Func&& InFunc) const
+    {
+        for (size_t Age = Count; Age > 0; --Age)
+        {
+            InFunc(GetRecent(Age - 1));
+        }
+    }
+
+    FPhysicsStatsSummary Summarize() const
+    {
+        FPhysicsStatsSummary Summary;
+        Summary.TickCount = Count;
+        if (Count == 0)
+            return Summary;
+
+        ForEach([&Summary](const FPhysicsTickStats& Stats) {
+            for (size_t i = 0; i < static_cast<size_t>(EPhysicsPhase::Count); ++i)
+            {
+                Summary.AvgPhaseTimeMs[i] += Stats.PhaseTimeMs[i];
+            }
+            const double Total = Stats.GetTotalTimeMs();
+            Summary.AvgTotalTimeMs += Total;
+            Summary.MaxTotalTimeMs = Total > Summary.MaxTotalTimeMs ? Total : Summary.MaxTotalTimeMs;
+            Summary.AvgSubSteps += Stats.SubSteps;
+            Summary.AvgBroadphasePairs += Stats.BroadphasePairs;
+            Summary.AvgNarrowphaseHits += Stats.NarrowphaseHits;
+            Summary.AvgTreeReinserts += Stats.TreeReinserts;
+            Summary.AvgSolverIterations += Stats.SolverIterations;
+            Summary.AvgLocalSubstepBodies += Stats.LocalSubstepBodies;
+            Summary.MaxSubSteps = Stats.SubSteps > Summary.MaxSubSteps ? Stats.SubSteps : Summary.MaxSubSteps;
+            Summary.TotalUnconvergedIslands += Stats.UnconvergedIslands;
+                });
+
+        const double InvCount = 1.0 / static_cast<double>(Count);
+        for (double& Time : Summary.AvgPhaseTimeMs)
+        {
+            Time *= InvCount;
+        }
+        Summary.AvgTotalTimeMs *= InvCount;
+        Summary.AvgSubSteps *= InvCount;
+        Summary.AvgBroadphasePairs *= InvCount;
+        Summary.AvgNarrowphaseHits *= InvCount;
+        Summary.AvgTreeReinserts *= InvCount;
+        Summary.AvgSolverIterations *= InvCount;
+        Summary.AvgLocalSubstepBodies *= InvCount;
+        return Summary;
+    }
+
+    // 오래된 기록부터 CSV로 기록 - 첫 줄은 열 이름
+    void WriteCsv(std::ostream& Out) const
+    {
+        Out << "Tick";
+        for (size_t i = 0; i < static_cast<size_t>(EPhysicsPhase::Count); ++i)
+        {
+            Out << ',' << FPhysicsTickStats::GetPhaseName(static_cast<EPhysicsPhase>(i)) << "Ms";
+        }
+        Out << ",TotalMs,SubSteps,SimulatedObjects,JobRequests,BroadphasePairs,NarrowphaseHits,"
+               "TreeReinserts,SolverIterations,UnconvergedIslands,LocalSubstepBodies,LocalSubSteps\n";
+
+        ForEach([&Out](const FPhysicsTickStats& Stats) {
+            Out << Stats.TickIndex;
+            for (double Time : Stats.PhaseTimeMs)
+            {
+                Out << ',' << Time;
+            }
+            Out << ',' << Stats.GetTotalTimeMs()
+                << ',' << Stats.SubSteps
+                << ',' << Stats.SimulatedObjects
+                << ',' << Stats.JobRequests
+                << ',' << Stats.BroadphasePairs
+                << ',' << Stats.NarrowphaseHits
+                << ',' << Stats.TreeReinserts
+                << ',' << Stats.SolverIterations
+                << ',' << Stats.UnconvergedIslands
+                << ',' << Stats.LocalSubstepBodies
+                << ',' << Stats.LocalSubSteps << '\n';
+                });
+    }
+
+private:
+    std::vector<FPhysicsTickStats> Entries;
+    size_t Head = 0;    // 다음 기록 위치
+    size_t Count = 0;
+};
@@ -3,6 +3,8 @@
 #include <algorithm>
 #include "Debug.h"
 #include "ConfigReadManager.h"
+#include <chrono>
+#include <fstream>
 
 UPhysicsSystem::UPhysicsSystem()
 {
@@ -22,61 +24,257 @@ void UPhysicsSystem::LoadConfigFromIni()
     UConfigReadManager::Get()->GetValue("MinSubStepTickTime", MinSubStepTickTime);
     UConfigReadManager::Get()->GetValue("MaxSubSteps", MaxSubSteps);
     UConfigReadManager::Get()->GetValue("MinSubSteps", MinSubSteps);
+    UConfigReadManager::Get()->GetValue("PhysicsWorkerThreads", PhysicsWorkerThreads);
+    UConfigReadManager::Get()->GetValue("ParallelChunkSize", ParallelChunkSize);
+    UConfigReadManager::Get()->GetValue("ParallelMinObjects", ParallelMinObjects);
+    UConfigReadManager::Get()->GetValue("bDeterministicParallel", bDeterministicParallel);
+    UConfigReadManager::Get()->GetValue("bUseBatchIntegrator", bUseBatchIntegrator);
+    UConfigReadManager::Get()->GetValue("PhysicsSimdLevel", PhysicsSimdLevel);
+    UConfigReadManager::Get()->GetValue("bCoalescePhysicsJobs", bCoalescePhysicsJobs);
+    UConfigReadManager::Get()->GetValue("bSortPhysicsJobs", bSortPhysicsJobs);
+    UConfigReadManager::Get()->GetValue("bStrictFixedStep", bStrictFixedStep);
+    UConfigReadManager::Get()->GetValue("bLocalSubstepping", bLocalSubstepping);
+    UConfigReadManager::Get()->GetValue("MaxLocalSubSteps", MaxLocalSubSteps);
+    UConfigReadManager::Get()->GetValue("bInterpolateRenderTransform", bInterpolateRenderTransform);
+    UConfigReadManager::Get()->GetValue("bAsyncPhysics", bAsyncPhysics);
+    UConfigReadManager::Get()->GetValue("PhysicsStatsHistorySize", PhysicsStatsHistorySize);
 }
 
-void UPhysicsSystem::RequestPhysicsJob(const FPhysicsJobRequest& RequestedJob)
+void UPhysicsSystem::SetWorkerThreadCount(size_t InThreadCount)
 {
-    if (!RequestedJob.IsValid())
+    if (bIsSimulating)
     {
-        LOG_FUNC_CALL("[WARNING] Invalid Job Requested!");
+        LOG_FUNC_CALL("[WARNING] Cannot change worker count while simulating");
         return;
     }
-    JobQueue.Push(RequestedJob);
+    // 호출 스레드가 작업에 참여하므로 작업자는 하나 적게 생성
+    InThreadCount = std::max<size_t>(1, InThreadCount);
+    WorkerPool.Initialize(InThreadCount - 1);
 }
 
-void UPhysicsSystem::RegisterPhysicsObject(std::shared_ptr<IPhysicsObejct>& InObject)
+bool UPhysicsSystem::RequestPhysicsJob(const FPhysicsJob& InJob)
+{
+    return RequestPhysicsJobs(&InJob, 1);
+}
+
+bool UPhysicsSystem::RequestPhysicsJobs(const FPhysicsJob* InJobs, size_t InCount)
+{
+    if (!InJobs || InCount == 0)
+    {
+        LOG_FUNC_CALL("[WARNING] Invalid Job Requested!");
+        return false;
+    }
+
+    if (!JobQueue.Submit(InJobs, InCount))
+    {
+        LOG_FUNC_CALL("[Eror] Too Many Physics Job Requested! Pool is Full");
+        return false;
+    }
+    return true;
+}
+
+bool UPhysicsSystem::ResetSimulation()
+{
+    WaitAsyncTick();
+    if (Registry.GetCount() > 0 || BodyStore.GetAliveCount() > 0)
+    {
+        LOG_FUNC_CALL("[WARNING] Physics objects are still registered");
+        return false;
+    }
+    if (!GetCollisionSubsystem()->ResetState())
+    {
+        LOG_FUNC_CALL("[WARNING] Collision components are still registered");
+        return false;
+    }
+
+    Registry.Clear();
+    SimulatedObjectCount = 0;
+    BodyStore.Reset();
+    // 이전 슬롯으로 향한 작업이 새 강체에 적용되지 않도록 대기 중인 작업 폐기
+    JobQueue.Initialize(JobQueue.GetJobCapacity(), &BodyStore);
+    JobTargetSlots.clear();
+
+    LocalSubstepBodies.clear();
+    LocalRemainingTimes.clear();
+    PendingFixedSteps = 0;
+    AccumulatedTime = 0.0f;
+    SimulationStep = 0;
+    bRestoredFromSnapshot = false;
+    return true;
+}
+
+void UPhysicsSystem::SetPhysicsJobCapacity(size_t InJobCapacity)
+{
+    // 물리 스레드가 큐를 비우는 중일 수 있으므로 진행 중인 Tick 완료 후 재생성
+    WaitAsyncTick();
+    JobQueue.Initialize(InJobCapacity, &BodyStore);
+}
+
+FPhysicsObjectHandle UPhysicsSystem::RegisterPhysicsObject(IPhysicsObejct* InObject)
 {
     if (!InObject)
+        return FPhysicsObjectHandle();
+
+    return Registry.Register(InObject);
+}
+
+void UPhysicsSystem::UnregisterPhysicsObject(const FPhysicsObjectHandle& InHandle)
+{
+    // 시뮬레이션 중이면 등록부가 표시만 하고 Finalize에서 정리
+    Registry.Unregister(InHandle);
+}
+
+// 메인 물리 업데이트 (메인 루프에서 호출)
+void UPhysicsSystem::TickPhysics(const float DeltaTime)
+{
+    // 진행 중인 비동기 Tick이 있으면 먼저 끝냄
+    WaitAsyncTick();
+
+    if (!BeginSimulation(DeltaTime))
         return;
 
-    auto It = std::find_if(RegisteredObjects.begin(), RegisteredObjects.end(), [&InObject](const std::weak_ptr<IPhysicsObejct>& Object)
-                 {
-                     return Object.lock() == InObject;
-                 });
-    //이미 등록된 객체
-    if (It != RegisteredObjects.end())
+    RunSimulation();
+
+    // 시뮬레이션 결과 적용
+    FinalizeSimulation();
+}
+
+bool UPhysicsSystem::BeginAsyncTick(const float DeltaTime)
+{
+    if (!bAsyncPhysics)
+        return false;
+
+    // 이전 Tick 결과를 먼저 반영 - 동시에 진행 중인 Tick은 하나뿐
+    WaitAsyncTick();
+
+    if (!BeginSimulation(DeltaTime))
+        return true;
+
+    {
+        std::lock_guard<std::mutex> Lock(AsyncMutex);
+        bAsyncRequested = true;
+    }
+    bAsyncTickInFlight = true;
+    AsyncCondition.notify_all();
+    return true;
+}
+
+void UPhysicsSystem::WaitAsyncTick()
+{
+    if (!bAsyncTickInFlight)
         return;
-    
-    RegisteredObjects.push_back(InObject);
+
+    WaitAsyncWork();
+    bAsyncTickInFlight = false;
+
+    // 동기화 지점 - 결과를 컴포넌트에 반영하고 모아둔 충돌 이벤트 전달
+    FinalizeSimulation();
 }
 
-void UPhysicsSystem::UnregisterPhysicsObject(std::shared_ptr<IPhysicsObejct>& InObject)
+void UPhysicsSystem::WaitAsyncWork()
 {
-    if (!InObject)
+    if (!bAsyncTickInFlight)
         return;
 
-    RegisteredObjects.erase(
-        std::remove_if(
-            RegisteredObjects.begin(), RegisteredObjects.end(),
-            [&InObject](const std::weak_ptr<IPhysicsObejct>& Object) {
-                return Object.lock() == InObject;
-            }
-        ),
-        RegisteredObjects.end()
-    );
+    std::unique_lock<std::mutex> Lock(AsyncMutex);
+    AsyncDoneCondition.wait(Lock, [this]() { return !bAsyncRequested; });
+}
+
+void UPhysicsSystem::SetAsyncPhysics(const bool InBool)
+{
+    WaitAsyncTick();
+
+    bAsyncPhysics = InBool;
 
+    if (!InBool)
+    {
+        StopAsyncThread();
+    }
+    else if (!AsyncThread.joinable())
+    {
+        bAsyncExit = false;
+        AsyncThread = std::thread(&UPhysicsSystem::AsyncThreadLoop, this);
+    }
 }
 
-// 메인 물리 업데이트 (메인 루프에서 호출)
-void UPhysicsSystem::TickPhysics(const float DeltaTime)
+void UPhysicsSystem::StopAsyncThread()
 {
-    // 시간 누적 및 서브스텝 계산
+    if (!AsyncThread.joinable())
+        return;
+
+    {
+        std::lock_guard<std::mutex> Lock(AsyncMutex);
+        bAsyncExit = true;
+    }
+    AsyncCondition.notify_all();
+    AsyncThread.join();
+}
+
+void UPhysicsSystem::AsyncThreadLoop()
+{
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> Lock(AsyncMutex);
+            AsyncCondition.wait(Lock, [this]() { return bAsyncRequested || bAsyncExit; });
+            if (bAsyncExit)
+                return;
+        }
+
+        // 준비와 결과 반영은 메인 스레드 - 여기서는 저장소와 충돌 하부시스템만 갱신
+        RunSimulation();
+
+        {
+            std::lock_guard<std::mutex> Lock(AsyncMutex);
+            bAsyncRequested = false;
+        }
+        AsyncDoneCondition.notify_all();
+    }
+}
+
+bool UPhysicsSystem::BeginSimulation(const float DeltaTime)
+{
+    // 새 프레임 접촉 보고 - 진행할 단계가 없는 프레임은 빈 보고를 남김
+    GetCollisionSubsystem()->ClearContactReports();
     AccumulatedTime += DeltaTime;
-    int NumSubsteps = CalculateRequiredSubsteps();
-    NumSubsteps = Math::Clamp(NumSubsteps, 0, MaxSubSteps);
+    PendingFixedSteps = 0;
+
+    if (bStrictFixedStep)
+    {
+        // 누적 시간만큼 고정 단계 진행 - 부족하면 작업도 다음 단계까지 대기
+        const int NumSteps = CalculateRequiredSubsteps();
+        if (NumSteps <= 0)
+        {
+            LastTickStats = FPhysicsTickStats();
+            return false;
+        }
+
+        AccumulatedTime -= NumSteps * FixedTimeStep;
+        // 최대 단계 수로도 따라잡지 못한 시간은 버림 - 밀린 시간이 계속 쌓이지 않도록
+        if (NumSteps >= MaxSubSteps)
+        {
+            AccumulatedTime = 0.0f;
+        }
+        PendingFixedSteps = NumSteps;
+    }
 
     // 물리 시뮬레이션 준비
     PrepareSimulation();
+    return true;
+}
+
+void UPhysicsSystem::RunSimulation()
+{
+    if (PendingFixedSteps > 0)
+    {
+        for (int i = 0; i < PendingFixedSteps; ++i)
+        {
+            SimulateFixedStep(FixedTimeStep);
+            ++SimulationStep;
+        }
+        PendingFixedSteps = 0;
+        return;
+    }
 
     // 서브스텝 시뮬레이션
     for (int i = 0; i < MaxSubSteps; i++)
@@ -87,18 +285,122 @@ void UPhysicsSystem::TickPhysics(const float DeltaTime)
             break;
         }
     }
+}
 
-    // 시뮬레이션 결과 적용
+void UPhysicsSystem::StepFixed(const int NumSteps)
+{
+    WaitAsyncTick();
+    if (bIsSimulating || NumSteps <= 0)
+        return;
+
+    GetCollisionSubsystem()->ClearContactReports();
+    PrepareSimulation();
+    PendingFixedSteps = NumSteps;
+    RunSimulation();
     FinalizeSimulation();
 }
 
+void UPhysicsSystem::SetStrictFixedStep(const bool InBool)
+{
+    bStrictFixedStep = InBool;
+    GetCollisionSubsystem()->SetCanonicalPairOrder(InBool);
+    UpdateCollisionSubstepMode();
+}
+
+void UPhysicsSystem::SetLocalSubstepping(const bool InBool)
+{
+    bLocalSubstepping = InBool;
+    UpdateCollisionSubstepMode();
+}
+
+void UPhysicsSystem::UpdateCollisionSubstepMode()
+{
+    GetCollisionSubsystem()->SetLocalSubstepping(bLocalSubstepping && !bStrictFixedStep);
+}
+
+bool UPhysicsSystem::CaptureSnapshot(FPhysicsSnapshot& OutSnapshot) const
+{
+    if (bIsSimulating)
+    {
+        LOG_FUNC_CALL("[WARNING] Cannot capture snapshot while simulating");
+        return false;
+    }
+
+    FCollisionProcessor* Collision = GetCollisionSubsystem();
+
+    FPhysicsSnapshotWriter Writer(OutSnapshot.Data);
+    Writer.Write(AccumulatedTime);
+    BodyStore.WriteSnapshot(Writer);
+    Collision->WriteSnapshot(Writer);
+
+    OutSnapshot.SimulationStep = SimulationStep;
+    OutSnapshot.BodyLayoutVersion = BodyStore.GetLayoutVersion();
+    OutSnapshot.CollisionLayoutVersion = Collision->GetLayoutVersion();
+    return true;
+}
+
+bool UPhysicsSystem::RestoreSnapshot(const FPhysicsSnapshot& InSnapshot)
+{
+    if (bIsSimulating || !InSnapshot.IsValid())
+    {
+        LOG_FUNC_CALL("[WARNING] Cannot restore snapshot now");
+        return false;
+    }
+
+    FCollisionProcessor* Collision = GetCollisionSubsystem();
+
+    // 캡처 이후 슬롯/노드 구성이 바뀌면 배열 의미가 달라지므로 거부
+    if (InSnapshot.BodyLayoutVersion != BodyStore.GetLayoutVersion() ||
+        InSnapshot.CollisionLayoutVersion != Collision->GetLayoutVersion())
+    {
+        LOG_FUNC_CALL("[WARNING] Physics objects changed since snapshot was captured");
+        return false;
+    }
+
+    FPhysicsSnapshotReader Reader(InSnapshot.Data);
+    Reader.Read(AccumulatedTime);
+    if (!BodyStore.ReadSnapshot(Reader) || !Collision->ReadSnapshot(Reader) || !Reader.IsEnd())
+    {
+        // 부분 복원된 상태는 신뢰할 수 없음
+        LOG_FUNC_CALL("[Error] Corrupted physics snapshot");
+        return false;
+    }
+
+    SimulationStep = InSnapshot.SimulationStep;
+    bRestoredFromSnapshot = true;
+    // 복원 지점에서 보간이 끊기도록 이전 단계 값도 맞춤
+    BodyStore.SavePreviousTransforms();
+    return true;
+}
+
+float UPhysicsSystem::GetInterpolationAlpha() const
+{
+    // 가변 서브스텝은 누적 시간을 매 Tick 소모하므로 항상 현재 상태
+    if (!bStrictFixedStep || FixedTimeStep < KINDA_SMALL)
+        return 1.0f;
+    return Math::Clamp(AccumulatedTime / FixedTimeStep, 0.0f, 1.0f);
+}
+
 void UPhysicsSystem::Initialzie()
 {
     try
     {
         LoadConfigFromIni();
-        RegisteredObjects.reserve(InitialPhysicsObjectCapacity);
-        PhysicsJobPool.Initialize(InitialPhysicsJobPoolSizeMB * 1024 * 1024);
+        SetStrictFixedStep(bStrictFixedStep);
+        SetLocalSubstepping(bLocalSubstepping);
+        Registry.Reserve(InitialPhysicsObjectCapacity);
+        BodyStore.Reserve(InitialPhysicsObjectCapacity);
+        StatsHistory.Initialize(static_cast<size_t>(std::max(PhysicsStatsHistorySize, 1)));
+        GetCollisionSubsystem()->BindBodyStore(&BodyStore);
+        GetCollisionSubsystem()->BindWorkerPool(&WorkerPool);
+        SetSimdLevel(GetSimdLevel());
+        JobQueue.Initialize(static_cast<size_t>(InitialPhysicsJobPoolSizeMB) * 1024 * 1024 / sizeof(FPhysicsJob), &BodyStore);
+
+        size_t ThreadCount = PhysicsWorkerThreads > 0 ?
+            static_cast<size_t>(PhysicsWorkerThreads) : std::thread::hardware_concurrency();
+        SetWorkerThreadCount(ThreadCount);
+
+        SetAsyncPhysics(bAsyncPhysics);
     }
     catch (...)
     {
@@ -109,8 +411,12 @@ void UPhysicsSystem::Initialzie()
 
 void UPhysicsSystem::Release()
 {
-    RegisteredObjects.clear();
-    PhysicsJobPool.Reset();
+    WaitAsyncTick();
+    StopAsyncThread();
+    WorkerPool.Release();
+    SimulatedObjectCount = 0;
+    Registry.Clear();
+    JobQueue.Release();
 }
 
 // 필요한 서브스텝 수 계산
@@ -124,46 +430,111 @@ int UPhysicsSystem::CalculateRequiredSubsteps()
 void UPhysicsSystem::PrepareSimulation()
 {
     bIsSimulating = true;
+    LastIntegrationTimeMs = 0.0;
 
-    // 파괴된(만료된) 객체 소멸
-    RegisteredObjects.erase(
-        std::remove_if(
-            RegisteredObjects.begin(),
-            RegisteredObjects.end(),
-            [](const std::weak_ptr<IPhysicsObejct>& objWeak) {
-                return objWeak.expired();
-            }
-        ),        RegisteredObjects.end()
-    );
+    CurrentTickStats = FPhysicsTickStats();
+    CurrentTickStats.TickIndex = ++TickCount;
 
-    // 모든 물리 객체의 현재 상태 캡처
-    for (auto& ObjectWeak : RegisteredObjects)
     {
-        auto Object = ObjectWeak.lock();
-        if (!Object)
+        FPhysicsPhaseTimer Timer(&CurrentTickStats, EPhysicsPhase::Prepare);
+
+        // 저장소 순서로 정렬 - 등록 순서가 대부분 유지되므로 비용이 작음
+        Registry.SortByBodyId();
+        SimulatedObjectCount = Registry.GetDenseCount();
+        // Finalize까지 밀집 배열 고정 - 도중에 해제된 객체는 nullptr로 표시됨
+        Registry.Lock();
+
+        // 모든 물리 객체의 현재 상태 캡처
+        // 스냅샷 복원 직후에는 저장소가 기준 - 충돌 검사가 컴포넌트 트랜스폼을 읽으므로 먼저 컴포넌트에 반영
+        const bool bSyncFromStore = bRestoredFromSnapshot;
+        bRestoredFromSnapshot = false;
+        for (size_t i = 0; i < SimulatedObjectCount; ++i)
         {
-            LOG_FUNC_CALL("[Error] InValid PhysicsObejct");
+            IPhysicsObejct* Object = Registry.GetObjectAt(i);
+
+            if (bSyncFromStore)
+            {
+                if (Object->IsActive())
+                {
+                    Object->SynchronizeCachedStateFromSimulated();
+                }
+            }
+            // 외부상태 현재 상태로 캡처
+            else if (Object->IsActive() && (Object->IsDirtyPhysicsState()))
+            {
+                Object->UpdateSimulatedStateFromCached();
+            }
+        }
+    }
+
+    {
+        FPhysicsPhaseTimer Timer(&CurrentTickStats, EPhysicsPhase::JobExecution);
+
+        // 작업 큐 실행 - 이 시점 이후 제출된 작업은 다음 Tick에 실행
+        ExecutePhysicsJobs(JobQueue.BeginDrain(bSortPhysicsJobs));
+        //실행한 작업 및 아레나 버퍼 정리
+        JobQueue.EndDrain();
+    }
+
+    CurrentTickStats.SimulatedObjects = static_cast<uint32_t>(SimulatedObjectCount);
+    CurrentTickStats.JobRequests = static_cast<uint32_t>(LastJobRequestCount);
+}
+
+void UPhysicsSystem::ExecutePhysicsJobs(const FPhysicsJobBuffer& Jobs)
+{
+    LastJobRequestCount = Jobs.GetCount();
+    LastJobTargetCount = 0;
+    if (Jobs.IsEmpty())
+        return;
+
+    // 대상 슬롯 -> 이번 Tick 합치기 위치, 사용 후 되돌려 두므로 Tick마다 초기화하지 않음
+    if (JobTargetSlots.size() < BodyStore.GetCapacity())
+    {
+        JobTargetSlots.resize(BodyStore.GetCapacity(), INVALID_JOB_SLOT);
+    }
+    JobTargets.clear();
+    CoalescedJobs.clear();
+
+    // 한 번만 순회 - 같은 대상 안에서는 항상 제출 순서이며, 같은 대상의 작업은 대상 슬롯에 합침
+    for (const FPhysicsJob& Job : Jobs)
+    {
+        // 제출 후 해제되었거나 다른 강체가 재사용 중인 슬롯은 무시
+        if (!BodyStore.IsValid(Job.TargetId, Job.TargetGeneration))
             continue;
+
+        uint32_t& Slot = JobTargetSlots[Job.TargetId];
+        if (Slot == INVALID_JOB_SLOT)
+        {
+            Slot = static_cast<uint32_t>(JobTargets.size());
+            JobTargets.push_back(Job.TargetId);
+            if (bCoalescePhysicsJobs)
+            {
+                CoalescedJobs.emplace_back(BodyStore.Positions[Job.TargetId]);
+            }
         }
-   
-        // 외부상태 현재 상태로 캡처
-        if (Object->IsActive() && (Object->IsDirtyPhysicsState()))
+
+        if (bCoalescePhysicsJobs)
+        {
+            // 누적형은 합산, 설정형은 마지막 값으로 합쳐 대상당 한 번 적용
+            CoalescedJobs[Slot].Fold(Job);
+        }
+        else
         {
-            Object->UpdateSimulatedStateFromCached();
+            FCoalescedPhysicsJob SingleJob(BodyStore.Positions[Job.TargetId]);
+            SingleJob.Fold(Job);
+            BodyStore.ApplyCoalescedJob(Job.TargetId, SingleJob);
         }
     }
 
-    // 작업 큐 차례대로 실행
-    for (auto& RequestedJob : JobQueue)
+    for (size_t i = 0; i < JobTargets.size(); ++i)
     {
-        if (!RequestedJob.IsValid())
-            continue;
-        RequestedJob.PhysicsJob->Execute(RequestedJob.TargetWeak.lock().get());
+        if (bCoalescePhysicsJobs)
+        {
+            BodyStore.ApplyCoalescedJob(JobTargets[i], CoalescedJobs[i]);
+        }
+        JobTargetSlots[JobTargets[i]] = INVALID_JOB_SLOT;
     }
-    //JobQeueu 클리어
-    JobQueue.Clear();
-    //JobPool 클리어
-    PhysicsJobPool.Reset();
+    LastJobTargetCount = JobTargets.size();
 }
 
 // 단일 서브스텝 시뮬레이션
@@ -175,13 +546,24 @@ bool UPhysicsSystem::SimulateSubstep(const float StepTime)
 		return true; // 더 이상 시뮬레이션 불필요
 
 	}
+    // 렌더링 보간 기준 - 마지막으로 진행한 단계의 시작 상태
+    BodyStore.SavePreviousTransforms();
+
     //가장 적은 시뮬시간
     float MinSimulatedTimeRatio = 1.0f;
     
     // 1. 충돌 
-    float CollideTimeRatio = GetCollisionSubsystem()->SimulateCollision(StepTime);
+    float CollideTimeRatio = SimulateCollisionStep(StepTime);
     MinSimulatedTimeRatio = std::min(MinSimulatedTimeRatio, CollideTimeRatio);
 
+    // 이른 충돌은 해당 섬만 나눠 진행 - 전체 단계는 충돌 시간과 무관하게 StepTime 전부 사용
+    if (bLocalSubstepping)
+    {
+        AccumulatedTime -= StepTime;
+        SimulateLocalSubsteps(StepTime);
+        return true;
+    }
+
     // 시뮬레이션 시간 업데이트
     // Tick 시간 클램핑 ( 로직 처리에 안정성을 주기위한 최소 틱시간 결정)
     float RemainingTime = StepTime;
@@ -190,15 +572,9 @@ bool UPhysicsSystem::SimulateSubstep(const float StepTime)
     RemainingTime -= SimualtedTime;
 
     // 물리 Tick
-    for (auto& PhysicsObject : RegisteredObjects)
+    if (SimualtedTime > KINDA_SMALL)
     {
-        //PhysicsTick 
-        auto PhysicsObjectPtr = PhysicsObject.lock();
-        if (PhysicsObjectPtr && SimualtedTime > KINDA_SMALL)
-        {
-            PhysicsObjectPtr->TickPhysics(SimualtedTime);
-        }
-       
+        IntegratePhysicsObjects(SimualtedTime);
     }
 
     if (RemainingTime < KINDA_SMALL)
@@ -215,27 +591,198 @@ bool UPhysicsSystem::SimulateSubstep(const float StepTime)
 }
 
 
+void UPhysicsSystem::SimulateLocalSubsteps(const float StepTime)
+{
+    FCollisionProcessor* Collision = GetCollisionSubsystem();
+    Collision->GetLocalSubstepBodies(LocalSubstepBodies);
+    if (LocalSubstepBodies.empty())
+    {
+        IntegratePhysicsObjects(StepTime);
+        return;
+    }
+
+    // 대상 강체는 전체 적분에서 제외
+    LocalRemainingTimes.assign(LocalSubstepBodies.size(), StepTime);
+    for (FPhysicsBodyId Id : LocalSubstepBodies)
+    {
+        BodyStore.SetFlag(Id, FPhysicsBodyStore::BODY_SUBSTEP, true);
+    }
+    CurrentTickStats.LocalSubstepBodies += static_cast<uint32_t>(LocalSubstepBodies.size());
+
+    IntegratePhysicsObjects(StepTime);
+
+    for (int LocalStep = 0; !LocalSubstepBodies.empty(); ++LocalStep)
+    {
+        // 마지막 단계는 남은 시간 전부 진행 - 서브스텝이 끝나면 모든 강체가 같은 시점에 있어야 함
+        const bool bLastStep = LocalStep + 1 >= std::max(MaxLocalSubSteps, 1);
+        {
+            FPhysicsPhaseTimer Timer(&CurrentTickStats, EPhysicsPhase::Integrate);
+            ++CurrentTickStats.LocalSubSteps;
+
+            size_t Write = 0;
+            for (size_t i = 0; i < LocalSubstepBodies.size(); ++i)
+            {
+                const FPhysicsBodyId Id = LocalSubstepBodies[i];
+                float Remaining = LocalRemainingTimes[i];
+
+                // 섬의 충돌 시점까지 진행 - 최소 틱시간으로 클램핑하여 진행을 보장
+                const float TimeRatio = Collision->GetBodyTimeOfImpact(Id);
+                const float LocalTime = bLastStep ? Remaining :
+                    std::min(Remaining, std::max(MinSubStepTickTime, StepTime * TimeRatio));
+
+                FPhysicsBatchIntegrator::IntegrateBody(BodyStore, Id, LocalTime);
+                Remaining -= LocalTime;
+
+                if (Remaining < KINDA_SMALL)
+                {
+                    BodyStore.SetFlag(Id, FPhysicsBodyStore::BODY_SUBSTEP, false);
+                    continue;
+                }
+                LocalSubstepBodies[Write] = Id;
+                LocalRemainingTimes[Write] = Remaining;
+                ++Write;
+            }
+            LocalSubstepBodies.resize(Write);
+            LocalRemainingTimes.resize(Write);
+        }
+
+        if (LocalSubstepBodies.empty())
+            break;
+
+        // 남은 강체가 속한 섬의 쌍만 다시 충돌 처리
+        Collision->SimulateLocalCollision(LocalSubstepBodies, StepTime, &CurrentTickStats);
+    }
+}
+
+void UPhysicsSystem::SimulateFixedStep(const float StepTime)
+{
+    BodyStore.SavePreviousTransforms();
+
+    // 충돌 시간 비율로 단계를 나누면 프레임마다 단계 길이가 달라지므로 무시
+    SimulateCollisionStep(StepTime);
+    IntegratePhysicsObjects(StepTime);
+}
+
+float UPhysicsSystem::SimulateCollisionStep(const float StepTime)
+{
+    return GetCollisionSubsystem()->SimulateCollision(StepTime, &CurrentTickStats);
+}
+
 // 시뮬레이션 완료 후 상태 적용
 void UPhysicsSystem::FinalizeSimulation()
 {
     bIsSimulating = false;
 
-    // 모든 물리 객체에 최종 상태 동기화
-    for (auto& ObjectWeak : RegisteredObjects)
     {
-        auto Object = ObjectWeak.lock();
-        if (!Object)
+        FPhysicsPhaseTimer Timer(&CurrentTickStats, EPhysicsPhase::Finalize);
+
+        // 모든 물리 객체에 최종 상태 동기화 - 시뮬레이션 도중 해제된 객체는 건너뜀
+        for (size_t i = 0; i < SimulatedObjectCount; ++i)
         {
-            LOG_FUNC_CALL("[Error] InValid PhysicsObejct");
-            continue;
+            IPhysicsObejct* Object = Registry.GetObjectAt(i);
+            if (Object && Object->IsActive())
+            {
+                //시뮬레이션 결과 외부에 반영
+                Object->SynchronizeCachedStateFromSimulated();
+            }
         }
+        SimulatedObjectCount = 0;
+        Registry.Unlock();
+    }
 
-        if (Object->IsActive())
+    LastTickStats = CurrentTickStats;
+    StatsHistory.Push(LastTickStats);
+
+    // 서브스텝 동안 모은 접촉 보고 - 결과가 컴포넌트에 반영된 뒤 게임 스레드에서 한 번 전달
+    GetCollisionSubsystem()->DispatchContactReports();
+}
+
+void UPhysicsSystem::IntegratePhysicsObjects(const float StepTime)
+{
+    FPhysicsPhaseTimer Timer(&CurrentTickStats, EPhysicsPhase::Integrate);
+    ++CurrentTickStats.SubSteps;
+
+    auto StartTime = std::chrono::high_resolution_clock::now();
+
+    if (bUseBatchIntegrator)
+    {
+        IntegrateBodyStore(StepTime);
+
+        auto EndTime = std::chrono::high_resolution_clock::now();
+        LastIntegrationTimeMs += std::chrono::duration<double, std::milli>(EndTime - StartTime).count();
+        return;
+    }
+
+    const size_t ObjectCount = SimulatedObjectCount;
+    auto IntegrateRange = [this, StepTime](size_t Begin, size_t End, size_t)
         {
-            //시뮬레이션 결과 외부에 반영
-            Object->SynchronizeCachedStateFromSimulated();
-        }
+            // 각 객체는 저장소의 자기 슬롯만 수정하므로 범위간 동기화 불필요
+            for (size_t i = Begin; i < End; ++i)
+            {
+                if (IPhysicsObejct* Object = Registry.GetObjectAt(i))
+                {
+                    Object->TickPhysics(StepTime);
+                }
+            }
+        };
+
+    if (!WorkerPool.ShouldRunParallel(ObjectCount, static_cast<size_t>(std::max(ParallelMinObjects, 1))))
+    {
+        IntegrateRange(0, ObjectCount, 0);
+    }
+    else
+    {
+        WorkerPool.ParallelFor(ObjectCount, CalculateChunkSize(ObjectCount), IntegrateRange);
     }
+
+    auto EndTime = std::chrono::high_resolution_clock::now();
+    LastIntegrationTimeMs += std::chrono::duration<double, std::milli>(EndTime - StartTime).count();
+}
+
+void UPhysicsSystem::IntegrateBodyStore(const float StepTime)
+{
+    // 활성/정적/수면 여부는 저장소 플래그로 판단하므로 슬롯 전체를 순회
+    const size_t SlotCount = BodyStore.GetCapacity();
+    const EPhysicsSimdLevel Level = GetSimdLevel();
+    auto IntegrateRange = [this, StepTime, Level](size_t Begin, size_t End, size_t)
+        {
+            FPhysicsBatchIntegrator::Integrate(BodyStore, Begin, End, StepTime, Level);
+        };
+
+    if (!WorkerPool.ShouldRunParallel(SlotCount, static_cast<size_t>(std::max(ParallelMinObjects, 1))))
+    {
+        IntegrateRange(0, SlotCount, 0);
+        return;
+    }
+
+    // 덩어리가 레인 폭의 배수가 되도록 올림 - 스칼라 나머지 처리는 범위 끝에서만 발생
+    constexpr size_t Alignment = FPhysicsBatchIntegrator::LANE_ALIGNMENT;
+    const size_t ChunkSize = (CalculateChunkSize(SlotCount) + Alignment - 1) / Alignment * Alignment;
+    WorkerPool.ParallelFor(SlotCount, ChunkSize, IntegrateRange);
+}
+
+void UPhysicsSystem::SetSimdLevel(const EPhysicsSimdLevel InLevel)
+{
+    PhysicsSimdLevel = static_cast<int>(InLevel);
+    GetCollisionSubsystem()->SetSimdLevel(GetSimdLevel());
+}
+
+EPhysicsSimdLevel UPhysicsSystem::GetSimdLevel() const
+{
+    const int Clamped = std::clamp(PhysicsSimdLevel, 0, static_cast<int>(EPhysicsSimdLevel::AVX2));
+    return static_cast<EPhysicsSimdLevel>(Clamped);
+}
+
+size_t UPhysicsSystem::CalculateChunkSize(const size_t Count) const
+{
+    // 결정론적 모드 - 스레드 수와 무관한 고정 분할
+    if (bDeterministicParallel || bStrictFixedStep)
+    {
+        return static_cast<size_t>(std::max(ParallelChunkSize, 1));
+    }
+    // 스레드별 균등 분할
+    const size_t ThreadCount = WorkerPool.GetThreadCount();
+    return (Count + ThreadCount - 1) / ThreadCount;
 }
 
 
@@ -244,6 +791,43 @@ void UPhysicsSystem::FinalizeSimulation()
 void UPhysicsSystem::PrintDebugInfo()
 {
 #ifdef _DEBUG
-    LOG("Current Active PhysicsObejct : [%03d]", RegisteredObjects.size());
+    LOG("Current Active PhysicsObejct : [%03zu]", Registry.GetCount());
+    LOG("Physics Threads : [%02zu] Integration : %.3f ms %s", WorkerPool.GetThreadCount(), LastIntegrationTimeMs,
+        bDeterministicParallel ? "(Deterministic)" : "");
+    LOG("Islands : [%03zu] Sleeping : [%03zu]", GetCollisionSubsystem()->GetIslandCount(),
+        GetCollisionSubsystem()->GetSleepingIslandCount());
+    LOG("Integrator : %s SIMD[%d]", bUseBatchIntegrator ? "Batch" : "PerObject", static_cast<int>(GetSimdLevel()));
+    LOG("Physics Thread : %s", bAsyncPhysics ? "Async" : "Inline");
+    LOG("Physics Jobs : [%04zu] -> Targets : [%04zu] %s", LastJobRequestCount, LastJobTargetCount,
+        bCoalescePhysicsJobs ? "(Coalesced)" : "");
+
+    const FPhysicsStatsSummary Summary = StatsHistory.Summarize();
+    if (Summary.TickCount > 0)
+    {
+        LOG("Physics Tick [%zu avg] : %.3f ms (max %.3f) SubSteps : %.1f (max %u)", Summary.TickCount,
+            Summary.AvgTotalTimeMs, Summary.MaxTotalTimeMs, Summary.AvgSubSteps, Summary.MaxSubSteps);
+        for (size_t i = 0; i < static_cast<size_t>(EPhysicsPhase::Count); ++i)
+        {
+            LOG("  %-18s : %.3f ms", FPhysicsTickStats::GetPhaseName(static_cast<EPhysicsPhase>(i)),
+                Summary.AvgPhaseTimeMs[i]);
+        }
+        LOG("Pairs : %.1f Contacts : %.1f Reinserts : %.1f SolverIterations : %.1f Unconverged : [%u]",
+            Summary.AvgBroadphasePairs, Summary.AvgNarrowphaseHits, Summary.AvgTreeReinserts,
+            Summary.AvgSolverIterations, Summary.TotalUnconvergedIslands);
+        LOG("Local Substep : %s Bodies : %.1f", bLocalSubstepping ? "On" : "Off", Summary.AvgLocalSubstepBodies);
+    }
 #endif
+}
+
+bool UPhysicsSystem::DumpStatsHistory(const std::string& InFilePath) const
+{
+    std::ofstream File(InFilePath);
+    if (!File.is_open())
+    {
+        LOG_FUNC_CALL("[Error] Cannot open %s", InFilePath.c_str());
+        return false;
+    }
+
+    StatsHistory.WriteCsv(File);
+    return File.good();
 }
\ No newline at end of file
@@ -5,8 +5,17 @@
 #include <memory>
 #include "CollisionProcessor.h"
 #include "PhysicsJob.h"
-#include "ArenaMemoryPool.h"
-#include "DynamicCircularQueue.h"
+#include "PhysicsJobQueue.h"
+#include "PhysicsWorkerPool.h"
+#include "PhysicsBodyStore.h"
+#include "PhysicsBatchIntegrator.h"
+#include "PhysicsSnapshot.h"
+#include "PhysicsStats.h"
+#include "PhysicsObjectRegistry.h"
+#include <string>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
 #include <type_traits>
 #include "Debug.h"
 
@@ -23,55 +32,35 @@ private:
     UPhysicsSystem& operator=(UPhysicsSystem&&) = delete;
 
 private:
-    struct alignas(16) FPhysicsJobRequest
-    {
-        std::weak_ptr<IPhysicsStateInternal> TargetWeak = std::weak_ptr<IPhysicsStateInternal>();
-        FPhysicsJob* PhysicsJob = nullptr;
-
-        bool IsValid() const
-        {
-            return !TargetWeak.expired() && PhysicsJob != nullptr;
-        }
-    };
-    //물리 작업 풀
-    FArenaMemoryPool PhysicsJobPool;
-
-    //물리 잡업 큐
-    TCircularQueue<FPhysicsJobRequest> JobQueue;
+    //물리 작업 큐 - 제출 스레드별 작업 아레나 사용
+    FPhysicsJobQueue JobQueue;
 
 public:
-    template<typename T, typename ...Args,
-        typename = std::enable_if_t<
-        std::conjunction_v<
-            std::is_base_of<FPhysicsJob, T>,
-            std::is_constructible<T, Args...>>
-            >
-        >
-        FPhysicsJobRequest AcquireJob(const std::shared_ptr<IPhysicsStateInternal>& Target, Args ...args)
-    {
-        FPhysicsJobRequest newJobRequest;
-        if (!Target)
-        {
-            return newJobRequest;
-        }
-
-        newJobRequest.PhysicsJob = PhysicsJobPool.Allocate<T>(std::forward<Args>(args)...);
-        if (!newJobRequest.PhysicsJob)
-        {
-            LOG_FUNC_CALL("[Eror] Too Many Physics Job Requested! Pool is Full");
-            return newJobRequest;
-        }
-        newJobRequest.TargetWeak = Target;
-
-        return newJobRequest;
-    }
+    /// <summary>
+    /// 물리 작업 요청 - 어느 스레드에서나 잠금 없이 호출 가능
+    /// 요청은 다음 PrepareSimulation에서 대상별 제출 순서대로 실행됨
+    /// 제출 시점의 대상 슬롯 세대를 기록하여, 실행 전에 해제/재사용된 강체로 향한 요청은 폐기
+    /// </summary>
+    bool RequestPhysicsJob(const FPhysicsJob& InJob);
+    // 연속된 작업 배열 일괄 요청
+    bool RequestPhysicsJobs(const FPhysicsJob* InJobs, size_t InCount);
 
-    void RequestPhysicsJob(const FPhysicsJobRequest& RequestedJob);
+    // 제출 스레드별 작업 버퍼 용량 (작업 수) - 변경 시 실행 전인 작업은 폐기됨
+    void SetPhysicsJobCapacity(size_t InJobCapacity);
+    size_t GetPhysicsJobCapacity() const { return JobQueue.GetJobCapacity(); }
 
 private:
-    // 등록된 물리 객체들
-    std::vector<std::weak_ptr<IPhysicsObejct>> RegisteredObjects;
-   
+    // 등록된 물리 객체들 - Prepare에서 저장소 순서(BodyId)로 정렬하여 적분/동기화가 저장소를 선형으로 순회하도록 함
+    // Prepare부터 Finalize까지 잠가 두고, 그 사이 해제된 객체는 nullptr로 표시됨
+    FPhysicsObjectRegistry Registry;
+    // 이번 Tick 동안 시뮬레이션할 객체 수 - 등록부 밀집 배열의 앞부분, 이후 등록분은 다음 Tick부터
+    size_t SimulatedObjectCount = 0;
+
+    // 강체 시뮬레이션 상태 SoA 저장소
+    FPhysicsBodyStore BodyStore;
+
+    //병렬 적분 작업자 풀
+    FPhysicsWorkerPool WorkerPool;
 
 public:
     static UPhysicsSystem* Get()
@@ -95,12 +84,121 @@ public:
         return instance;
     }
 
-    // 물리 객체 등록/해제
-    void RegisterPhysicsObject(std::shared_ptr<IPhysicsObejct>& Object);
-    void UnregisterPhysicsObject(std::shared_ptr<IPhysicsObejct>& Object);
+    FPhysicsBodyStore* GetBodyStore() { return &BodyStore; }
+
+    // 물리 객체 등록/해제 - O(1), 객체는 소멸 전에 반드시 해제해야 함
+    FPhysicsObjectHandle RegisterPhysicsObject(IPhysicsObejct* InObject);
+    void UnregisterPhysicsObject(const FPhysicsObjectHandle& InHandle);
+    bool IsRegisteredPhysicsObject(const FPhysicsObjectHandle& InHandle) const { return Registry.IsValid(InHandle); }
 
     // 메인 물리 업데이트 (게임 루프에서 호출)
     void TickPhysics(const float DeltaTime);
+
+    /// <summary>
+    /// 비동기 물리 Tick 시작 - 준비(컴포넌트 상태 캡처, 작업 실행)는 호출 스레드에서 하고 서브스텝은 물리 스레드에서 진행
+    /// WaitAsyncTick까지는 물리 결과를 읽지 않아야 함, 강체/충돌체의 등록/해제와 설정 변경은 WaitAsyncWork로 서브스텝 완료를 기다림
+    /// 그 사이 요청한 물리 작업은 다음 Tick에 실행됨
+    /// 비동기 모드가 아니면 아무것도 하지 않고 false 반환
+    /// </summary>
+    bool BeginAsyncTick(const float DeltaTime);
+
+    // 동기화 지점 - 진행 중인 비동기 Tick을 기다린 뒤 결과를 컴포넌트에 반영하고 모아둔 충돌 이벤트 전달
+    void WaitAsyncTick();
+    /// <summary>
+    /// 물리 스레드의 서브스텝 완료만 기다림 - 결과 반영과 이벤트 전달은 다음 WaitAsyncTick에서 함
+    /// 게임 스레드가 저장소/등록부/충돌 트리를 직접 바꾸기 전에 호출 (강체/충돌체 설정, 활성화, 소멸)
+    /// 그 사이 해제된 객체는 결과 반영에서 건너뜀, 물리 스레드와 작업자에서는 호출하지 않아야 함
+    /// </summary>
+    void WaitAsyncWork();
+
+    // 마지막 Tick의 접촉 보고 - 기록 순서대로 Enter/Stay/Exit 전이, 연속된 Stay는 하나로 합쳐짐
+    // 다음 Tick 시작 전까지 유효, 비동기 Tick 진행 중에는 읽지 않아야 함
+    const std::vector<FCollisionContactReport>& GetContactReports() const { return GetCollisionSubsystem()->GetContactReports(); }
+
+    //비동기 물리 모드 - 물리 스레드 생성/종료
+    void SetAsyncPhysics(const bool InBool);
+    bool IsAsyncPhysics() const { return bAsyncPhysics; }
+    //비동기 Tick 진행 중 여부 - 진행 중에는 저장소를 읽지 않고 마지막으로 반영된 컴포넌트 상태를 사용
+    bool IsAsyncTickInFlight() const { return bAsyncTickInFlight; }
+
+    /// <summary>
+    /// 정확히 NumSteps번의 고정 단계 진행 - 프레임 시간과 무관
+    /// 같은 상태와 같은 작업 입력이면 같은 결과를 내므로 롤백 후 재시뮬레이션에 사용
+    /// </summary>
+    void StepFixed(const int NumSteps);
+
+    //고정 단계 모드 - 단계마다 FixedTimeStep만큼만 적분하고 충돌쌍/병렬 분할 순서를 고정
+    void SetStrictFixedStep(const bool InBool);
+    bool IsStrictFixedStep() const { return bStrictFixedStep; }
+
+    //지역 서브스텝 모드 - 이른 충돌 섬만 충돌 시점까지 나눠 진행하고 나머지는 단계 전체 적분
+    //끄면 가장 이른 충돌 시간으로 모든 강체의 단계를 줄임, 고정 단계 모드에서는 사용하지 않음
+    void SetLocalSubstepping(const bool InBool);
+    bool IsLocalSubstepping() const { return bLocalSubstepping; }
+
+    //고정 단계 모드에서 진행한 누적 단계 수
+    uint64_t GetSimulationStep() const { return SimulationStep; }
+
+    //렌더링 트랜스폼 보간 사용 여부 - 끄면 마지막 시뮬레이션 결과를 그대로 렌더링
+    void SetInterpolateRenderTransform(const bool InBool) { bInterpolateRenderTransform = InBool; }
+    bool IsInterpolateRenderTransform() const { return bInterpolateRenderTransform; }
+
+    //직전 단계와 현재 단계 사이 보간 비율 [0, 1] - 고정 단계 모드에서 남은 누적 시간 기준
+    float GetInterpolationAlpha() const;
+
+    /// <summary>
+    /// 현재 물리 상태를 스냅샷 버퍼에 복사 - 시뮬레이션 중에는 실패
+    /// 같은 스냅샷 객체를 재사용하면 버퍼를 다시 할당하지 않음
+    /// </summary>
+    bool CaptureSnapshot(FPhysicsSnapshot& OutSnapshot) const;
+
+    /// <summary>
+    /// 스냅샷 상태로 되돌림 - 캡처 이후 강체/충돌체 등록이 바뀌었으면 실패
+    /// 복원된 상태는 다음 Tick 시작 시 컴포넌트에 반영되며, 그 사이 컴포넌트에 직접 설정한 값은 무시됨
+    /// </summary>
+    bool RestoreSnapshot(const FPhysicsSnapshot& InSnapshot);
+
+    /// <summary>
+    /// 등록된 물리 객체가 없을 때 저장소/충돌/시간 누적 상태를 초기화 직후로 되돌림 - 설정값은 유지
+    /// 같은 프로세스에서 장면을 다시 구성해도 슬롯/노드 배정이 같아 같은 결과를 냄, 실행 전인 작업은 폐기
+    /// </summary>
+    bool ResetSimulation();
+
+    // 호출 스레드를 포함한 물리 작업 스레드 수 변경 (1 = 단일 스레드)
+    void SetWorkerThreadCount(size_t InThreadCount);
+    size_t GetWorkerThreadCount() const { return WorkerPool.GetThreadCount(); }
+
+    //덩어리 크기를 스레드 수와 무관하게 고정 - 스레드 수가 달라도 같은 결과 보장
+    void SetDeterministicParallel(const bool InBool) { bDeterministicParallel = InBool; }
+    bool IsDeterministicParallel() const { return bDeterministicParallel; }
+
+    //대상별 작업 합치기 사용 여부 - 끄면 대상 안에서 작업마다 따로 적용
+    void SetCoalescePhysicsJobs(const bool InBool) { bCoalescePhysicsJobs = InBool; }
+    bool IsCoalescePhysicsJobs() const { return bCoalescePhysicsJobs; }
+
+    //작업을 대상 순으로 정렬한 뒤 실행 - 끄면 제출 순서대로 한 번 순회, 결과는 같음
+    void SetSortPhysicsJobs(const bool InBool) { bSortPhysicsJobs = InBool; }
+    bool IsSortPhysicsJobs() const { return bSortPhysicsJobs; }
+
+    //저장소 일괄 적분 사용 여부 - 끄면 객체별 TickPhysics 경로 사용
+    void SetUseBatchIntegrator(const bool InBool) { bUseBatchIntegrator = InBool; }
+    bool IsUseBatchIntegrator() const { return bUseBatchIntegrator; }
+
+    //일괄 적분기/접촉 해결기 SIMD 수준 - CPU 지원 수준을 넘으면 지원 수준으로 낮춰 실행
+    void SetSimdLevel(const EPhysicsSimdLevel InLevel);
+    EPhysicsSimdLevel GetSimdLevel() const;
+
+    //마지막 Tick의 적분 단계 소요시간 (ms)
+    double GetLastIntegrationTimeMs() const { return LastIntegrationTimeMs; }
+
+    //마지막 Tick의 구간별 소요시간과 처리량
+    const FPhysicsTickStats& GetLastTickStats() const { return LastTickStats; }
+    //최근 Tick 통계 기록 (고정 크기 원형 버퍼)
+    const FPhysicsStatsHistory& GetStatsHistory() const { return StatsHistory; }
+    FPhysicsStatsSummary GetStatsSummary() const { return StatsHistory.Summarize(); }
+    void ClearStatsHistory() { StatsHistory.Clear(); }
+    //통계 기록을 CSV 파일로 저장
+    bool DumpStatsHistory(const std::string& InFilePath) const;
 #pragma region Debug
     void PrintDebugInfo();
 #pragma endregion
@@ -115,26 +213,126 @@ private:
     // 필요한 서브스텝 수 계산
     int CalculateRequiredSubsteps();
 
+    // 시간 누적 및 준비 - 진행할 단계가 없으면 false
+    bool BeginSimulation(const float DeltaTime);
+
+    // 준비된 Tick의 단계 진행 - 컴포넌트 상태를 바꾸지 않으므로 물리 스레드에서 실행 가능
+    void RunSimulation();
+
+    // 물리 스레드 - 요청마다 RunSimulation 실행
+    void AsyncThreadLoop();
+    void StopAsyncThread();
+
     // 시뮬레이션 시작 전 준비
     void PrepareSimulation();
 
     // 단일 서브스텝 시뮬레이션
     bool SimulateSubstep(const float TimeStep);
 
+    // 고정 단계 하나 - 충돌 시간 비율과 무관하게 StepTime 전체 적분
+    void SimulateFixedStep(const float StepTime);
+
+    // 충돌 하부시스템 실행 및 처리량 집계 - 정규화된 충돌 시간 반환
+    float SimulateCollisionStep(const float StepTime);
+
+    // 전체는 StepTime만큼 적분하고, 이른 충돌 섬의 강체만 충돌 시점 단위로 나눠 StepTime까지 따라잡음
+    void SimulateLocalSubsteps(const float StepTime);
+
+    // 충돌 하부시스템에 지역 서브스텝 설정 전달 - 고정 단계 모드에서는 끔
+    void UpdateCollisionSubstepMode();
+
     // 시뮬레이션 완료 후 최종 상태 적용
     void FinalizeSimulation();
 
+    // 등록 객체 물리 적분 - 작업자 스레드에 분할
+    void IntegratePhysicsObjects(const float StepTime);
+
+    // 병렬 실행 덩어리 크기 계산
+    size_t CalculateChunkSize(const size_t Count) const;
+
+    // 저장소 슬롯 범위 일괄 적분 - 덩어리 경계를 SIMD 레인 폭에 정렬
+    void IntegrateBodyStore(const float StepTime);
+
+    // 수집된 작업 실행 - 대상별로 묶어 합친 뒤 대상당 한 번 적용
+    void ExecutePhysicsJobs(const FPhysicsJobBuffer& Jobs);
+
+    static constexpr uint32_t INVALID_JOB_SLOT = static_cast<uint32_t>(-1);
+    // 작업 실행용 - 대상 슬롯별 합치기 위치(저장소 크기), 이번 Tick 대상 목록과 합친 작업
+    std::vector<uint32_t> JobTargetSlots;
+    std::vector<FPhysicsBodyId> JobTargets;
+    std::vector<FCoalescedPhysicsJob> CoalescedJobs;
+
 private:
     // 물리 시뮬레이션 설정
     int InitialPhysicsObjectCapacity = 512; //최초 관리 객체 메모리 크기
-    int InitialPhysicsJobPoolSizeMB = 4; // 최초 물리 작업 풀 크기
+    int InitialPhysicsJobPoolSizeMB = 4; // 제출 스레드별 물리 작업 아레나 크기
     float FixedTimeStep = 0.016f;  // 60Hz
     float MinSubStepTickTime = 0.004f; // 15Hz
     int MaxSubSteps = 5;                 // 최대 서브스텝 수
     int MinSubSteps = 3;                 // 최소 서브스텝 수 - 연속적인 충돌을 처리하기 위함
 
+    // 병렬 처리 설정
+    int PhysicsWorkerThreads = 1;        // 호출 스레드 포함 물리 스레드 수, 음수면 하드웨어 스레드 수 사용
+    int ParallelChunkSize = 64;          // 결정론적 모드의 고정 덩어리 크기
+    int ParallelMinObjects = 256;        // 스레드당 최소 적분 객체 수 - 못 미치면 단일 스레드로 적분
+    bool bDeterministicParallel = true;  // 스레드 수와 무관한 분할 사용 여부
+
+    // 적분 설정
+    bool bUseBatchIntegrator = true;     // 저장소 일괄 적분 사용 여부
+    int PhysicsSimdLevel = 2;            // 0 = Scalar, 1 = SSE, 2 = AVX2
+
+    // 작업 실행 설정
+    bool bCoalescePhysicsJobs = true;    // 대상별 작업 합치기 사용 여부
+    bool bSortPhysicsJobs = false;       // 실행 전 대상 순 정렬 여부
+
+    // 결정론 설정
+    bool bStrictFixedStep = false;       // 고정 단계 모드 사용 여부
+
+    // 지역 서브스텝 설정
+    bool bLocalSubstepping = false;      // 이른 충돌 섬만 서브스텝 진행
+    int MaxLocalSubSteps = 8;            // 섬별 최대 지역 서브스텝 수 - 마지막 단계에서 남은 시간 전부 진행
+
+    // 렌더링 설정
+    bool bInterpolateRenderTransform = true; // 렌더링 트랜스폼 보간 사용 여부
+
+    // 비동기 물리 설정
+    bool bAsyncPhysics = false;          // 물리 스레드에서 서브스텝 진행 여부
+
+    // 통계
+    int PhysicsStatsHistorySize = 240;   // 보관할 최근 Tick 통계 수
+
+    double LastIntegrationTimeMs = 0.0;
+    size_t LastJobRequestCount = 0;
+    size_t LastJobTargetCount = 0;
+
+    // 구간별 통계 - 진행 중인 Tick / 마지막으로 완료된 Tick
+    FPhysicsTickStats CurrentTickStats;
+    FPhysicsTickStats LastTickStats;
+    FPhysicsStatsHistory StatsHistory;
+    uint64_t TickCount = 0;
+
+    // 지역 서브스텝 대상 강체와 남은 진행 시간 - 같은 위치끼리 대응
+    std::vector<FPhysicsBodyId> LocalSubstepBodies;
+    std::vector<float> LocalRemainingTimes;
+
+    // 비동기 물리 - 요청/완료 플래그는 AsyncMutex 보호, 진행 중 여부는 메인 스레드만 사용
+    std::thread AsyncThread;
+    std::mutex AsyncMutex;
+    std::condition_variable AsyncCondition;
+    std::condition_variable AsyncDoneCondition;
+    bool bAsyncRequested = false;
+    bool bAsyncExit = false;
+    bool bAsyncTickInFlight = false;
+
+    // 고정 단계 모드에서 이번 Tick에 진행할 단계 수
+    int PendingFixedSteps = 0;
+
     //누적 tickTime 상태값
     float AccumulatedTime = 0.0f;
+    uint64_t SimulationStep = 0;
+
+    // 스냅샷 복원 직후 - 다음 준비 단계에서 컴포넌트 상태 대신 저장소 상태를 기준으로 삼음
+    bool bRestoredFromSnapshot = false;
 
     // 시뮬레이션 상태
     bool bIsSimulating = false;
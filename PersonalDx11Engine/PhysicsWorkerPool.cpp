@@ -0,0 +1,116 @@
+#include "PhysicsWorkerPool.h"
+#include <algorithm>
+
+FPhysicsWorkerPool::~FPhysicsWorkerPool()
+{
+    Release();
+}
+
+void FPhysicsWorkerPool::Initialize(size_t InWorkerCount)
+{
+    Release();
+
+    bStop = false;
+    Generation = 0;
+    Workers.reserve(InWorkerCount);
+    for (size_t i = 0; i < InWorkerCount; ++i)
+    {
+        Workers.emplace_back(&FPhysicsWorkerPool::WorkerLoop, this);
+    }
+}
+
+void FPhysicsWorkerPool::Release()
+{
+    {
+        std::lock_guard<std::mutex> Lock(Mutex);
+        bStop = true;
+    }
+    WakeCondition.notify_all();
+
+    for (auto& Worker : Workers)
+    {
+        if (Worker.joinable())
+            Worker.join();
+    }
+    Workers.clear();
+}
+
+void FPhysicsWorkerPool::ParallelFor(size_t Count, size_t ChunkSize, const FRangeTask& Task)
+{
+    if (Count == 0)
+        return;
+
+    ChunkSize = std::max<size_t>(1, ChunkSize);
+    const size_t ChunkCount = GetChunkCount(Count, ChunkSize);
+
+    // 작업자가 없거나 덩어리가 하나뿐이면 호출 스레드에서 바로 처리
+    if (Workers.empty() || ChunkCount == 1)
+    {
+        for (size_t Chunk = 0; Chunk < ChunkCount; ++Chunk)
+        {
+            const size_t Begin = Chunk * ChunkSize;
+            Task(Begin, std::min(Begin + ChunkSize, Count), Chunk);
+        }
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> Lock(Mutex);
+        CurrentTask = &Task;
+        TaskCount = Count;
+        TaskChunkSize = ChunkSize;
+        TaskChunkCount = ChunkCount;
+        NextChunk.store(0, std::memory_order_relaxed);
+        PendingWorkers = Workers.size();
+        ++Generation;
+    }
+    WakeCondition.notify_all();
+
+    // 호출 스레드도 작업 참여
+    RunChunks();
+
+    std::unique_lock<std::mutex> Lock(Mutex);
+    DoneCondition.wait(Lock, [this]() { return PendingWorkers == 0; });
+    CurrentTask = nullptr;
+}
+
+void FPhysicsWorkerPool::WorkerLoop()
+{
+    uint64_t SeenGeneration = 0;
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> Lock(Mutex);
+            WakeCondition.wait(Lock, [this, SeenGeneration]() {
+                return bStop || Generation != SeenGeneration;
+                               });
+            if (bStop)
+                return;
+            SeenGeneration = Generation;
+        }
+
+        RunChunks();
+
+        {
+            std::lock_guard<std::mutex> Lock(Mutex);
+            if (--PendingWorkers == 0)
+            {
+                DoneCondition.notify_one();
+            }
+        }
+    }
+}
+
+void FPhysicsWorkerPool::RunChunks()
+{
+    // 남은 덩어리를 원자적으로 가져가며 처리
+    size_t Chunk = NextChunk.fetch_add(1, std::memory_order_relaxed);
+    while (Chunk < TaskChunkCount)
+    {
+        const size_t Begin = Chunk * TaskChunkSize;
+        const size_t End = std::min(Begin + TaskChunkSize, TaskCount);
+        (*CurrentTask)(Begin, End, Chunk);
+
+        Chunk = NextChunk.fetch_add(1, std::memory_order_relaxed);
+    }
+}
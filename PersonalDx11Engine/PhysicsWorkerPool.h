@@ -0,0 +1,74 @@
+#pragma once
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <functional>
+
+/// <summary>
+/// 물리 연산 병렬 처리를 위한 고정 크기 작업자 스레드 풀
+/// ParallelFor를 호출한 스레드도 작업에 참여하며, 모든 덩어리(Chunk)가 끝날 때까지 반환하지 않음
+/// </summary>
+class FPhysicsWorkerPool
+{
+public:
+    // [Begin, End) 범위, 덩어리 인덱스
+    using FRangeTask = std::function<void(size_t Begin, size_t End, size_t ChunkIndex)>;
+
+public:
+    FPhysicsWorkerPool() = default;
+    ~FPhysicsWorkerPool();
+
+    // 복사 및 이동 방지
+    FPhysicsWorkerPool(const FPhysicsWorkerPool&) = delete;
+    FPhysicsWorkerPool& operator=(const FPhysicsWorkerPool&) = delete;
+    FPhysicsWorkerPool(FPhysicsWorkerPool&&) = delete;
+    FPhysicsWorkerPool& operator=(FPhysicsWorkerPool&&) = delete;
+
+    // 호출 스레드를 제외한 작업자 수로 초기화 (0이면 단일 스레드 실행)
+    void Initialize(size_t InWorkerCount);
+    void Release();
+
+    // 호출 스레드를 포함한 전체 실행 스레드 수
+    size_t GetThreadCount() const { return Workers.size() + 1; }
+
+    // 스레드마다 InMinCountPerThread개 이상 돌아갈 때만 병렬 실행 - 적으면 깨우기/대기 비용이 나눠 얻는 시간보다 큼
+    bool ShouldRunParallel(size_t Count, size_t InMinCountPerThread) const
+    {
+        return !Workers.empty() && Count >= (InMinCountPerThread > 0 ? InMinCountPerThread : 1) * GetThreadCount();
+    }
+
+    /// <summary>
+    /// Count개의 원소를 ChunkSize 단위로 잘라 병렬 실행
+    /// 덩어리 경계는 스레드 수와 무관하므로, 덩어리 단위로 기록한 결과는 스레드 수에 관계없이 동일함
+    /// </summary>
+    void ParallelFor(size_t Count, size_t ChunkSize, const FRangeTask& Task);
+
+    static size_t GetChunkCount(size_t Count, size_t ChunkSize)
+    {
+        return ChunkSize == 0 ? 0 : (Count + ChunkSize - 1) / ChunkSize;
+    }
+
+private:
+    void WorkerLoop();
+    void RunChunks();
+
+private:
+    std::vector<std::thread> Workers;
+
+    std::mutex Mutex;
+    std::condition_variable WakeCondition;
+    std::condition_variable DoneCondition;
+
+    // 현재 실행중인 작업 정보 - Mutex 보호 하에 기록, 작업자는 깨어난 뒤 읽기만 함
+    const FRangeTask* CurrentTask = nullptr;
+    size_t TaskCount = 0;
+    size_t TaskChunkSize = 0;
+    size_t TaskChunkCount = 0;
+    std::atomic<size_t> NextChunk{ 0 };
+
+    uint64_t Generation = 0;      // 작업 요청 세대, 작업자는 세대가 바뀌면 깨어남
+    size_t PendingWorkers = 0;    // 현재 세대를 끝내지 못한 작업자 수
+    bool bStop = false;
+};
@@ -64,7 +64,8 @@ bool UPrimitiveComponent::FillRenderData(const UCamera* Camera, IRenderData* Out
         if (info.Name == "MATRIX_BUFFER")
         {
             //매트릭스 버퍼
-            auto WorldMatrix = GetWorldTransform().GetModelingMatrix();
+            //물리 보간이 반영된 렌더링 트랜스폼
+            auto WorldMatrix = GetRenderWorldTransform().GetModelingMatrix();
             auto WorldInverse = XMMatrixInverse(nullptr, WorldMatrix);
             auto ViewMatrix = Camera->GetViewMatrix();
             auto ProjectionMatrix = Camera->GetProjectionMatrix();
@@ -4,17 +4,35 @@
 #include "Debug.h"
 #include "PhysicsDefine.h"
 #include "PhysicsSystem.h"
+#include "CollisionComponent.h"
+#include "CollisionProcessor.h"
 #include "TypeCast.h"
+#include <cfloat>
 
 #include "PrimitiveComponent.h"
 
 URigidBodyComponent::URigidBodyComponent()
 {
    bPhysicsSimulated = true;
+
+   //물리 상태 저장소 슬롯 할당 - 슬롯 추가는 배열을 다시 할당할 수 있음
+   UPhysicsSystem::Get()->WaitAsyncWork();
+   BodyStore = UPhysicsSystem::Get()->GetBodyStore();
+   BodyId = BodyStore->Allocate();
+   WriteSimulatedState(CachedState);
+   WriteIntegrationSettings();
 }
 
 URigidBodyComponent::~URigidBodyComponent()
 {
+	// 소멸 시 명시적으로 등록 해제 - 물리 시스템은 원시 포인터만 보관
+	// 비동기 Tick 진행 중이면 서브스텝이 끝난 뒤 해제, 해제된 객체는 결과 반영에서 건너뜀
+	UPhysicsSystem::Get()->WaitAsyncWork();
+	UnRegisterPhysicsSystem();
+	if (BodyStore)
+	{
+		BodyStore->Free(BodyId);
+	}
 }
 
 void URigidBodyComponent::PostInitialized()
@@ -22,26 +40,34 @@ void URigidBodyComponent::PostInitialized()
 	USceneComponent::PostInitialized();
 
 	//초기 상태 저장
+	UPhysicsSystem::Get()->WaitAsyncWork();
 	CachedState.WorldTransform = GetWorldTransform();
-	SimulatedState = CachedState;
+	WriteSimulatedState(CachedState);
 }
 
 void URigidBodyComponent::Activate()
 {
 	USceneComponent::Activate();
+	UPhysicsSystem::Get()->WaitAsyncWork();
+	BodyStore->SetFlag(BodyId, FPhysicsBodyStore::BODY_ACTIVE, true);
 	RegisterPhysicsSystem();
+	RefreshBoundCollisions();
 }
 
 void URigidBodyComponent::DeActivate()
 {
 	USceneComponent::DeActivate();
+	UPhysicsSystem::Get()->WaitAsyncWork();
+	BodyStore->SetFlag(BodyId, FPhysicsBodyStore::BODY_ACTIVE, false);
 	UnRegisterPhysicsSystem();
+	RefreshBoundCollisions();
 }
 
 void URigidBodyComponent::Reset()
 {
+	UPhysicsSystem::Get()->WaitAsyncWork();
 	CachedState = FRigidPhysicsState();
-	SimulatedState = CachedState;
+	WriteSimulatedState(CachedState);
 }	
 
 void URigidBodyComponent::Tick(const float DeltaTime)
@@ -64,12 +90,12 @@ bool URigidBodyComponent::ShouldSleep() const
 #pragma region Helper For Numerical Stability
 bool URigidBodyComponent::IsValidForce(const Vector3& InForce)
 {
-	return InForce.LengthSquared() > 100.0f;
+	return InForce.LengthSquared() > MIN_VALID_FORCE_SQUARED;
 }
 
 bool URigidBodyComponent::IsValidTorque(const Vector3& InTorque)
 {
-	return InTorque.LengthSquared() > 100.0f;
+	return InTorque.LengthSquared() > MIN_VALID_TORQUE_SQUARED;
 }
 
 bool URigidBodyComponent::IsValidVelocity(const Vector3& InVelocity)
@@ -98,24 +124,24 @@ void URigidBodyComponent::P_UpdateTransformByVelocity(const float DeltaTime)
 	{
 		return;
 	}
-	FTransform TargetTransform = SimulatedState.WorldTransform;
+	FTransform TargetTransform = BodyStore->GetWorldTransform(BodyId);
 
 	bool bNeedUpdate = false;
 
-	if (IsValidVelocity(SimulatedState.Velocity))
+	if (IsValidVelocity(BodyStore->Velocities[BodyId]))
 	{
 		bNeedUpdate = true;
 		// 위치 업데이트
-		Vector3 NewPosition = TargetTransform.Position + SimulatedState.Velocity * DeltaTime;
+		Vector3 NewPosition = TargetTransform.Position + BodyStore->Velocities[BodyId] * DeltaTime;
 		TargetTransform.Position = NewPosition;
 	}
 
-	if (IsValidAngularVelocity(SimulatedState.AngularVelocity))
+	if (IsValidAngularVelocity(BodyStore->AngularVelocities[BodyId]))
 	{
 		bNeedUpdate = true;
 		// 회전 업데이트
 		Matrix WorldRotation = TargetTransform.GetRotationMatrix();
-		XMVECTOR WorldAngularVel = XMLoadFloat3(&SimulatedState.AngularVelocity);
+		XMVECTOR WorldAngularVel = XMLoadFloat3(&BodyStore->AngularVelocities[BodyId]);
 		float AngularSpeed = XMVectorGetX(XMVector3Length(WorldAngularVel));
 		if (AngularSpeed > KINDA_SMALL)
 		{
@@ -170,13 +196,15 @@ void URigidBodyComponent::P_SetWorldTransform(const FTransform& InTransfrom)
 	}
 
 	bool bIsUpate = false;
-	bIsUpate = FTransform::IsValidScale(SimulatedState.WorldTransform.Scale - InTransfrom.Scale) ||
-		FTransform::IsValidRotation(SimulatedState.WorldTransform.Rotation, InTransfrom.Rotation) ||
-		FTransform::IsValidPosition(SimulatedState.WorldTransform.Position - InTransfrom.Position);
+	bIsUpate = FTransform::IsValidScale(BodyStore->Scales[BodyId] - InTransfrom.Scale) ||
+		FTransform::IsValidRotation(BodyStore->Rotations[BodyId], InTransfrom.Rotation) ||
+		FTransform::IsValidPosition(BodyStore->Positions[BodyId] - InTransfrom.Position);
 
 	if (bIsUpate)
 	{
-		SimulatedState.WorldTransform = InTransfrom;
+		BodyStore->SetWorldTransform(BodyId, InTransfrom);
+		if (IsSleep())
+			Awake();
 	}
 
 }
@@ -186,11 +214,15 @@ void URigidBodyComponent::P_ApplyForce(const Vector3& Force, const Vector3& Loca
 	if (!IsActive() || IsStatic() || !IsValidForce(Force))
 		return;
 
-	SimulatedState.AccumulatedForce += Force;
+	//외부 작용은 수면 중인 강체를 깨움
+	if (IsSleep())
+		Awake();
+
+	BodyStore->AccumulatedForces[BodyId] += Force;
 	Vector3 Torque = Vector3::Cross(Location - GetCenterOfMass(), Force);
 	if (IsValidTorque(Torque))
 	{
-		SimulatedState.AccumulatedTorque += Torque;
+		BodyStore->AccumulatedTorques[BodyId] += Torque;
 	}
 }
 
@@ -198,50 +230,70 @@ void URigidBodyComponent::P_ApplyImpulse(const Vector3& Impulse, const Vector3&
 {
 	if (!IsActive() || IsStatic() || !IsValidForce(Impulse))
 		return;
+
+	//외부 작용은 수면 중인 강체를 깨움
+	if (IsSleep())
+		Awake();
 	// 저장된 충격량 처리 (순간적인 속도 변화)
-	SimulatedState.Velocity += Impulse  * SimulatedState.InvMass;
+	BodyStore->Velocities[BodyId] += Impulse  * BodyStore->InvMasses[BodyId];
 
 	Vector3 AngularImpulse = Vector3::Cross(Location - GetCenterOfMass(), Impulse);
 	if (IsValidTorque(AngularImpulse))
 	{
-		SimulatedState.AngularVelocity += Vector3(
-			AngularImpulse.x * SimulatedState.InvRotationalInertia.x,
-			AngularImpulse.y * SimulatedState.InvRotationalInertia.y,
-			AngularImpulse.z * SimulatedState.InvRotationalInertia.z);
+		BodyStore->AngularVelocities[BodyId] += Vector3(
+			AngularImpulse.x * BodyStore->InvRotationalInertias[BodyId].x,
+			AngularImpulse.y * BodyStore->InvRotationalInertias[BodyId].y,
+			AngularImpulse.z * BodyStore->InvRotationalInertias[BodyId].z);
 	}
 
 }
 
 void URigidBodyComponent::P_SetVelocity(const Vector3& InVelocity) 
 {
-	if (IsStatic() || !IsValidVelocity(SimulatedState.Velocity - InVelocity))
+	if (IsStatic() || !IsValidVelocity(BodyStore->Velocities[BodyId] - InVelocity))
 		return;
-	SimulatedState.Velocity = InVelocity;
-	ClampLinearVelocity(SimulatedState.Velocity);
+
+	//외부 작용은 수면 중인 강체를 깨움
+	if (IsSleep())
+		Awake();
+	BodyStore->Velocities[BodyId] = InVelocity;
+	ClampLinearVelocity(BodyStore->Velocities[BodyId]);
 }
 
 void URigidBodyComponent::P_AddVelocity(const Vector3& InVelocityDelta) 
 {
 	if (IsStatic() || !IsValidVelocity(InVelocityDelta))
 		return;
-	SimulatedState.Velocity += InVelocityDelta;
-	ClampLinearVelocity(SimulatedState.Velocity);
+
+	//외부 작용은 수면 중인 강체를 깨움
+	if (IsSleep())
+		Awake();
+	BodyStore->Velocities[BodyId] += InVelocityDelta;
+	ClampLinearVelocity(BodyStore->Velocities[BodyId]);
 }
 
 void URigidBodyComponent::P_SetAngularVelocity(const Vector3& InAngularVelocity) 
 {
-	if (IsStatic() || !IsValidAngularVelocity(SimulatedState.AngularVelocity - InAngularVelocity))
+	if (IsStatic() || !IsValidAngularVelocity(BodyStore->AngularVelocities[BodyId] - InAngularVelocity))
 		return;
-	SimulatedState.AngularVelocity = InAngularVelocity;
-	ClampAngularVelocity(SimulatedState.AngularVelocity);
+
+	//외부 작용은 수면 중인 강체를 깨움
+	if (IsSleep())
+		Awake();
+	BodyStore->AngularVelocities[BodyId] = InAngularVelocity;
+	ClampAngularVelocity(BodyStore->AngularVelocities[BodyId]);
 }
 
 void URigidBodyComponent::P_AddAngularVelocity(const Vector3& InAngularVelocityDelta) 
 {
 	if (IsStatic() || !IsValidAngularVelocity(InAngularVelocityDelta))
 		return;
-	SimulatedState.AngularVelocity += InAngularVelocityDelta;
-	ClampAngularVelocity(SimulatedState.AngularVelocity);
+
+	//외부 작용은 수면 중인 강체를 깨움
+	if (IsSleep())
+		Awake();
+	BodyStore->AngularVelocities[BodyId] += InAngularVelocityDelta;
+	ClampAngularVelocity(BodyStore->AngularVelocities[BodyId]);
 }
 #pragma endregion
 
@@ -251,23 +303,26 @@ void URigidBodyComponent::TickPhysics(const float DeltaTime)
 	if (!IsActive() || IsStatic() || IsSleep())
 		return;
 
+	// 지역 서브스텝 중인 강체는 물리 시스템이 따로 적분
+	if (BodyStore->HasFlag(BodyId, FPhysicsBodyStore::BODY_SUBSTEP))
+		return;
+
     //물리 상태 초기화
-	Vector3 Velocity = SimulatedState.Velocity;
-	Vector3 AngularVelocity = SimulatedState.AngularVelocity;
-	Vector3 AccumulatedForce = SimulatedState.AccumulatedForce;
-	Vector3 AccumulatedTorque = SimulatedState.AccumulatedTorque;
+	Vector3 Velocity = BodyStore->Velocities[BodyId];
+	Vector3 AngularVelocity = BodyStore->AngularVelocities[BodyId];
+	Vector3 AccumulatedForce = BodyStore->AccumulatedForces[BodyId];
+	Vector3 AccumulatedTorque = BodyStore->AccumulatedTorques[BodyId];
 
-	const float InvMass = SimulatedState.InvMass;
-	const Vector3 InvRotationalInertia = SimulatedState.InvRotationalInertia;
-	const float FrictionKinetic = SimulatedState.FrictionKinetic;
-	const float FrictionStatic = SimulatedState.FrictionStatic;
-	const float Restitution = SimulatedState.Restitution;
+	const float InvMass = BodyStore->InvMasses[BodyId];
+	const Vector3 InvRotationalInertia = BodyStore->InvRotationalInertias[BodyId];
+	const float FrictionKinetic = BodyStore->FrictionKinetics[BodyId];
+	const float FrictionStatic = BodyStore->FrictionStatics[BodyId];
 
 	Vector3 TotalAcceleration = Vector3::Zero();
 	Vector3 TotalAngularAcceleration = Vector3::Zero();
 
-	constexpr float DragCoefficient = 0.01f;
-	constexpr float RotationalDragCoefficient = 0.1f;
+	constexpr float DragCoefficient = LINEAR_DRAG_COEFFICIENT;
+	constexpr float RotationalDragCoefficient = ANGULAR_DRAG_COEFFICIENT;
 	//공기 저항
 	Vector3 DragForce = -Velocity.GetNormalized() * Velocity.LengthSquared() * DragCoefficient;
 	Vector3 DragAcceleration = DragForce * InvMass;
@@ -377,17 +432,17 @@ void URigidBodyComponent::TickPhysics(const float DeltaTime)
 	AccumulatedTorque = Vector3::Zero();
 
 	//상태값 저장
-	if (IsValidVelocity(SimulatedState.Velocity - Velocity))
+	if (IsValidVelocity(BodyStore->Velocities[BodyId] - Velocity))
 	{
-		SimulatedState.Velocity = Velocity;
+		BodyStore->Velocities[BodyId] = Velocity;
 	}
-	if (IsValidAngularVelocity(SimulatedState.AngularVelocity - AngularVelocity))
+	if (IsValidAngularVelocity(BodyStore->AngularVelocities[BodyId] - AngularVelocity))
 	{
-		SimulatedState.AngularVelocity = AngularVelocity;
+		BodyStore->AngularVelocities[BodyId] = AngularVelocity;
 	}
 	//외부힘은 제로로 초기화
-	SimulatedState.AccumulatedForce = AccumulatedForce;
-	SimulatedState.AccumulatedTorque = AccumulatedTorque;
+	BodyStore->AccumulatedForces[BodyId] = AccumulatedForce;
+	BodyStore->AccumulatedTorques[BodyId] = AccumulatedTorque;
 
 	//  저장된 상태값에 따른 위치 업데이트
 	P_UpdateTransformByVelocity(DeltaTime);
@@ -412,39 +467,74 @@ void URigidBodyComponent::SetWorldTransform(const FTransform& InWorldTransform)
 	
 	//잡 전달
 	bStateDirty = true;
-	auto Job = UPhysicsSystem::Get()->AcquireJob<FJobSetWorldTransform>
-												 (Engine::Cast<URigidBodyComponent>(shared_from_this()), GetWorldTransform());
-	UPhysicsSystem::Get()->RequestPhysicsJob(Job);
+	UPhysicsSystem::Get()->RequestPhysicsJob(FPhysicsJob::SetWorldTransform(BodyId, GetWorldTransform()));
 }
 
 
 // 시뮬레이션 플래그
 void URigidBodyComponent::SetGravity(const bool InBool) 
 {
+	UPhysicsSystem::Get()->WaitAsyncWork();
 	bGravity = InBool; 
+	BodyStore->SetFlag(BodyId, FPhysicsBodyStore::BODY_GRAVITY, InBool);
+}
+
+void URigidBodyComponent::SetMaxSpeed(float InSpeed)
+{
+	UPhysicsSystem::Get()->WaitAsyncWork();
+	MaxSpeed = InSpeed;
+	BodyStore->MaxSpeeds[BodyId] = InSpeed;
+}
+
+void URigidBodyComponent::SetMaxAngularSpeed(float InSpeed)
+{
+	UPhysicsSystem::Get()->WaitAsyncWork();
+	MaxAngularSpeed = InSpeed;
+	BodyStore->MaxAngularSpeeds[BodyId] = InSpeed;
+}
+
+void URigidBodyComponent::SetGravityScale(float InScale)
+{
+	UPhysicsSystem::Get()->WaitAsyncWork();
+	GravityScale = InScale;
+	BodyStore->GravityScales[BodyId] = InScale;
+}
+
+void URigidBodyComponent::RefreshBoundCollisions()
+{
+	// 자식 충돌체의 활성 상태가 그대로인 경우 - 등록/해제로 정리되지 않으므로 리프를 움직인 것으로 표시
+	for (const auto& Collision : FindComponentsByType<UCollisionComponentBase>(false))
+	{
+		auto CollisionPtr = Collision.lock();
+		if (CollisionPtr && CollisionPtr->GetRigidBody() == this)
+		{
+			UPhysicsSystem::GetCollisionSubsystem()->RefreshCollisionFilter(*CollisionPtr);
+		}
+	}
 }
 
 void URigidBodyComponent::RegisterPhysicsSystem()
 {
-	auto myShared = Engine::Cast<IPhysicsObejct>(
-		Engine::Cast<URigidBodyComponent>(shared_from_this()));
+	//이미 등록된 객체
+	if (UPhysicsSystem::Get()->IsRegisteredPhysicsObject(PhysicsHandle))
+		return;
 
-	assert(myShared, "[Error] InValidPhysicsObejct");
-	UPhysicsSystem::Get()->RegisterPhysicsObject(myShared);
+	PhysicsHandle = UPhysicsSystem::Get()->RegisterPhysicsObject(this);
 }
 
 void URigidBodyComponent::UnRegisterPhysicsSystem()
 {
-	auto myShared = Engine::Cast<IPhysicsObejct>(
-		Engine::Cast<URigidBodyComponent>(shared_from_this()));
-	assert(myShared, "[Error] InValidPhysicsObejct");
-	UPhysicsSystem::Get()->UnregisterPhysicsObject(myShared);
+	if (!PhysicsHandle.IsSet())
+		return;
+
+	UPhysicsSystem::Get()->UnregisterPhysicsObject(PhysicsHandle);
+	PhysicsHandle = FPhysicsObjectHandle();
 }
 
 // 내부 연산 결과를 외부용에 반영(동기화)
 void URigidBodyComponent::SynchronizeCachedStateFromSimulated()
 {
-	CachedState = SimulatedState;
+	ReadSimulatedState(CachedState);
 	USceneComponent::SetWorldTransform(CachedState.WorldTransform);
 	bStateDirty = false;
 }
@@ -458,13 +548,71 @@ void URigidBodyComponent::UpdateSimulatedStateFromCached()
 	bStateDirty = false;
 	FTransform CurrentWorldTransform = USceneComponent::GetWorldTransform();
 	CachedState.WorldTransform = CurrentWorldTransform;
-	SimulatedState = CachedState;
+	WriteSimulatedState(CachedState);
+}
+
+FTransform URigidBodyComponent::GetRenderWorldTransform() const
+{
+	UPhysicsSystem* PhysicsSystem = UPhysicsSystem::Get();
+	// 물리 밖에서 바뀌어 아직 저장소에 반영되지 않은 상태는 그대로 렌더링
+	// 비동기 Tick 진행 중에는 저장소가 갱신되는 중이므로 마지막으로 반영된 상태를 렌더링
+	if (!PhysicsSystem->IsInterpolateRenderTransform() || PhysicsSystem->IsAsyncTickInFlight() ||
+		!IsActive() || IsStatic() || IsDirtyPhysicsState())
+	{
+		return USceneComponent::GetRenderWorldTransform();
+	}
+	return BodyStore->GetInterpolatedTransform(BodyId, PhysicsSystem->GetInterpolationAlpha());
 }
 
 bool URigidBodyComponent::IsDirtyPhysicsState() const
 {
 	return bStateDirty;
 }
+
+void URigidBodyComponent::WriteSimulatedState(const FRigidPhysicsState& InState)
+{
+	const FPhysicsBodyId Id = BodyId;
+	BodyStore->Velocities[Id] = InState.Velocity;
+	BodyStore->AngularVelocities[Id] = InState.AngularVelocity;
+	BodyStore->AccumulatedForces[Id] = InState.AccumulatedForce;
+	BodyStore->AccumulatedTorques[Id] = InState.AccumulatedTorque;
+
+	BodyStore->InvMasses[Id] = InState.InvMass;
+	BodyStore->InvRotationalInertias[Id] = InState.InvRotationalInertia;
+	BodyStore->FrictionKinetics[Id] = InState.FrictionKinetic;
+	BodyStore->FrictionStatics[Id] = InState.FrictionStatic;
+	BodyStore->Restitutions[Id] = InState.Restitution;
+
+	BodyStore->SetStatic(Id, InState.RigidType == ERigidBodyType::Static);
+	BodyStore->Teleport(Id, InState.WorldTransform);
+}
+
+void URigidBodyComponent::WriteIntegrationSettings()
+{
+	BodyStore->GravityDirections[BodyId] = GravityDirection;
+	BodyStore->GravityScales[BodyId] = GravityScale;
+	BodyStore->MaxSpeeds[BodyId] = MaxSpeed;
+	BodyStore->MaxAngularSpeeds[BodyId] = MaxAngularSpeed;
+	BodyStore->SetFlag(BodyId, FPhysicsBodyStore::BODY_GRAVITY, bGravity);
+}
+
+void URigidBodyComponent::ReadSimulatedState(FRigidPhysicsState& OutState) const
+{
+	const FPhysicsBodyId Id = BodyId;
+	OutState.Velocity = BodyStore->Velocities[Id];
+	OutState.AngularVelocity = BodyStore->AngularVelocities[Id];
+	OutState.AccumulatedForce = BodyStore->AccumulatedForces[Id];
+	OutState.AccumulatedTorque = BodyStore->AccumulatedTorques[Id];
+
+	OutState.InvMass = BodyStore->InvMasses[Id];
+	OutState.InvRotationalInertia = BodyStore->InvRotationalInertias[Id];
+	OutState.FrictionKinetic = BodyStore->FrictionKinetics[Id];
+	OutState.FrictionStatic = BodyStore->FrictionStatics[Id];
+	OutState.Restitution = BodyStore->Restitutions[Id];
+
+	OutState.RigidType = BodyStore->IsStatic(Id) ? ERigidBodyType::Static : ERigidBodyType::Dynamic;
+	OutState.WorldTransform = BodyStore->GetWorldTransform(Id);
+}
 #pragma endregion
 
 bool URigidBodyComponent::IsActive() const
@@ -474,18 +622,20 @@ bool URigidBodyComponent::IsActive() const
 
 bool URigidBodyComponent::IsSleep() const
 {
-	return bSleep;
+	return BodyStore->IsSleeping(BodyId);
 }
 
 void URigidBodyComponent::Sleep()
 {
-	bSleep = true;
-	SimulatedState.Reset();
+	//직접 재운 강체는 섬 수면 판정에서 충분히 쉰 것으로 취급
+	BodyStore->SetSleeping(BodyId, true);
+	BodyStore->SleepTimers[BodyId] = FLT_MAX;
 }
 
 void URigidBodyComponent::Awake()
 {
-	bSleep = false;
+	//외부에서 깨운 경우 수면 판정 시간도 초기화
+	BodyStore->Awake(BodyId);
 }
 
 #pragma region External PhysicsState
@@ -498,9 +648,7 @@ void URigidBodyComponent::ApplyForce(const Vector3& Force, const Vector3& Locati
 	bStateDirty = true;
 
 	//CachedState.AccumulatedForce += Force;
-	auto Job = UPhysicsSystem::Get()->AcquireJob<FJobApplyForce>(Engine::Cast<URigidBodyComponent>(shared_from_this()),
-																 Force,Location);
-	UPhysicsSystem::Get()->RequestPhysicsJob(Job);
+	UPhysicsSystem::Get()->RequestPhysicsJob(FPhysicsJob::ApplyForce(BodyId, Force, Location));
 
 	//Vector3 Torque = Vector3::Cross(Location - GetCenterOfMass(), Force);
 	//if (IsValidTorque(Torque))
@@ -516,9 +664,7 @@ void URigidBodyComponent::ApplyImpulse(const Vector3& Impulse, const Vector3& Lo
 
 	bStateDirty = true;
 
-	auto Job = UPhysicsSystem::Get()->AcquireJob<FJobApplyImpulse>(Engine::Cast<URigidBodyComponent>(shared_from_this()),
-																									 Impulse, Location);
-	UPhysicsSystem::Get()->RequestPhysicsJob(Job);
+	UPhysicsSystem::Get()->RequestPhysicsJob(FPhysicsJob::ApplyImpulse(BodyId, Impulse, Location));
 
 	//CachedState.AccumulatedInstantForce += Impulse;
 	//Vector3 AngularImpulse = Vector3::Cross(Location - GetCenterOfMass(), Impulse);
@@ -588,9 +734,7 @@ void URigidBodyComponent::SetVelocity(const Vector3& InVelocity)
 	}
 	bStateDirty = true;
 
-	auto Job = UPhysicsSystem::Get()->AcquireJob<FJobSetVelocity>(Engine::Cast<URigidBodyComponent>(shared_from_this()),
-																  InVelocity);
-	UPhysicsSystem::Get()->RequestPhysicsJob(Job);
+	UPhysicsSystem::Get()->RequestPhysicsJob(FPhysicsJob::SetVelocity(BodyId, InVelocity));
 
 	//CachedState.Velocity = InVelocity;
 	//ClampLinearVelocity(CachedState.Velocity);
@@ -603,9 +747,7 @@ void URigidBodyComponent::AddVelocity(const Vector3& InVelocityDelta)
 		return;
 	}
 	bStateDirty = true;
-	auto Job = UPhysicsSystem::Get()->AcquireJob<FJobAddVelocity>(Engine::Cast<URigidBodyComponent>(shared_from_this()),
-																  InVelocityDelta);
-	UPhysicsSystem::Get()->RequestPhysicsJob(Job);
+	UPhysicsSystem::Get()->RequestPhysicsJob(FPhysicsJob::AddVelocity(BodyId, InVelocityDelta));
 
 
 	//CachedState.Velocity += InVelocityDelta;
@@ -621,9 +763,7 @@ void URigidBodyComponent::SetAngularVelocity(const Vector3& InAngularVelocity)
 	}
 
 	bStateDirty = true;
-	auto Job = UPhysicsSystem::Get()->AcquireJob<FJobSetAngularVelocity>(Engine::Cast<URigidBodyComponent>(shared_from_this()),
-																  InAngularVelocity);
-	UPhysicsSystem::Get()->RequestPhysicsJob(Job);
+	UPhysicsSystem::Get()->RequestPhysicsJob(FPhysicsJob::SetAngularVelocity(BodyId, InAngularVelocity));
 
 	//CachedState.AngularVelocity = InAngularVelocity;
 	//ClampAngularVelocity(CachedState.AngularVelocity);
@@ -636,9 +776,7 @@ void URigidBodyComponent::AddAngularVelocity(const Vector3& InAngularVelocityDel
 		return;
 	}
 	bStateDirty = true;
-	auto Job = UPhysicsSystem::Get()->AcquireJob<FJobAddAngularVelocity>(Engine::Cast<URigidBodyComponent>(shared_from_this()),
-																		 InAngularVelocityDelta);
-	UPhysicsSystem::Get()->RequestPhysicsJob(Job);
+	UPhysicsSystem::Get()->RequestPhysicsJob(FPhysicsJob::AddAngularVelocity(BodyId, InAngularVelocityDelta));
 
 	//CachedState.AngularVelocity += InAngularVelocityDelta;
 	//ClampAngularVelocity(CachedState.AngularVelocity);
@@ -7,6 +7,8 @@
 #include "PhysicsStateInternalInterface.h"
 #include "PhysicsObjectInterface.h"
 #include "PhysicsJob.h"
+#include "PhysicsBodyStore.h"
+#include "PhysicsObjectRegistry.h"
 
 class UGameObject;
 
@@ -98,11 +100,11 @@ public:
 		float invMass = P_GetInvMass();
 		return invMass > KINDA_SMALL ? 1.0f / invMass : KINDA_LARGE;
 	}
-	float P_GetInvMass() const override { return IsStatic() ? 0.0f : SimulatedState.InvMass;}
+	float P_GetInvMass() const override { return IsStatic() ? 0.0f : BodyStore->InvMasses[BodyId];}
 	inline Vector3 P_GetRotationalInertia() const override
 	{
 		Vector3 Result;
-		Vector3 InvRotationalInertia = SimulatedState.InvRotationalInertia;;
+		Vector3 InvRotationalInertia = BodyStore->InvRotationalInertias[BodyId];
 		Result.x = (abs(InvRotationalInertia.x) < KINDA_SMALL) ?
 			KINDA_LARGE : (1.0f / InvRotationalInertia.x);
 		Result.y = (abs(InvRotationalInertia.y) < KINDA_SMALL) ?
@@ -111,17 +113,19 @@ public:
 			KINDA_LARGE : (1.0f / InvRotationalInertia.z);
 		return Result;
 	}
-	Vector3 P_GetInvRotationalInertia() const override { return IsStatic() ? Vector3::Zero() : SimulatedState.InvRotationalInertia; }
+	Vector3 P_GetInvRotationalInertia() const override { return IsStatic() ? Vector3::Zero() : BodyStore->InvRotationalInertias[BodyId]; }
 
-    float P_GetRestitution() const override { return SimulatedState.Restitution; }
-    float P_GetFrictionStatic() const override { return SimulatedState.FrictionStatic; }
-    float P_GetFrictionKinetic() const override { return SimulatedState.FrictionKinetic; }
+    float P_GetRestitution() const override { return BodyStore->Restitutions[BodyId]; }
+    float P_GetFrictionStatic() const override { return BodyStore->FrictionStatics[BodyId]; }
+    float P_GetFrictionKinetic() const override { return BodyStore->FrictionKinetics[BodyId]; }
 
-    Vector3 P_GetVelocity() const override { return IsStatic() ? Vector3::Zero() : SimulatedState.Velocity; }
-    Vector3 P_GetAngularVelocity() const override { return IsStatic() ? Vector3::Zero() : SimulatedState.AngularVelocity; }
+    Vector3 P_GetVelocity() const override { return IsStatic() ? Vector3::Zero() : BodyStore->Velocities[BodyId]; }
+    Vector3 P_GetAngularVelocity() const override { return IsStatic() ? Vector3::Zero() : BodyStore->AngularVelocities[BodyId]; }
 
-    const FTransform& P_GetWorldTransform() const override { return SimulatedState.WorldTransform; }
-	Vector3 P_GetCenterOfMass() const { return SimulatedState.WorldTransform.Position; }
+    FTransform P_GetWorldTransform() const override { return BodyStore->GetWorldTransform(BodyId); }
+    Vector3 P_GetWorldPosition() const override { return BodyStore->Positions[BodyId]; }
+    Quaternion P_GetWorldRotation() const override { return BodyStore->Rotations[BodyId]; }
+	Vector3 P_GetCenterOfMass() const { return BodyStore->Positions[BodyId]; }
 
 	void P_SetWorldTransform(const FTransform& InTransfrom) override;
 	//void P_SetWorldPosition(const Vector3& InPoisiton) override;
@@ -142,6 +146,7 @@ public:
 #pragma endregion
 #pragma region IPhysicsObject
 public:
+	FPhysicsBodyId GetPhysicsBodyId() const override { return BodyId; }
 	// 현재 상태를 외부 상태로 저장
 	void SynchronizeCachedStateFromSimulated()  override;
 	// 외부 상태를 현재 상태로 저장
@@ -168,9 +173,12 @@ public:
 
 	virtual const char* GetComponentClassName() const override { return "URigid"; }
 
-	inline void SetMaxSpeed(float InSpeed) { MaxSpeed = InSpeed; }
-	inline void SetMaxAngularSpeed(float InSpeed) { MaxAngularSpeed = InSpeed; }
-	inline void SetGravityScale(float InScale) { GravityScale = InScale; }
+	// 직전 단계와 현재 단계 사이 보간된 트랜스폼
+	virtual FTransform GetRenderWorldTransform() const override;
+
+	void SetMaxSpeed(float InSpeed);
+	void SetMaxAngularSpeed(float InSpeed);
+	void SetGravityScale(float InScale);
 public:
 	// 시뮬레이션 플래그
 	void SetGravity(const bool InBool);
@@ -180,6 +188,8 @@ public:
 private:
 	void RegisterPhysicsSystem() override;
 	void UnRegisterPhysicsSystem() override;
+	// 연결된 충돌체의 쌍 재구성 요청 - 강체 활성 상태가 쌍 생성 조건이므로 멈춰 있어도 반영
+	void RefreshBoundCollisions();
 
 	//속도에 따른 트랜스폼 변화
 	void P_UpdateTransformByVelocity(float DeltaTime);
@@ -189,8 +199,8 @@ private:
 	void ApplyDrag(float DeltaTime) {}//todo
 	Vector3 GetCenterOfMass() const;
 
-	__forceinline bool IsSpeedRestricted() { return !(MaxSpeed < 0.0f); }
-	__forceinline bool IsAngularSpeedRestricted() { return !(MaxAngularSpeed < 0.0f); }
+	inline bool IsSpeedRestricted() { return !(MaxSpeed < 0.0f); }
+	inline bool IsAngularSpeedRestricted() { return !(MaxAngularSpeed < 0.0f); }
 
 	bool ShouldSleep() const;
 
@@ -232,9 +242,20 @@ private:
 		}
 	};
 
+	// 물리시스템 저장소와 상태 교환
+	void WriteSimulatedState(const FRigidPhysicsState& InState);
+	void ReadSimulatedState(FRigidPhysicsState& OutState) const;
+	// 일괄 적분기용 설정값 저장소 반영
+	void WriteIntegrationSettings();
+
 	mutable bool bStateDirty = false;
 	FRigidPhysicsState CachedState;  //저장된 물리 상태값, 외부에 읽기전용으로 제공될것
-	mutable FRigidPhysicsState SimulatedState;  //물리시스템 내부 연산용 물리 상태값. 
+
+	//물리시스템 내부 연산용 물리 상태값 - 물리시스템 소유 SoA 저장소의 슬롯
+	FPhysicsBodyStore* BodyStore = nullptr;
+	FPhysicsBodyId BodyId = FPhysicsBodyStore::INVALID_BODY;
+	// 물리 시스템 등록 핸들 - 활성 상태일 때만 유효
+	FPhysicsObjectHandle PhysicsHandle;
 
 	float MaxSpeed = 400.0f;
 	float MaxAngularSpeed = 6.0f * PI;
@@ -243,6 +264,4 @@ private:
 	float GravityScale = 9.81f;
 	Vector3 GravityDirection = -Vector3::Up();
 
-	bool bSleep = false;
-
 };
\ No newline at end of file
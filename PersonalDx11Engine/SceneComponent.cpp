@@ -379,6 +379,16 @@ const FTransform& USceneComponent::GetWorldTransform() const
     return WorldTransform;
 }
 
+FTransform USceneComponent::GetRenderWorldTransform() const
+{
+    // 부모의 렌더링 트랜스폼 기준으로 조합 - 보간 중인 강체의 자식도 함께 따라감
+    if (auto Parent = GetSceneParent())
+    {
+        return LocalToWorld(Parent->GetRenderWorldTransform());
+    }
+    return GetWorldTransform();
+}
+
 const FTransform& USceneComponent::GetLocalTransform() const
 {
     return LocalTransform;
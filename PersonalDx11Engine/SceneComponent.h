@@ -51,6 +51,8 @@ public:
     // 트랜스폼 접근자
     const FTransform& GetLocalTransform() const;
     const FTransform& GetWorldTransform() const;
+    // 렌더링용 월드 트랜스폼 - 물리 보간 중인 부모가 있으면 시뮬레이션 결과와 다를 수 있음
+    virtual FTransform GetRenderWorldTransform() const;
 
     // 위치, 회전, 크기 개별 접근자
 	Vector3 GetLocalPosition() const { return GetLocalTransform().Position; }
@@ -0,0 +1,82 @@
+#include "SimulationIsland.h"
+
+void FSimulationIslandGraph::Reset(size_t InBodyCapacity)
+{
+    Parents.assign(InBodyCapacity, FPhysicsBodyStore::INVALID_BODY);
+    IslandIndices.assign(InBodyCapacity, NO_ISLAND);
+    Bodies.clear();
+    IslandBodies.clear();
+    IslandOffsets.clear();
+}
+
+void FSimulationIslandGraph::AddBody(FPhysicsBodyId Id)
+{
+    if (Id >= Parents.size() || Parents[Id] != FPhysicsBodyStore::INVALID_BODY)
+        return;
+
+    Parents[Id] = Id;
+    Bodies.push_back(Id);
+}
+
+void FSimulationIslandGraph::Connect(FPhysicsBodyId IdA, FPhysicsBodyId IdB)
+{
+    if (IdA >= Parents.size() || IdB >= Parents.size() ||
+        Parents[IdA] == FPhysicsBodyStore::INVALID_BODY ||
+        Parents[IdB] == FPhysicsBodyStore::INVALID_BODY)
+        return;
+
+    FPhysicsBodyId RootA = Find(IdA);
+    FPhysicsBodyId RootB = Find(IdB);
+    if (RootA == RootB)
+        return;
+
+    // 작은 번호를 루트로 - 입력 순서와 무관한 결과
+    if (RootA < RootB)
+        Parents[RootB] = RootA;
+    else
+        Parents[RootA] = RootB;
+}
+
+void FSimulationIslandGraph::Build()
+{
+    IslandOffsets.clear();
+    IslandOffsets.push_back(0);
+
+    // 루트별 섬 번호 부여 및 섬 크기 집계 (IslandOffsets[i + 1]에 임시 저장)
+    for (FPhysicsBodyId Id : Bodies)
+    {
+        FPhysicsBodyId Root = Find(Id);
+        if (IslandIndices[Root] == NO_ISLAND)
+        {
+            IslandIndices[Root] = static_cast<uint32_t>(IslandOffsets.size() - 1);
+            IslandOffsets.push_back(0);
+        }
+        IslandIndices[Id] = IslandIndices[Root];
+        ++IslandOffsets[IslandIndices[Id] + 1];
+    }
+
+    // 누적합으로 시작 위치 계산
+    for (size_t i = 1; i < IslandOffsets.size(); ++i)
+    {
+        IslandOffsets[i] += IslandOffsets[i - 1];
+    }
+
+    // 섬 순서로 강체 배치
+    IslandBodies.resize(Bodies.size());
+    std::vector<uint32_t> Cursor(IslandOffsets.begin(), IslandOffsets.end() - 1);
+    for (FPhysicsBodyId Id : Bodies)
+    {
+        IslandBodies[Cursor[IslandIndices[Id]]++] = Id;
+    }
+}
+
+FPhysicsBodyId FSimulationIslandGraph::Find(FPhysicsBodyId Id)
+{
+    // 경로 절반 압축
+    while (Parents[Id] != Id)
+    {
+        Parents[Id] = Parents[Parents[Id]];
+        Id = Parents[Id];
+    }
+    return Id;
+}
@@ -0,0 +1,51 @@
+#pragma once
+#include "PhysicsBodyStore.h"
+#include <vector>
+#include <cstdint>
+
+/// <summary>
+/// 동적 강체 접촉 그래프를 연결 요소(섬)로 분할
+/// Union-Find로 간선을 합친 뒤, 같은 섬의 강체를 연속 배열로 정리함
+/// 정적 강체는 섬을 연결하지 않으므로 등록하지 않아야 함
+/// </summary>
+class FSimulationIslandGraph
+{
+public:
+    static constexpr uint32_t NO_ISLAND = static_cast<uint32_t>(-1);
+
+public:
+    // 강체 저장소 크기로 초기화 - 매 서브스텝 재구성
+    void Reset(size_t InBodyCapacity);
+
+    void AddBody(FPhysicsBodyId Id);
+    // 두 강체 모두 등록된 경우에만 연결
+    void Connect(FPhysicsBodyId IdA, FPhysicsBodyId IdB);
+
+    // 섬 번호 부여 및 섬별 강체 목록 정리 - 섬 번호는 섬에서 가장 먼저 등록된 강체 순서를 따름
+    void Build();
+
+    size_t GetIslandCount() const { return IslandOffsets.empty() ? 0 : IslandOffsets.size() - 1; }
+    uint32_t GetIslandIndex(FPhysicsBodyId Id) const
+    {
+        return Id < IslandIndices.size() ? IslandIndices[Id] : NO_ISLAND;
+    }
+
+    const FPhysicsBodyId* GetIslandBodiesBegin(size_t IslandIndex) const
+    {
+        return IslandBodies.data() + IslandOffsets[IslandIndex];
+    }
+    const FPhysicsBodyId* GetIslandBodiesEnd(size_t IslandIndex) const
+    {
+        return IslandBodies.data() + IslandOffsets[IslandIndex + 1];
+    }
+
+private:
+    FPhysicsBodyId Find(FPhysicsBodyId Id);
+
+private:
+    std::vector<FPhysicsBodyId> Parents;      // INVALID_BODY면 미등록
+    std::vector<uint32_t> IslandIndices;      // 강체별 섬 번호
+    std::vector<FPhysicsBodyId> Bodies;       // 등록 순서
+    std::vector<FPhysicsBodyId> IslandBodies; // 섬 순서로 정렬된 강체
+    std::vector<uint32_t> IslandOffsets;      // 섬별 IslandBodies 시작 위치
+};
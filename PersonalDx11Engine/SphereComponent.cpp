@@ -1,12 +1,14 @@
 #include "SphereComponent.h"
+#ifndef PHYSICS_HEADLESS
 #include "DebugDrawerManager.h"
+#endif
 #include "PhysicsDefine.h"
 
 Vector3 USphereComponent::GetWorldSupportPoint(const Vector3& WorldDirection) const
 {
     // 입력 방향 확인 및 정규화
     XMVECTOR Dir = XMLoadFloat3(&WorldDirection);
-    if (XMVector3LengthSq(Dir).m128_f32[0] < KINDA_SMALL)
+    if (XMVectorGetX(XMVector3LengthSq(Dir)) < KINDA_SMALL)
     {
         Dir = XMVectorSet(0.0f, 1.0f, 0.0f, 0.0f);
     }
@@ -51,6 +53,7 @@ void USphereComponent::CalculateAABB(Vector3& OutMin, Vector3& OutMax) const
 
 void USphereComponent::RequestDebugRender(const float DeltaTime)
 {
+#ifndef PHYSICS_HEADLESS
     UDebugDrawManager::Get()->DrawSphere(
         GetWorldPosition(),
         GetWorldScale().x * 0.5f,
@@ -58,4 +61,5 @@ void USphereComponent::RequestDebugRender(const float DeltaTime)
         Vector4(1, 1, 0, 1),
         DeltaTime
     );
+#endif
 }
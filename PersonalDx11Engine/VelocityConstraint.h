@@ -1,6 +1,7 @@
 #pragma once
 #include "ConstraintInterface.h"
 #include "Math.h"
+#include <cfloat>
 
 
 struct FPhysicsParameters;
@@ -308,14 +308,20 @@ int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLine
 #pragma endregion
 
 #pragma region logic
-		//물리
-		UPhysicsSystem::Get()->TickPhysics(DeltaTime);
+		//물리 - 비동기 모드에서는 일반 로직 이후 시작하여 렌더링 제출과 겹쳐 진행
+		if (!UPhysicsSystem::Get()->IsAsyncPhysics())
+		{
+			UPhysicsSystem::Get()->TickPhysics(DeltaTime);
+		}
 		//리소스
 		UResourceManager::Get()->Tick(DeltaTime);
 
 		//일반 로직
 		USceneManager::Get()->Tick(DeltaTime);
 		UDebugDrawManager::Get()->Tick(DeltaTime);
+
+		//비동기 물리 시작 - 결과는 다음 프레임 로직부터 반영됨
+		UPhysicsSystem::Get()->BeginAsyncTick(DeltaTime);
 #pragma endregion 
 		
 #pragma region Rendering
@@ -329,6 +335,9 @@ int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLine
 		//Actual Render 
 		Renderer->ProcessRender();
 
+		//비동기 물리 동기화 - UI에서 장면 전환 등으로 물리 객체가 바뀔 수 있으므로 UI 이전에 완료
+		UPhysicsSystem::Get()->WaitAsyncTick();
+
 #pragma region SystemUI
 		UUIManager::Get()->RegisterUIElement([DeltaTime, &GameplayScene01, &GameplayScene02, &Renderer, &TestScene01]() {
 			ImGui::SetNextWindowSize(ImVec2(400, 100));
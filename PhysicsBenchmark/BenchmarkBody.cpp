@@ -0,0 +1,76 @@
+#include "BenchmarkBody.h"
+#include "ActorComponent.h"
+#include "RigidBodyComponent.h"
+#include "CollisionComponent.h"
+#include "BoxComponent.h"
+#include "SphereComponent.h"
+#include "TypeCast.h"
+
+UBenchmarkBody::UBenchmarkBody(EBenchmarkShape InShape) : Shape(InShape)
+{
+    //Root to 'Rigid'
+    auto RigidPtr = UActorComponent::Create<URigidBodyComponent>();
+    if (!RigidPtr)
+        return;
+
+    auto Root = Engine::Cast<USceneComponent>(RigidPtr);
+    SetRootComponent(Root);
+    Rigid = RigidPtr;
+
+    if (Shape == EBenchmarkShape::Box)
+    {
+        Collision = UActorComponent::Create<UBoxComponent>();
+    }
+    else
+    {
+        Collision = UActorComponent::Create<USphereComponent>();
+    }
+
+    if (Collision)
+    {
+        RigidPtr->AddChild(Collision);
+    }
+}
+
+UBenchmarkBody::~UBenchmarkBody()
+{
+    Collision = nullptr;
+}
+
+void UBenchmarkBody::PostInitialized()
+{
+    UGameObject::PostInitialized();
+
+    if (auto RigidPtr = Rigid.lock())
+    {
+        if (Collision)
+        {
+            Collision->BindRigidBody(RigidPtr);
+        }
+    }
+}
+
+void UBenchmarkBody::Setup(const Vector3& InPosition, const Vector3& InScale, float InMass, bool bInStatic)
+{
+    SetPosition(InPosition);
+    SetScale(InScale);
+
+    auto RigidPtr = Rigid.lock();
+    if (!RigidPtr)
+        return;
+
+    //물리적 상태값 초기화
+    RigidPtr->Reset();
+    RigidPtr->SetMass(InMass);
+    RigidPtr->SetRestitution(0.3f);
+    if (bInStatic)
+    {
+        RigidPtr->SetRigidType(ERigidBodyType::Static);
+        RigidPtr->SetGravity(false);
+    }
+    else
+    {
+        RigidPtr->SetGravity(true);
+    }
+    SetActive(true);
+}
@@ -0,0 +1,35 @@
+#pragma once
+#include "GameObject.h"
+
+enum class EBenchmarkShape
+{
+    Box,
+    Sphere,
+};
+
+/// <summary>
+/// 벤치마크용 물리 객체 - 강체 루트와 충돌체 하나만 가짐 (렌더링 컴포넌트 없음)
+/// </summary>
+class UBenchmarkBody : public UGameObject
+{
+public:
+    UBenchmarkBody(EBenchmarkShape InShape = EBenchmarkShape::Sphere);
+    virtual ~UBenchmarkBody();
+
+    virtual void PostInitialized() override;
+
+    // 위치/크기/질량/종류를 한번에 초기화
+    void Setup(const Vector3& InPosition, const Vector3& InScale, float InMass, bool bInStatic);
+
+    class URigidBodyComponent* GetRigid() const { return Rigid.lock().get(); }
+    class UCollisionComponentBase* GetCollision() const { return Collision.get(); }
+    EBenchmarkShape GetShape() const { return Shape; }
+
+private:
+    EBenchmarkShape Shape = EBenchmarkShape::Sphere;
+
+    //Rigid Root 빠른 접근
+    std::weak_ptr<class URigidBodyComponent> Rigid;
+    // 컴포넌트 소유
+    std::shared_ptr<class UCollisionComponentBase> Collision;
+};
@@ -0,0 +1,234 @@
+#include "BenchmarkScene.h"
+#include "RigidBodyComponent.h"
+#include "CollisionProcessor.h"
+#include "PhysicsSystem.h"
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+namespace
+{
+    constexpr float BodySize = 20.0f;       // 기본 강체 지름/변 길이
+    constexpr float FloorThickness = 20.0f;
+
+    struct FSceneNameEntry
+    {
+        EBenchmarkScene Scene;
+        const char* Name;
+    };
+
+    constexpr FSceneNameEntry SceneNames[] = {
+        { EBenchmarkScene::Spheres, "spheres" },
+        { EBenchmarkScene::Boxes,   "boxes" },
+        { EBenchmarkScene::Stack,   "stack" },
+        { EBenchmarkScene::Pile,    "pile" },
+        { EBenchmarkScene::Rain,    "rain" },
+        { EBenchmarkScene::Mixed,   "mixed" },
+        { EBenchmarkScene::Projectile, "projectile" },
+    };
+
+    // 객체 수에 맞춘 정사각 격자 한 변의 칸 수
+    uint32_t GridSide(uint32_t InCount)
+    {
+        return std::max<uint32_t>(1, static_cast<uint32_t>(std::ceil(std::sqrt(static_cast<float>(InCount)))));
+    }
+}
+
+const char* FBenchmarkScene::GetSceneName(EBenchmarkScene InScene)
+{
+    for (const FSceneNameEntry& Entry : SceneNames)
+    {
+        if (Entry.Scene == InScene)
+            return Entry.Name;
+    }
+    return "unknown";
+}
+
+bool FBenchmarkScene::ParseSceneName(const std::string& InName, EBenchmarkScene& OutScene)
+{
+    for (const FSceneNameEntry& Entry : SceneNames)
+    {
+        if (InName == Entry.Name)
+        {
+            OutScene = Entry.Scene;
+            return true;
+        }
+    }
+    return false;
+}
+
+std::shared_ptr<UBenchmarkBody> FBenchmarkScene::Spawn(EBenchmarkShape InShape, const Vector3& InPosition,
+                                                       const Vector3& InScale, float InMass, bool bInStatic)
+{
+    auto Body = UGameObject::Create<UBenchmarkBody>(InShape);
+    if (!Body)
+        return nullptr;
+
+    Body->PostInitialized();
+    Body->PostInitializedComponents();
+    Body->Setup(InPosition, InScale, InMass, bInStatic);
+
+    Bodies.push_back(Body);
+    if (!bInStatic)
+    {
+        DynamicBodies.push_back(Body);
+    }
+    return Body;
+}
+
+void FBenchmarkScene::Build(const FBenchmarkSceneDesc& InDesc)
+{
+    Clear();
+
+    std::mt19937 Rng(InDesc.Seed);
+    std::uniform_real_distribution<float> Unit(0.0f, 1.0f);
+    auto RandRange = [&](float Min, float Max) { return Min + (Max - Min) * Unit(Rng); };
+
+    const uint32_t Count = InDesc.BodyCount;
+    const uint32_t Side = GridSide(Count);
+    const float Spacing = BodySize * 2.0f;
+    const float HalfExtent = Side * Spacing * 0.5f;
+
+    Bodies.reserve(Count + 64);
+    DynamicBodies.reserve(Count);
+
+    // 모든 장면 공통 바닥
+    const float FloorWidth = HalfExtent * 2.0f + Spacing * 4.0f;
+    Spawn(EBenchmarkShape::Box, Vector3(0.0f, -FloorThickness * 0.5f, 0.0f),
+          Vector3(FloorWidth, FloorThickness, FloorWidth), 1.0f, true);
+
+    switch (InDesc.Scene)
+    {
+        case EBenchmarkScene::Spheres:
+        case EBenchmarkScene::Boxes:
+        {
+            // 겹치지 않는 격자 배치 + 약간의 흔들림, 층 단위로 위로 쌓음
+            const EBenchmarkShape Shape = InDesc.Scene == EBenchmarkScene::Boxes ? EBenchmarkShape::Box : EBenchmarkShape::Sphere;
+            const uint32_t Layer = Side * Side;
+            for (uint32_t i = 0; i < Count; ++i)
+            {
+                const uint32_t x = i % Side;
+                const uint32_t z = (i / Side) % Side;
+                const uint32_t y = i / Layer;
+                Vector3 Position(x * Spacing - HalfExtent + RandRange(-2.0f, 2.0f),
+                                 BodySize + y * Spacing,
+                                 z * Spacing - HalfExtent + RandRange(-2.0f, 2.0f));
+                Spawn(Shape, Position, Vector3::One() * BodySize, RandRange(1.0f, 10.0f), false);
+            }
+            break;
+        }
+        case EBenchmarkScene::Stack:
+        {
+            // 기둥 높이 10, 기둥끼리는 서로 닿지 않도록 배치
+            constexpr uint32_t StackHeight = 10;
+            const uint32_t Columns = std::max<uint32_t>(1, (Count + StackHeight - 1) / StackHeight);
+            const uint32_t ColumnSide = GridSide(Columns);
+            const float ColumnHalf = ColumnSide * Spacing * 0.5f;
+            for (uint32_t i = 0; i < Count; ++i)
+            {
+                const uint32_t Column = i / StackHeight;
+                const uint32_t Level = i % StackHeight;
+                Vector3 Position((Column % ColumnSide) * Spacing - ColumnHalf,
+                                 BodySize * 0.5f + Level * BodySize,
+                                 (Column / ColumnSide) * Spacing - ColumnHalf);
+                Spawn(EBenchmarkShape::Box, Position, Vector3::One() * BodySize, 1.0f, false);
+            }
+            break;
+        }
+        case EBenchmarkScene::Pile:
+        {
+            // 바닥 면적의 1/4 안에 간격 없이 섞어 배치
+            const uint32_t PileSide = std::max<uint32_t>(1, Side / 2);
+            const uint32_t Layer = PileSide * PileSide;
+            const float PileHalf = PileSide * BodySize * 0.5f;
+            for (uint32_t i = 0; i < Count; ++i)
+            {
+                const uint32_t x = i % PileSide;
+                const uint32_t z = (i / PileSide) % PileSide;
+                const uint32_t y = i / Layer;
+                Vector3 Position(x * BodySize - PileHalf + RandRange(-1.0f, 1.0f),
+                                 BodySize + y * BodySize * 1.05f,
+                                 z * BodySize - PileHalf + RandRange(-1.0f, 1.0f));
+                const EBenchmarkShape Shape = Unit(Rng) < 0.5f ? EBenchmarkShape::Box : EBenchmarkShape::Sphere;
+                Spawn(Shape, Position, Vector3::One() * BodySize, RandRange(1.0f, 10.0f), false);
+            }
+            break;
+        }
+        case EBenchmarkScene::Rain:
+        {
+            // 넓은 높이 범위에 흩뿌려 시간차로 바닥에 도달
+            const float MaxHeight = BodySize * 10.0f + Count * 0.5f;
+            for (uint32_t i = 0; i < Count; ++i)
+            {
+                Vector3 Position(RandRange(-HalfExtent, HalfExtent),
+                                 RandRange(BodySize * 2.0f, MaxHeight),
+                                 RandRange(-HalfExtent, HalfExtent));
+                Spawn(EBenchmarkShape::Sphere, Position, Vector3::One() * RandRange(BodySize * 0.5f, BodySize),
+                      RandRange(1.0f, 10.0f), false);
+            }
+            break;
+        }
+        case EBenchmarkScene::Mixed:
+        {
+            // 4칸마다 정적 기둥, 나머지 칸 위에 동적 구/상자
+            const uint32_t Layer = Side * Side;
+            uint32_t Spawned = 0;
+            for (uint32_t i = 0; Spawned < Count; ++i)
+            {
+                const uint32_t x = i % Side;
+                const uint32_t z = (i / Side) % Side;
+                const uint32_t y = i / Layer;
+                Vector3 Position(x * Spacing - HalfExtent, BodySize + y * Spacing, z * Spacing - HalfExtent);
+
+                if (y == 0 && x % 4 == 0 && z % 4 == 0)
+                {
+                    Spawn(EBenchmarkShape::Box, Vector3(Position.x, BodySize * 0.5f, Position.z),
+                          Vector3(BodySize, BodySize, BodySize), 1.0f, true);
+                    continue;
+                }
+
+                const EBenchmarkShape Shape = (i & 1) ? EBenchmarkShape::Box : EBenchmarkShape::Sphere;
+                Position.y += BodySize;
+                Spawn(Shape, Position, Vector3::One() * BodySize, RandRange(1.0f, 10.0f), false);
+                ++Spawned;
+            }
+            break;
+        }
+        case EBenchmarkScene::Projectile:
+        {
+            // 높이를 흩뿌려 측정 구간 내내 시간차로 착탄 - 착탄 속도가 CCD 임계값을 넘어 이른 충돌 섬이 생김
+            const float MaxHeight = BodySize * 4.0f + Count * 8.0f;
+            const float MinSpeed = UPhysicsSystem::GetCollisionSubsystem()->GetCCDVelocityThreshold() * 1.1f;
+            for (uint32_t i = 0; i < Count; ++i)
+            {
+                Vector3 Position(RandRange(-HalfExtent, HalfExtent),
+                                 RandRange(BodySize * 2.0f, MaxHeight),
+                                 RandRange(-HalfExtent, HalfExtent));
+                auto Body = Spawn(EBenchmarkShape::Sphere, Position, Vector3::One() * BodySize, RandRange(1.0f, 10.0f), false);
+                if (Body && Body->GetRigid())
+                {
+                    // 기본 최대 속도는 CCD 임계값보다 낮으므로 올림
+                    Body->GetRigid()->SetMaxSpeed(MinSpeed * 2.5f);
+                    Body->GetRigid()->SetVelocity(Vector3(0.0f, -RandRange(MinSpeed, MinSpeed * 1.2f), 0.0f));
+                }
+            }
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+void FBenchmarkScene::Clear()
+{
+    DynamicBodies.clear();
+    Bodies.clear();
+}
+
+void FBenchmarkScene::Tick(const float DeltaTime)
+{
+    for (const auto& Body : Bodies)
+    {
+        Body->Tick(DeltaTime);
+    }
+}
@@ -0,0 +1,55 @@
+#pragma once
+#include "BenchmarkBody.h"
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+// 절차적 장면 종류
+enum class EBenchmarkScene
+{
+    Spheres,    // 바닥 위 넓은 영역에 흩어진 구
+    Boxes,      // 바닥 위 넓은 영역에 흩어진 상자
+    Stack,      // 상자 기둥 - 지속 접촉
+    Pile,       // 좁은 영역에 쏟아진 구/상자 더미 - 밀집 접촉
+    Rain,       // 높은 곳에서 시차를 두고 떨어지는 구
+    Mixed,      // 정적 장애물 격자 사이의 구/상자
+    Projectile, // CCD 임계 속도보다 빠르게 바닥으로 쏘아진 구 - 지역 서브스텝 경로
+    Count
+};
+
+struct FBenchmarkSceneDesc
+{
+    EBenchmarkScene Scene = EBenchmarkScene::Spheres;
+    uint32_t BodyCount = 1000;
+    uint32_t Seed = 1;
+};
+
+/// <summary>
+/// 벤치마크 장면 - 시드가 같으면 항상 같은 배치를 생성
+/// 파괴 시 모든 객체를 해제하여 물리 시스템 등록도 함께 해제됨
+/// </summary>
+class FBenchmarkScene
+{
+public:
+    void Build(const FBenchmarkSceneDesc& InDesc);
+    void Clear();
+
+    // 물리 Tick 이후 객체 Tick - 충돌체의 이전 트랜스폼 갱신
+    void Tick(const float DeltaTime);
+
+    const std::vector<std::shared_ptr<UBenchmarkBody>>& GetBodies() const { return Bodies; }
+    // 동적 강체만 - 작업 제출 대상
+    const std::vector<std::shared_ptr<UBenchmarkBody>>& GetDynamicBodies() const { return DynamicBodies; }
+
+    static const char* GetSceneName(EBenchmarkScene InScene);
+    static bool ParseSceneName(const std::string& InName, EBenchmarkScene& OutScene);
+
+private:
+    std::shared_ptr<UBenchmarkBody> Spawn(EBenchmarkShape InShape, const Vector3& InPosition,
+                                          const Vector3& InScale, float InMass, bool bInStatic);
+
+private:
+    std::vector<std::shared_ptr<UBenchmarkBody>> Bodies;
+    std::vector<std::shared_ptr<UBenchmarkBody>> DynamicBodies;
+};
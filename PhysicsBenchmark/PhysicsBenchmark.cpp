@@ -0,0 +1,545 @@
+// 헤드리스 물리 벤치마크
+// 절차적 장면을 생성하여 TickPhysics를 고정 프레임 수만큼 실행하고 결과를 JSON으로 출력
+//
+// 사용법:
+//   PhysicsBenchmark --scene pile --bodies 2000 --frames 600 --threads 1,2,4 --out result.json
+//   PhysicsBenchmark --check 1   (동작 검사만 실행, 실패 시 0이 아닌 값 반환)
+//
+#include "BenchmarkScene.h"
+#include "PhysicsSystem.h"
+#include "CollisionProcessor.h"
+#include "CollisionComponent.h"
+#include "PhysicsJob.h"
+#include "RigidBodyComponent.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+    struct FBenchmarkOptions
+    {
+        FBenchmarkSceneDesc Scene;
+        uint32_t Frames = 600;
+        uint32_t WarmupFrames = 30;
+        float DeltaTime = 0.016f;
+        std::vector<int> ThreadCounts = { 1 };
+        int SimdLevel = -1;         // 음수면 설정 파일 값 유지
+        int BatchIntegrator = -1;
+        int ContactBatch = -1;
+        int Manifold = -1;
+        int Coalesce = -1;
+        int JobSort = -1;
+        int Strict = -1;
+        int LocalSubstep = -1;
+        int Async = -1;
+        int Iterations = -1;        // 접촉 제약 최대 반복수
+        uint32_t JobsPerFrame = 0;  // 프레임마다 제출할 ApplyForce 작업 수
+        bool bRunChecks = false;    // 측정 대신 동작 검사 실행
+        std::string OutPath;
+    };
+
+    struct FBenchmarkResult
+    {
+        int Threads = 1;
+        double WallTimeMs = 0.0;
+        double StepsPerSec = 0.0;
+        uint64_t SubSteps = 0;
+        double MaxTickTimeMs = 0.0;  // 가장 느린 프레임의 물리 Tick 시간
+        FPhysicsTickStats Total;    // 측정 프레임 합계
+        uint32_t BodyCount = 0;
+        double AvgDrift = 0.0;      // 동적 강체의 생성 위치 대비 이동 거리 - 쌓기 안정성 지표
+        double MaxDrift = 0.0;
+        uint32_t BelowFloor = 0;    // 바닥 윗면(y = 0) 아래로 빠져나간 동적 강체 수 - 관통 지표
+        double JobSubmitMs = 0.0;   // 측정 프레임의 작업 생성/제출 시간 합
+    };
+
+    void PrintUsage()
+    {
+        std::printf(
+            "PhysicsBenchmark options\n"
+            "  --scene spheres|boxes|stack|pile|rain|mixed|projectile  (default spheres)\n"
+            "  --bodies N          dynamic body count (default 1000)\n"
+            "  --frames N          measured frames (default 600)\n"
+            "  --warmup N          unmeasured frames before measuring (default 30)\n"
+            "  --dt SECONDS        frame delta time (default 0.016)\n"
+            "  --threads A,B,...   physics thread counts to sweep (default 1)\n"
+            "  --simd 0|1|2        integrator SIMD level (default from Config.ini)\n"
+            "  --batch 0|1         use batch integrator\n"
+            "  --contactbatch 0|1  use SIMD contact batch solver (0 = per-pair solver)\n"
+            "  --manifold 0|1      solve box face contacts with up to 4 points (0 = single collision point)\n"
+            "  --coalesce 0|1      fold queued jobs per body\n"
+            "  --jobsort 0|1       sort queued jobs by body before execution (0 = submission order)\n"
+            "  --strict 0|1        strict fixed step mode\n"
+            "  --local 0|1         sub-step only islands with an early time of impact\n"
+            "  --async 0|1         run substeps on the physics thread (begin/wait every frame)\n"
+            "  --iterations N      contact solver iterations (default from Config.ini)\n"
+            "  --jobs N            ApplyForce jobs submitted per frame (default 0)\n"
+            "  --seed N            scene seed (default 1)\n"
+            "  --check 1           run behavior checks instead of measuring (exit code = failures)\n"
+            "  --out FILE          write JSON to FILE instead of stdout\n");
+    }
+
+    std::vector<int> ParseIntList(const std::string& InText)
+    {
+        std::vector<int> Values;
+        std::stringstream Stream(InText);
+        std::string Token;
+        while (std::getline(Stream, Token, ','))
+        {
+            if (!Token.empty())
+            {
+                Values.push_back(std::max(1, std::atoi(Token.c_str())));
+            }
+        }
+        return Values;
+    }
+
+    bool ParseOptions(int argc, char** argv, FBenchmarkOptions& OutOptions)
+    {
+        for (int i = 1; i < argc; ++i)
+        {
+            const std::string Key = argv[i];
+            if (Key == "--help" || Key == "-h")
+                return false;
+
+            if (i + 1 >= argc)
+            {
+                std::fprintf(stderr, "Missing value for %s\n", Key.c_str());
+                return false;
+            }
+            const std::string Value = argv[++i];
+
+            if (Key == "--scene")
+            {
+                if (!FBenchmarkScene::ParseSceneName(Value, OutOptions.Scene.Scene))
+                {
+                    std::fprintf(stderr, "Unknown scene: %s\n", Value.c_str());
+                    return false;
+                }
+            }
+            else if (Key == "--bodies")   OutOptions.Scene.BodyCount = static_cast<uint32_t>(std::atoi(Value.c_str()));
+            else if (Key == "--frames")   OutOptions.Frames = static_cast<uint32_t>(std::atoi(Value.c_str()));
+            else if (Key == "--warmup")   OutOptions.WarmupFrames = static_cast<uint32_t>(std::atoi(Value.c_str()));
+            else if (Key == "--dt")       OutOptions.DeltaTime = static_cast<float>(std::atof(Value.c_str()));
+            else if (Key == "--threads")  OutOptions.ThreadCounts = ParseIntList(Value);
+            else if (Key == "--simd")     OutOptions.SimdLevel = std::atoi(Value.c_str());
+            else if (Key == "--batch")    OutOptions.BatchIntegrator = std::atoi(Value.c_str());
+            else if (Key == "--contactbatch") OutOptions.ContactBatch = std::atoi(Value.c_str());
+            else if (Key == "--manifold") OutOptions.Manifold = std::atoi(Value.c_str());
+            else if (Key == "--coalesce") OutOptions.Coalesce = std::atoi(Value.c_str());
+            else if (Key == "--jobsort")  OutOptions.JobSort = std::atoi(Value.c_str());
+            else if (Key == "--strict")   OutOptions.Strict = std::atoi(Value.c_str());
+            else if (Key == "--local")    OutOptions.LocalSubstep = std::atoi(Value.c_str());
+            else if (Key == "--async")    OutOptions.Async = std::atoi(Value.c_str());
+            else if (Key == "--iterations") OutOptions.Iterations = std::atoi(Value.c_str());
+            else if (Key == "--jobs")     OutOptions.JobsPerFrame = static_cast<uint32_t>(std::atoi(Value.c_str()));
+            else if (Key == "--seed")     OutOptions.Scene.Seed = static_cast<uint32_t>(std::atoi(Value.c_str()));
+            else if (Key == "--check")    OutOptions.bRunChecks = std::atoi(Value.c_str()) != 0;
+            else if (Key == "--out")      OutOptions.OutPath = Value;
+            else
+            {
+                std::fprintf(stderr, "Unknown option: %s\n", Key.c_str());
+                return false;
+            }
+        }
+
+        if (OutOptions.ThreadCounts.empty())
+        {
+            OutOptions.ThreadCounts.push_back(1);
+        }
+        return OutOptions.DeltaTime > 0.0f;
+    }
+
+    void ApplyOptions(const FBenchmarkOptions& InOptions)
+    {
+        UPhysicsSystem* Physics = UPhysicsSystem::Get();
+        if (InOptions.SimdLevel >= 0)
+            Physics->SetSimdLevel(static_cast<EPhysicsSimdLevel>(std::min(InOptions.SimdLevel, 2)));
+        if (InOptions.BatchIntegrator >= 0)
+            Physics->SetUseBatchIntegrator(InOptions.BatchIntegrator != 0);
+        if (InOptions.ContactBatch >= 0)
+            UPhysicsSystem::GetCollisionSubsystem()->SetUseContactBatchSolver(InOptions.ContactBatch != 0);
+        if (InOptions.Manifold >= 0)
+            UPhysicsSystem::GetCollisionSubsystem()->SetUseContactManifold(InOptions.Manifold != 0);
+        if (InOptions.Coalesce >= 0)
+            Physics->SetCoalescePhysicsJobs(InOptions.Coalesce != 0);
+        if (InOptions.JobSort >= 0)
+            Physics->SetSortPhysicsJobs(InOptions.JobSort != 0);
+        if (InOptions.Strict >= 0)
+            Physics->SetStrictFixedStep(InOptions.Strict != 0);
+        if (InOptions.LocalSubstep >= 0)
+            Physics->SetLocalSubstepping(InOptions.LocalSubstep != 0);
+        if (InOptions.Async >= 0)
+            Physics->SetAsyncPhysics(InOptions.Async != 0);
+        if (InOptions.Iterations >= 0)
+            UPhysicsSystem::GetCollisionSubsystem()->SetMaxConstraintIterations(static_cast<uint16_t>(InOptions.Iterations));
+    }
+
+    void AccumulateStats(FPhysicsTickStats& OutTotal, const FPhysicsTickStats& InStats)
+    {
+        for (size_t i = 0; i < static_cast<size_t>(EPhysicsPhase::Count); ++i)
+        {
+            OutTotal.PhaseTimeMs[i] += InStats.PhaseTimeMs[i];
+        }
+        OutTotal.SubSteps += InStats.SubSteps;
+        OutTotal.SimulatedObjects += InStats.SimulatedObjects;
+        OutTotal.JobRequests += InStats.JobRequests;
+        OutTotal.BroadphasePairs += InStats.BroadphasePairs;
+        OutTotal.NarrowphaseHits += InStats.NarrowphaseHits;
+        OutTotal.TreeReinserts += InStats.TreeReinserts;
+        OutTotal.SolverIterations += InStats.SolverIterations;
+        OutTotal.UnconvergedIslands += InStats.UnconvergedIslands;
+        OutTotal.LocalSubstepBodies += InStats.LocalSubstepBodies;
+        OutTotal.LocalSubSteps += InStats.LocalSubSteps;
+    }
+
+    // 매 프레임 무작위 동적 강체에 힘 제출
+    void SubmitJobs(const FBenchmarkScene& InScene, uint32_t InCount, std::mt19937& InRng, std::vector<FPhysicsJob>& Scratch)
+    {
+        const auto& Dynamics = InScene.GetDynamicBodies();
+        if (InCount == 0 || Dynamics.empty())
+            return;
+
+        std::uniform_int_distribution<size_t> Pick(0, Dynamics.size() - 1);
+        std::uniform_real_distribution<float> Force(-50.0f, 50.0f);
+
+        Scratch.clear();
+        for (uint32_t i = 0; i < InCount; ++i)
+        {
+            URigidBodyComponent* Rigid = Dynamics[Pick(InRng)]->GetRigid();
+            if (!Rigid)
+                continue;
+            Scratch.push_back(FPhysicsJob::ApplyForce(Rigid->GetPhysicsBodyId(),
+                                                      Vector3(Force(InRng), Force(InRng), Force(InRng))));
+        }
+        UPhysicsSystem::Get()->RequestPhysicsJobs(Scratch.data(), Scratch.size());
+    }
+
+    FBenchmarkResult RunOnce(const FBenchmarkOptions& InOptions, int InThreads)
+    {
+        UPhysicsSystem* Physics = UPhysicsSystem::Get();
+        Physics->SetWorkerThreadCount(static_cast<size_t>(InThreads));
+        // 이전 실행이 남긴 슬롯/노드 배정과 충돌쌍 초기화 - 같은 설정이면 실행 순서와 무관하게 같은 결과
+        if (!Physics->ResetSimulation())
+        {
+            std::fprintf(stderr, "[PhysicsBenchmark] physics state was not reset, results may depend on previous runs\n");
+        }
+
+        FBenchmarkScene Scene;
+        Scene.Build(InOptions.Scene);
+
+        std::mt19937 JobRng(InOptions.Scene.Seed);
+        std::vector<FPhysicsJob> JobScratch;
+        JobScratch.reserve(InOptions.JobsPerFrame);
+        // 프레임당 작업 수가 버퍼 용량을 넘으면 초과분이 폐기되므로 용량 확장
+        if (InOptions.JobsPerFrame > Physics->GetPhysicsJobCapacity())
+        {
+            Physics->SetPhysicsJobCapacity(InOptions.JobsPerFrame);
+        }
+        double JobSubmitMs = 0.0;
+
+        std::vector<Vector3> SpawnPositions;
+        SpawnPositions.reserve(Scene.GetDynamicBodies().size());
+        for (const auto& Body : Scene.GetDynamicBodies())
+        {
+            SpawnPositions.push_back(Body->GetWorldTransform().Position);
+        }
+
+        auto StepFrame = [&]()
+        {
+            auto SubmitStart = std::chrono::high_resolution_clock::now();
+            SubmitJobs(Scene, InOptions.JobsPerFrame, JobRng, JobScratch);
+            JobSubmitMs += std::chrono::duration<double, std::milli>(
+                std::chrono::high_resolution_clock::now() - SubmitStart).count();
+            if (Physics->IsAsyncPhysics())
+            {
+                // 렌더링이 없으므로 시작 직후 동기화 - 스레드 전환 비용만 측정됨
+                Scene.Tick(InOptions.DeltaTime);
+                Physics->BeginAsyncTick(InOptions.DeltaTime);
+                Physics->WaitAsyncTick();
+                return;
+            }
+            Physics->TickPhysics(InOptions.DeltaTime);
+            Scene.Tick(InOptions.DeltaTime);
+        };
+
+        for (uint32_t Frame = 0; Frame < InOptions.WarmupFrames; ++Frame)
+        {
+            StepFrame();
+        }
+
+        FBenchmarkResult Result;
+        Result.Threads = InThreads;
+        Result.BodyCount = static_cast<uint32_t>(Scene.GetBodies().size());
+
+        JobSubmitMs = 0.0;
+        auto StartTime = std::chrono::high_resolution_clock::now();
+        for (uint32_t Frame = 0; Frame < InOptions.Frames; ++Frame)
+        {
+            StepFrame();
+            AccumulateStats(Result.Total, Physics->GetLastTickStats());
+            Result.MaxTickTimeMs = std::max(Result.MaxTickTimeMs, Physics->GetLastTickStats().GetTotalTimeMs());
+        }
+        auto EndTime = std::chrono::high_resolution_clock::now();
+
+        Result.WallTimeMs = std::chrono::duration<double, std::milli>(EndTime - StartTime).count();
+        Result.JobSubmitMs = JobSubmitMs;
+        Result.SubSteps = Result.Total.SubSteps;
+        Result.StepsPerSec = Result.WallTimeMs > 0.0 ? Result.SubSteps * 1000.0 / Result.WallTimeMs : 0.0;
+
+        const auto& Dynamics = Scene.GetDynamicBodies();
+        for (size_t i = 0; i < Dynamics.size(); ++i)
+        {
+            const double Drift = (Dynamics[i]->GetWorldTransform().Position - SpawnPositions[i]).Length();
+            Result.AvgDrift += Drift;
+            Result.MaxDrift = std::max(Result.MaxDrift, Drift);
+            if (Dynamics[i]->GetWorldTransform().Position.y < 0.0f)
+            {
+                ++Result.BelowFloor;
+            }
+        }
+        Result.AvgDrift /= std::max<size_t>(Dynamics.size(), 1);
+
+        // 장면 해제 - 다음 실행 전에 등록된 강체/충돌체 정리
+        Scene.Clear();
+        Physics->TickPhysics(InOptions.DeltaTime);
+        return Result;
+    }
+
+    /// <summary>
+    /// 동작 검사 - 바닥 위에 멈춘 상자의 활성/필터를 바꾸고 다음 스텝의 충돌쌍을 확인
+    /// 움직이지 않은 리프의 쌍도 변경 즉시 정리되어야 함, 실패한 항목 수 반환
+    /// </summary>
+    int RunChecks(const FBenchmarkOptions& InOptions)
+    {
+        UPhysicsSystem* Physics = UPhysicsSystem::Get();
+        FCollisionProcessor* Collision = UPhysicsSystem::GetCollisionSubsystem();
+        int Failures = 0;
+        auto Expect = [&Failures](const bool bCondition, const char* InName)
+        {
+            std::fprintf(stderr, "[PhysicsBenchmark] check %-48s %s\n", InName, bCondition ? "ok" : "FAILED");
+            Failures += bCondition ? 0 : 1;
+        };
+
+        if (!Physics->ResetSimulation())
+        {
+            std::fprintf(stderr, "[PhysicsBenchmark] physics state was not reset\n");
+            return 1;
+        }
+
+        FBenchmarkSceneDesc Desc;
+        Desc.Scene = EBenchmarkScene::Boxes;
+        Desc.BodyCount = 1;
+        Desc.Seed = InOptions.Scene.Seed;
+
+        FBenchmarkScene Scene;
+        Scene.Build(Desc);
+        auto Step = [&](const uint32_t InFrames)
+        {
+            for (uint32_t Frame = 0; Frame < InFrames; ++Frame)
+            {
+                Physics->TickPhysics(InOptions.DeltaTime);
+                Scene.Tick(InOptions.DeltaTime);
+            }
+        };
+
+        // 바닥 하나와 상자 하나 - 상자가 바닥에 닿아 멈출 때까지 진행
+        const UCollisionComponentBase& Floor = *Scene.GetBodies().front()->GetCollision();
+        UBenchmarkBody& Box = *Scene.GetDynamicBodies().front();
+        Step(180);
+        Expect(Collision->GetPairCountOf(Floor) == 1, "resting box keeps its floor pair");
+
+        // 멈춘 상자는 마찰로 회전이 쌓이지 않아야 함 - 5초 동안 0.01 rad 미만
+        const Quaternion RestRotation = Box.GetWorldTransform().Rotation;
+        Step(300);
+        const Quaternion Rotation = Box.GetWorldTransform().Rotation;
+        const float RotationDot = RestRotation.x * Rotation.x + RestRotation.y * Rotation.y +
+            RestRotation.z * Rotation.z + RestRotation.w * Rotation.w;
+        const float RotationAngle = 2.0f * std::acos(std::min(std::fabs(RotationDot), 1.0f));
+        Expect(RotationAngle < 0.01f, "resting box does not spin");
+
+        const uint32_t Mask = Box.GetCollision()->GetCollisionMask();
+        Box.GetCollision()->SetCollisionMask(0);
+        Step(1);
+        Expect(Collision->GetPairCountOf(Floor) == 0, "mask cleared on resting box removes pair");
+        Box.GetCollision()->SetCollisionMask(Mask);
+        Step(1);
+        Expect(Collision->GetPairCountOf(Floor) == 1, "mask restored on resting box adds pair");
+
+        Box.GetRigid()->SetActive(false);
+        Step(1);
+        Expect(Collision->GetPairCountOf(Floor) == 0, "deactivated resting body removes pair");
+        Box.GetRigid()->SetActive(true);
+        Step(1);
+        Expect(Collision->GetPairCountOf(Floor) == 1, "reactivated resting body adds pair");
+
+        // 충돌체만 다시 켜면 강체가 꺼진 채로 남음 - 시뮬레이션되지 않는 강체와는 쌍을 만들지 않음
+        Box.GetRigid()->SetActive(false);
+        Box.GetCollision()->SetActive(true);
+        Step(1);
+        Expect(Collision->GetPairCountOf(Floor) == 0, "collision without active body has no pair");
+        Box.GetRigid()->SetActive(true);
+        Step(1);
+        Expect(Collision->GetPairCountOf(Floor) == 1, "body reactivated under active collision adds pair");
+
+        Scene.Clear();
+        Physics->TickPhysics(InOptions.DeltaTime);
+
+        // 비동기 Tick 진행 중 게임 스레드 변경 - 생성/설정/활성화/소멸이 서브스텝 완료 후 적용되어야 함
+        const bool bWasAsync = Physics->IsAsyncPhysics();
+        Physics->SetAsyncPhysics(true);
+        Desc.Scene = EBenchmarkScene::Pile;
+        Desc.BodyCount = 200;
+        Scene.Build(Desc);
+        for (uint32_t Frame = 0; Frame < 60; ++Frame)
+        {
+            Scene.Tick(InOptions.DeltaTime);
+            Physics->BeginAsyncTick(InOptions.DeltaTime);
+
+            auto Extra = UGameObject::Create<UBenchmarkBody>(EBenchmarkShape::Sphere);
+            Extra->PostInitialized();
+            Extra->PostInitializedComponents();
+            Extra->Setup(Vector3(0.0f, 400.0f, 0.0f), Vector3::One() * 20.0f, 1.0f, false);
+
+            URigidBodyComponent* Rigid = Scene.GetDynamicBodies()[Frame % Desc.BodyCount]->GetRigid();
+            Rigid->SetMaxSpeed(300.0f);
+            Rigid->SetGravity(Frame % 2 == 0);
+            Rigid->SetActive(Frame % 3 != 0);
+            Extra = nullptr;
+
+            Physics->WaitAsyncTick();
+        }
+        Expect(Physics->GetBodyStore()->GetAliveCount() == Scene.GetBodies().size(),
+               "bodies created/destroyed during async tick are released");
+
+        Scene.Clear();
+        Physics->TickPhysics(InOptions.DeltaTime);
+        Physics->SetAsyncPhysics(bWasAsync);
+        return Failures;
+    }
+
+    void WriteJson(FILE* Out, const FBenchmarkOptions& InOptions, const std::vector<FBenchmarkResult>& InResults)
+    {
+        UPhysicsSystem* Physics = UPhysicsSystem::Get();
+        const double Frames = std::max<uint32_t>(InOptions.Frames, 1);
+
+        std::fprintf(Out, "{\n");
+        std::fprintf(Out, "  \"scene\": \"%s\",\n", FBenchmarkScene::GetSceneName(InOptions.Scene.Scene));
+        std::fprintf(Out, "  \"bodies\": %u,\n", InOptions.Scene.BodyCount);
+        std::fprintf(Out, "  \"seed\": %u,\n", InOptions.Scene.Seed);
+        std::fprintf(Out, "  \"frames\": %u,\n", InOptions.Frames);
+        std::fprintf(Out, "  \"dt\": %.6f,\n", InOptions.DeltaTime);
+        std::fprintf(Out, "  \"jobsPerFrame\": %u,\n", InOptions.JobsPerFrame);
+        std::fprintf(Out, "  \"simdLevel\": %d,\n", static_cast<int>(Physics->GetSimdLevel()));
+        std::fprintf(Out, "  \"batchIntegrator\": %s,\n", Physics->IsUseBatchIntegrator() ? "true" : "false");
+        std::fprintf(Out, "  \"contactBatchSolver\": %s,\n",
+                     UPhysicsSystem::GetCollisionSubsystem()->IsUseContactBatchSolver() ? "true" : "false");
+        std::fprintf(Out, "  \"contactManifold\": %s,\n",
+                     UPhysicsSystem::GetCollisionSubsystem()->IsUseContactManifold() ? "true" : "false");
+        std::fprintf(Out, "  \"coalesceJobs\": %s,\n", Physics->IsCoalescePhysicsJobs() ? "true" : "false");
+        std::fprintf(Out, "  \"sortJobs\": %s,\n", Physics->IsSortPhysicsJobs() ? "true" : "false");
+        std::fprintf(Out, "  \"strictFixedStep\": %s,\n", Physics->IsStrictFixedStep() ? "true" : "false");
+        std::fprintf(Out, "  \"localSubstepping\": %s,\n", Physics->IsLocalSubstepping() ? "true" : "false");
+        std::fprintf(Out, "  \"asyncPhysics\": %s,\n", Physics->IsAsyncPhysics() ? "true" : "false");
+        std::fprintf(Out, "  \"constraintIterations\": %u,\n",
+                     static_cast<unsigned>(UPhysicsSystem::GetCollisionSubsystem()->GetMaxConstraintIterations()));
+        std::fprintf(Out, "  \"runs\": [\n");
+
+        for (size_t r = 0; r < InResults.size(); ++r)
+        {
+            const FBenchmarkResult& Result = InResults[r];
+            const double SubSteps = std::max<uint64_t>(Result.SubSteps, 1);
+
+            std::fprintf(Out, "    {\n");
+            std::fprintf(Out, "      \"threads\": %d,\n", Result.Threads);
+            std::fprintf(Out, "      \"sceneObjects\": %u,\n", Result.BodyCount);
+            std::fprintf(Out, "      \"wallTimeMs\": %.3f,\n", Result.WallTimeMs);
+            std::fprintf(Out, "      \"frameTimeMs\": %.4f,\n", Result.WallTimeMs / Frames);
+            std::fprintf(Out, "      \"maxTickTimeMs\": %.4f,\n", Result.MaxTickTimeMs);
+            std::fprintf(Out, "      \"subSteps\": %llu,\n", static_cast<unsigned long long>(Result.SubSteps));
+            std::fprintf(Out, "      \"stepsPerSec\": %.2f,\n", Result.StepsPerSec);
+            std::fprintf(Out, "      \"avgSimulatedObjects\": %.1f,\n", Result.Total.SimulatedObjects / Frames);
+            std::fprintf(Out, "      \"avgJobRequests\": %.1f,\n", Result.Total.JobRequests / Frames);
+            // 작업 하나의 생성/제출부터 실행까지 비용
+            const double JobMs = Result.JobSubmitMs + Result.Total.GetPhaseTimeMs(EPhysicsPhase::JobExecution);
+            const double JobRequests = std::max<uint32_t>(Result.Total.JobRequests, 1);
+            std::fprintf(Out, "      \"jobSubmitMsPerFrame\": %.4f,\n", Result.JobSubmitMs / Frames);
+            std::fprintf(Out, "      \"jobNsPerRequest\": %.2f,\n", JobMs * 1.0e6 / JobRequests);
+            std::fprintf(Out, "      \"jobExecNsPerRequest\": %.2f,\n",
+                         Result.Total.GetPhaseTimeMs(EPhysicsPhase::JobExecution) * 1.0e6 / JobRequests);
+            std::fprintf(Out, "      \"avgBroadphasePairsPerStep\": %.1f,\n", Result.Total.BroadphasePairs / SubSteps);
+            std::fprintf(Out, "      \"avgNarrowphaseHitsPerStep\": %.1f,\n", Result.Total.NarrowphaseHits / SubSteps);
+            std::fprintf(Out, "      \"avgTreeReinsertsPerStep\": %.1f,\n", Result.Total.TreeReinserts / SubSteps);
+            std::fprintf(Out, "      \"avgSolverIterationsPerStep\": %.1f,\n", Result.Total.SolverIterations / SubSteps);
+            std::fprintf(Out, "      \"unconvergedIslands\": %u,\n", Result.Total.UnconvergedIslands);
+            std::fprintf(Out, "      \"avgDrift\": %.4f,\n", Result.AvgDrift);
+            std::fprintf(Out, "      \"maxDrift\": %.4f,\n", Result.MaxDrift);
+            std::fprintf(Out, "      \"belowFloor\": %u,\n", Result.BelowFloor);
+            std::fprintf(Out, "      \"avgLocalSubstepBodiesPerStep\": %.1f,\n", Result.Total.LocalSubstepBodies / SubSteps);
+            std::fprintf(Out, "      \"localSubSteps\": %u,\n", Result.Total.LocalSubSteps);
+            std::fprintf(Out, "      \"phaseMsPerFrame\": {");
+            for (size_t p = 0; p < static_cast<size_t>(EPhysicsPhase::Count); ++p)
+            {
+                const EPhysicsPhase Phase = static_cast<EPhysicsPhase>(p);
+                std::fprintf(Out, "%s \"%s\": %.4f", p == 0 ? "" : ",",
+                             FPhysicsTickStats::GetPhaseName(Phase), Result.Total.GetPhaseTimeMs(Phase) / Frames);
+            }
+            std::fprintf(Out, " }\n");
+            std::fprintf(Out, "    }%s\n", r + 1 < InResults.size() ? "," : "");
+        }
+
+        std::fprintf(Out, "  ]\n");
+        std::fprintf(Out, "}\n");
+    }
+}
+
+int main(int argc, char** argv)
+{
+    FBenchmarkOptions Options;
+    if (!ParseOptions(argc, argv, Options))
+    {
+        PrintUsage();
+        return 1;
+    }
+
+    ApplyOptions(Options);
+
+    if (Options.bRunChecks)
+    {
+        return RunChecks(Options);
+    }
+
+    std::vector<FBenchmarkResult> Results;
+    for (int Threads : Options.ThreadCounts)
+    {
+        std::fprintf(stderr, "[PhysicsBenchmark] %s x %u, threads %d\n",
+                     FBenchmarkScene::GetSceneName(Options.Scene.Scene), Options.Scene.BodyCount, Threads);
+        Results.push_back(RunOnce(Options, Threads));
+    }
+
+    FILE* Out = stdout;
+    if (!Options.OutPath.empty())
+    {
+        Out = std::fopen(Options.OutPath.c_str(), "w");
+        if (!Out)
+        {
+            std::fprintf(stderr, "Cannot open %s\n", Options.OutPath.c_str());
+            return 1;
+        }
+    }
+
+    WriteJson(Out, Options, Results);
+
+    if (Out != stdout)
+    {
+        std::fclose(Out);
+    }
+    return 0;
+}